@@ -0,0 +1,109 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  batchPlotter.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Non-interactive interface for loading data and writing plot images.
+
+#ifndef BATCH_PLOTTER_H_
+#define BATCH_PLOTTER_H_
+
+// Local headers
+#include "lp2d/gui/guiInterface.h"
+
+// wxWidgets headers
+#include <wx/arrstr.h>
+#include <wx/dynarray.h>
+#include <wx/gdicmn.h>
+
+// wxWidgets forward declarations
+class wxFrame;
+
+namespace LibPlot2D
+{
+
+/// Class for producing plot images without user interaction (i.e. from
+/// report-generation scripts).  Owns a hidden frame containing the usual
+/// renderer and plot list, so all of the normal plot settings are available
+/// through GetInterface() and GetRenderer().  Images are rendered offscreen at
+/// the requested size and encoded on worker threads, so one object should be
+/// re-used for many plots (the OpenGL context and shader programs are created
+/// only once).
+///
+/// This is a non-interactive batch interface, not a headless renderer.  The
+/// renderer is a wxGLCanvas, so a wxApp must exist (wxEntryStart() is
+/// sufficient; an event loop is not required) and a display connection is
+/// required to create the OpenGL context.  Under GTK the frame is also shown
+/// (mapped), because a context can only be made current for a realized
+/// window; it is placed outside the visible desktop, has no caption or taskbar
+/// entry, is never raised or focused and its contents are never painted.  On
+/// servers without a display or GPU, run under a virtual X server (i.e. Xvfb)
+/// with a software OpenGL implementation (i.e. Mesa's llvmpipe driver).
+class BatchPlotter
+{
+public:
+	BatchPlotter();
+	~BatchPlotter();
+
+	BatchPlotter(const BatchPlotter&) = delete;
+	BatchPlotter& operator=(const BatchPlotter&) = delete;
+
+	/// Loads the specified files, replacing any existing curves.
+	///
+	/// \param fileList List of files to load.
+	/// \param channels Indices of the channels to load (excluding the x-data
+	///                 column).  If empty, all channels are loaded.
+	///
+	/// \returns True if the files were successfully loaded.
+	bool LoadFiles(const wxArrayString& fileList,
+		const wxArrayInt& channels = wxArrayInt());
+
+	/// Removes all curves.
+	void Clear();
+
+	/// Writes an image of the current plot to file.  Returns once the image
+	/// has been rendered; the file is written in the background.
+	///
+	/// \param pathAndFileName Location to write the file (the extension
+	///                        determines the format).
+	/// \param width           Width of the image [pixels].
+	/// \param height          Height of the image [pixels].
+	///
+	/// \returns True if the image was rendered successfully.
+	bool WriteImage(const wxString& pathAndFileName, const int& width,
+		const int& height);
+
+	/// Waits for all image files to be written.
+	/// \returns True if all files since the last call were written
+	///          successfully.
+	bool Finish();
+
+	/// Gets the interface for loading and manipulating curves.
+	/// \returns The interface object.
+	GuiInterface& GetInterface() { return mGuiInterface; }
+
+	/// Gets the renderer for modifying plot settings (axis limits, labels,
+	/// grid, etc.).
+	/// \returns The renderer.
+	PlotRenderer& GetRenderer() { return *mRenderer; }
+
+private:
+	static const wxPoint mOffscreenPosition;
+
+	wxFrame* mFrame;
+	GuiInterface mGuiInterface;
+
+	// Owned by mFrame
+	PlotListGrid* mGrid;
+	PlotRenderer* mRenderer;
+};
+
+}// namespace LibPlot2D
+
+#endif// BATCH_PLOTTER_H_
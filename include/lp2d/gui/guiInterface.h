@@ -18,14 +18,20 @@
 // Local headers
 #include "lp2d/utilities/managedList.h"
 #include "lp2d/utilities/dataset2D.h"
+#include "lp2d/utilities/streamChannel.h"
+#include "lp2d/utilities/signals/triggeredCapture.h"
 #include "lp2d/parser/dataFile.h"
 #include "lp2d/renderer/plotRenderer.h"
 #include "lp2d/gui/plotListGrid.h"
 #include "lp2d/parser/fileTypeManager.h"
 
+// wxWidgets headers
+#include <wx/timer.h>
+
 // Standard C++ headers
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 // wxWidgets forward declarations
 class wxArrayString;
@@ -59,6 +65,19 @@ public:
 	/// \returns True if all files were successfully loaded.
 	bool LoadFiles(const wxArrayString &fileList);
 
+	/// Loads the specified files without prompting the user.  The same
+	/// selections are used for every file.
+	///
+	/// \param fileList      List of files to load.
+	/// \param selectionInfo Channels to load (indices exclude the x-data
+	///                      column) and whether or not to remove existing
+	///                      curves.  If no channels are specified, all
+	///                      channels are loaded.
+	///
+	/// \returns True if all files were successfully loaded.
+	bool LoadFiles(const wxArrayString &fileList,
+		const DataFile::SelectionData& selectionInfo);
+
 	/// Loads the specified text data as if it were read from a file.
 	///
 	/// \param data Text data to parse.
@@ -260,9 +279,99 @@ public:
 	/// \returns True if specified curve is plotted against the right-hand axis.
 	bool CurveIsOnRightAxis(const unsigned int& i) const;
 
+	/// Gets the legend entry (name, color and line and marker sizes) for the
+	/// specified curve.
+	///
+	/// \param i          Index of curve to query.
+	/// \param info [out] Legend entry for the curve.
+	///
+	/// \returns True if the curve exists.
+	bool GetLegendEntry(const unsigned int& i,
+		Legend::LegendEntryInfo& info) const;
+
 	/// Sets visibility to false for all curves.
 	void HideAllCurves();
 
+	/// Adds curves showing the data around each trigger event in the
+	/// specified curve, with the x-values shifted so every event occurs at
+	/// zero.  If the curve is streamed, the new curves are updated as data
+	/// arrives (showing the most recent segments); since they do not share
+	/// the scrolling x-axis, they are normally added to a different plot.
+	///
+	/// \param curve          Index of the curve to trigger on.
+	/// \param settings       Trigger and capture window parameters.
+	/// \param segmentCount   Number of segments to overlay.
+	/// \param includeAverage Flag indicating whether or not a curve showing
+	///                       the average of all captured segments should be
+	///                       added.
+	/// \param target         Interface for the plot to which the curves are
+	///                       added (this plot, if nullptr).  Must outlive
+	///                       this object.
+	void AddTriggeredCurves(const unsigned int& curve,
+		const Trigger::Settings& settings,
+		const unsigned int& segmentCount = 10,
+		const bool& includeAverage = true, GuiInterface* target = nullptr);
+
+	/// \name Methods for plotting data while it is being acquired.
+	/// @{
+
+	/// Adds a new curve which is fed by a stream of samples.  The returned
+	/// channel may be handed to an acquisition thread; samples pushed into it
+	/// are appended to the curve at each refresh (see StartStreaming()).
+	/// Removing the curve stops the updates, but the channel remains valid
+	/// for as long as the producer holds it.
+	///
+	/// \param name        Name to display to identify the curve.
+	/// \param historySize Number of points to show (the oldest points are
+	///                    discarded in blocks; see StreamChannel::Drain()).
+	/// \param capacity    Number of samples which can be queued between
+	///                    refreshes before new samples are dropped.
+	///
+	/// \returns The channel for pushing samples to the curve.
+	std::shared_ptr<StreamChannel> AddStreamChannel(const wxString& name,
+		const size_t& historySize = 100000, const size_t& capacity = 65536);
+
+	/// Starts periodically moving streamed samples into their curves and
+	/// updating the plot.
+	///
+	/// \param refreshRate Number of updates per second [Hz].
+	void StartStreaming(const double& refreshRate = 30.0);
+
+	/// Stops updating streamed curves.  Samples continue to queue in their
+	/// channels (up to the channel capacity).
+	void StopStreaming();
+
+	/// Checks to see if streamed curves are being updated.
+	/// \returns True if streaming is active.
+	bool IsStreaming() const { return mStreamTimer.IsRunning(); }
+
+	/// Sets the width of the x-axis range which scrolls to follow the newest
+	/// samples.
+	///
+	/// \param width Width of the visible range (in x-units).  If zero, all
+	///              retained points are shown.
+	void SetStreamWindow(const double& width);
+
+	/// Gets the width of the scrolling x-axis range.
+	/// \returns The width of the scrolling range.
+	double GetStreamWindow() const { return mStreamWindow; }
+
+	/// Sets a flag indicating whether or not the axis limits should follow
+	/// the streamed data.  When following, the x-axis scrolls with the newest
+	/// samples and the left y-axis is scaled to the range of the visible
+	/// streamed points.  Disable to zoom or pan through the history while
+	/// data continues to arrive.
+	///
+	/// \param follow True to follow the streamed data.
+	void SetStreamFollow(const bool& follow);
+
+	/// Gets the flag indicating whether or not the axis limits follow the
+	/// streamed data.
+	/// \returns True if the axis limits follow the streamed data.
+	bool GetStreamFollow() const { return mStreamFollow; }
+
+	/// @}
+
 private:
 	wxFrame* mOwner;
 
@@ -283,6 +392,9 @@ private:
 
 	wxString GenerateTemporaryFileName(const unsigned int &length = 10) const;
 
+	bool DoLoadFiles(const wxArrayString &fileList,
+		const DataFile::SelectionData* fixedSelections);
+
 	wxArrayString mLastFilesLoaded;
 	DataFile::SelectionData mLastSelectionInfo;
 	wxArrayString mLastDescriptions;
@@ -329,6 +441,37 @@ private:
 	void UpdateCurveProperties(const unsigned int &index,
 		const Color &color, const bool &visible,
 		const bool &rightAxis);
+
+	struct StreamCurve
+	{
+		std::shared_ptr<StreamChannel> channel;
+		Dataset2D* data;// Owned by mPlotList
+		size_t historySize;
+	};
+
+	std::vector<StreamCurve> mStreamCurves;
+
+	struct StreamTrigger
+	{
+		const Dataset2D* source;// Owned by mPlotList
+		std::unique_ptr<TriggeredCapture> capture;
+		GuiInterface* target;
+
+		// Owned by target->mPlotList
+		std::vector<Dataset2D*> segments;
+		Dataset2D* average = nullptr;
+	};
+
+	std::vector<StreamTrigger> mStreamTriggers;
+	wxTimer mStreamTimer;
+	double mStreamWindow = 0.0;
+	bool mStreamFollow = true;
+
+	void UpdateStreams();
+	void UpdateStreamLimits(const double& latestX);
+	void UpdateStreamTriggers();
+	bool ReplaceCurveData(Dataset2D* data, const Dataset2D& newData);
+	bool GetCurveIndex(const Dataset2D* data, unsigned int& index) const;
 };
 
 
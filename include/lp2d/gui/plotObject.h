@@ -19,9 +19,11 @@
 
 // wxWidgets headers
 #include <wx/wx.h>
+#include <wx/timer.h>
 
 // Local headers
 #include "lp2d/renderer/primitives/axis.h"
+#include "lp2d/utilities/flagEnum.h"
 
 namespace LibPlot2D
 {
@@ -30,6 +32,7 @@ namespace LibPlot2D
 class PlotRenderer;
 class TextRendering;
 class PlotCurve;
+class PlotCurveBatch;
 class Dataset2D;
 class Color;
 class GuiInterface;
@@ -44,9 +47,31 @@ public:
 	/// \param guiInterface Reference to interface object.
 	PlotObject(PlotRenderer &renderer, GuiInterface& guiInterface);
 
-	/// Updates the plot formatting.
+	/// Enumeration of the parts of the plot state that may be modified
+	/// between updates.  Update() only rebuilds the objects that depend on
+	/// the modified state.
+	enum class Dirty
+	{
+		None = 0,
+		Data = 1 << 0,///< Curves added/removed, or data, visibility or axis assignment changed
+		Limits = 1 << 1,///< Axis limits, auto-scaling or logarithmic scaling changed
+		Layout = 1 << 2,///< Tick spacing, axis labels or title changed
+		Style = 1 << 3,///< Rendering style common to all curves changed
+		Cursors = 1 << 4,///< Cursor positions changed
+		Size = 1 << 5,///< Window size changed
+		All = Data | Limits | Layout | Style | Cursors | Size
+	};
+
+	/// Updates the plot formatting.  Only the objects affected by changes
+	/// made since the last update are rebuilt.
 	void Update();
 
+	/// Flags the specified state as modified, for changes which are not made
+	/// through this object's methods.
+	///
+	/// \param dirty The modified state.
+	void Invalidate(const Dirty& dirty);
+
 	/// Removes all existing plots.
 	void RemoveExistingPlots();
 
@@ -60,6 +85,21 @@ public:
 	/// \param data Data set to add.
 	void AddCurve(const Dataset2D &data);
 
+	/// Indicates that the data associated with the specified curve was
+	/// modified in-place, so cached information about the data (i.e. the
+	/// range of values used for auto-scaling) must be re-computed.
+	///
+	/// \param index Index of the modified curve.
+	void SetCurveDataModified(const unsigned int &index);
+
+	/// Indicates that points were appended to the data associated with the
+	/// specified curve, so only the new points must be scanned.
+	///
+	/// \param index Index of the modified curve.
+	/// \param count Number of points appended.
+	void SetCurveDataAppended(const unsigned int &index,
+		const unsigned int &count);
+
 	/// \name Accessors for the axes limits
 	/// @{
 
@@ -138,7 +178,24 @@ public:
 	/// rendering algorithm.
 	///
 	/// \param pretty Set true to use the higher quality rendering algorithm.
-	void SetPrettyCurves(const bool &pretty) { mPretty = pretty; }
+	void SetPrettyCurves(const bool &pretty);
+
+	/// Sets the factor by which the number of rendered points in each curve
+	/// is reduced.
+	///
+	/// \param decimation Decimation factor (1 to render all points).
+	void SetCurveDecimation(const unsigned int &decimation);
+
+	/// Sets the flag indicating whether or not curves are rendered as a
+	/// density image (per-pixel hit counts displayed through a color map)
+	/// instead of as individual lines and markers.
+	///
+	/// \param density Set true to render curves as a density image.
+	void SetDensityCurves(const bool &density);
+
+	/// Checks to see if curves are rendered as a density image.
+	/// \returns True if curves are rendered as a density image.
+	bool GetDensityCurves() const;
 
 	/// \name Text object controls
 	/// @{
@@ -153,15 +210,21 @@ public:
 	wxString GetRightYLabel() const;
 	wxString GetTitle() const;
 
+	/// Sets the text of the statistics overlay, drawn in the upper left-hand
+	/// corner of the plot area.
+	///
+	/// \param text Text to display.  If empty, the overlay is hidden.
+	void SetStatisticsText(const wxString& text);
+
 	/// @}
 
 	/// \name Scaling methods
 	/// @{
 
 	void ResetAutoScaling();
-	void SetAutoScaleBottom() { mAutoScaleX = true; }
-	void SetAutoScaleLeft() { mAutoScaleLeftY = true; }
-	void SetAutoScaleRight() { mAutoScaleRightY = true; }
+	void SetAutoScaleBottom() { mAutoScaleX = true; Invalidate(Dirty::Limits); }
+	void SetAutoScaleLeft() { mAutoScaleLeftY = true; Invalidate(Dirty::Limits); }
+	void SetAutoScaleRight() { mAutoScaleRightY = true; Invalidate(Dirty::Limits); }
 
 	bool GetXAxisAutoScaled() const { return mAutoScaleX; }
 
@@ -198,6 +261,38 @@ public:
 
 	bool CurveMarkersVisible(const unsigned int& i) const;
 
+	/// Checks to see if the x-values of the specified curve are sorted.
+	///
+	/// \param i Index of the curve.
+	///
+	/// \returns False for XY data with unsorted x-values.
+	bool CurveHasSortedX(const unsigned int& i) const;
+
+	/// Structure describing a data point found by FindNearestSample().
+	struct Sample
+	{
+		unsigned int curve;///< Index of the curve.
+		unsigned int index;///< Index of the point within the curve's data.
+		double x;///< X-value of the point.
+		double y;///< Y-value of the point.
+		double xPixel;///< Location of the point w.r.t. the left of the window.
+		double yPixel;///< Location of the point w.r.t. the bottom of the window.
+	};
+
+	/// Finds the data point closest to the specified location, considering
+	/// all visible curves.  Each curve is searched by binary search on the
+	/// x-values or, for curves with unsorted x-values, with its spatial index,
+	/// so the cost does not grow with the number of points.
+	///
+	/// \param x            Location w.r.t. the left of the window [pixels].
+	/// \param y            Location w.r.t. the bottom of the window [pixels].
+	/// \param radius       Maximum distance to search [pixels].
+	/// \param sample [out] The closest data point.
+	///
+	/// \returns True if a point was found within the search radius.
+	bool FindNearestSample(const int& x, const int& y,
+		const unsigned int& radius, Sample& sample) const;
+
 	/// Gets the offset from the side of the window for horizontal axes.
 	///
 	/// \param withLabel Indicates if the calculation should allow room for a
@@ -218,7 +313,7 @@ public:
 
 	/// Sets a flag indicating that the plot area size needs to be updated
 	/// during the next render cycle.
-	inline void UpdatePlotAreaSize() { mNeedScissorUpdate = true; }
+	inline void UpdatePlotAreaSize() { mNeedScissorUpdate = true; Invalidate(Dirty::Size); }
 
 	/// Gets the file name for the TrueType font file used to render axis text.
 	/// \returns The file name for the axis font.
@@ -241,6 +336,11 @@ private:
 	Axis *mAxisRight;
 
 	TextRendering *mTitleObject;
+	TextRendering *mStatisticsObject;
+
+	// Objects responsible for drawing the curves bound to each y-axis
+	PlotCurveBatch *mLeftCurveBatch;
+	PlotCurveBatch *mRightCurveBatch;
 
 	// The minimums and maximums for the axis
 	double mXMin, mXMax, mYLeftMin, mYLeftMax, mYRightMin, mYRightMax;
@@ -259,7 +359,8 @@ private:
 	bool mLeftUsed;
 	bool mRightUsed = false;
 
-	bool mPretty;
+	bool mPretty = true;
+	unsigned int mDecimation = 1;
 
 	double mXMajorResolution;
 	double mYLeftMajorResolution;
@@ -267,13 +368,30 @@ private:
 
 	bool mNeedScissorUpdate = true;
 
+	Dirty mDirty = Dirty::All;
+
 	// The actual plot objects
 	std::vector<PlotCurve*> mPlotList;
 	std::vector<const Dataset2D*> mDataList;
 
+	// Range of values for each data set (cached to avoid scanning all of the
+	// data every time the plot is updated)
+	struct CurveExtremes
+	{
+		bool valid = false;
+		double xMin = 0.0;
+		double xMax = 0.0;
+		double yMin = 0.0;
+		double yMax = 0.0;
+	};
+
+	std::vector<CurveExtremes> mExtremesList;
+
 	std::string mFontFileName;
+	wxTimer mFontIndexTimer;
 	void CreateAxisObjects();
 	void InitializeFonts();
+	void OnFontIndexTimer();
 
 	// Handles all of the formatting for the plot
 	void FormatPlot();
@@ -302,6 +420,7 @@ private:
 	void FormatTitle();
 
 	void FormatCurves();
+	void AssignCurveBatches();
 
 	void CheckForZeroRange();
 	void HandleZeroRangeAxis(double &min, double &max) const;
@@ -315,7 +434,9 @@ private:
 		double &major, double &minor) const;
 	void ValidateLogarithmicLimits(Axis &axis, const double &min);
 	void SetOriginalAxisLimits();
-	void GetAxisExtremes(const Dataset2D &data, Axis *yAxis);
+	void GetAxisExtremes(const unsigned int &index, Axis *yAxis);
+	void UpdateCurveExtremes(const unsigned int &index,
+		const unsigned int &firstPoint = 0);
 	void ResetOriginalLimits();
 	void MatchYAxes();
 	double GetFirstValidValue(const std::vector<double>& data) const;
@@ -327,6 +448,14 @@ private:
 		const double& centerRange, double& minLimit, double& maxLimit);
 };
 
+/// Specialization for enabling bitwise operations for the Dirty enumeration.
+template<>
+struct EnableBitwiseOperators<PlotObject::Dirty>
+{
+	/// Flag that indicates that bitwise operators should be enabled.
+	static constexpr bool mEnable = true;
+};
+
 }// namespace LibPlot2D
 
 #endif// PLOT_OBJECT_H_
@@ -0,0 +1,108 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  sharedMemorySource.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Feeds streamed curves from an external process through shared
+//        memory.
+
+#ifndef SHARED_MEMORY_SOURCE_H_
+#define SHARED_MEMORY_SOURCE_H_
+
+// Local headers
+#include "lp2d/utilities/sharedMemoryProtocol.h"
+#include "lp2d/utilities/sharedMemoryRegion.h"
+#include "lp2d/utilities/streamChannel.h"
+
+// Standard C++ headers
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace LibPlot2D
+{
+
+// Local forward declarations
+class GuiInterface;
+
+/// Reader for the protocol described in SharedMemoryProtocol.  Attaching
+/// adds one streamed curve for each channel in the shared-memory object (see
+/// GuiInterface::AddStreamChannel()); a background thread then copies each
+/// new block from shared memory directly into the stream channels.  Call
+/// GuiInterface::StartStreaming() to display the data as it arrives.  The
+/// curves (and their history) remain after detaching.
+class SharedMemorySource
+{
+public:
+	/// Constructor.
+	///
+	/// \param guiInterface Interface to which the curves are added.
+	explicit SharedMemorySource(GuiInterface& guiInterface);
+	~SharedMemorySource();
+
+	SharedMemorySource(const SharedMemorySource&) = delete;
+	SharedMemorySource& operator=(const SharedMemorySource&) = delete;
+
+	/// Attaches to the specified shared-memory object and starts reading.
+	/// Reading begins with the oldest block still held in the ring.  Must be
+	/// called from the GUI thread.
+	///
+	/// \param name        Name of the shared-memory object.
+	/// \param historySize Maximum number of points to keep for each curve.
+	///
+	/// \returns True if the object was opened and its header is valid.
+	bool Attach(const std::string& name, const size_t& historySize = 100000);
+
+	/// Stops reading and unmaps the shared-memory object.
+	void Detach();
+
+	/// Checks to see if the source is attached to a shared-memory object.
+	/// \returns True if attached.
+	inline bool IsAttached() const { return mHeader != nullptr; }
+
+	/// Checks to see if the producer has closed the stream.  Once closed, the
+	/// reader stops after all remaining blocks have been read.
+	/// \returns True if the producer has closed the stream.
+	bool IsProducerClosed() const;
+
+	/// Gets the number of blocks which were overwritten by the producer
+	/// before they could be read.
+	/// \returns The number of lost blocks.
+	inline unsigned long long GetLostBlockCount() const { return mLostBlocks; }
+
+	/// Gets a description of the most recent error.
+	/// \returns The error description.
+	inline const std::string& GetLastError() const { return mLastError; }
+
+private:
+	GuiInterface& mGuiInterface;
+
+	SharedMemoryRegion mRegion;
+	SharedMemoryProtocol::Header* mHeader = nullptr;
+
+	std::vector<std::shared_ptr<StreamChannel>> mChannels;
+
+	std::thread mReader;
+	std::atomic<bool> mStopReading{ false };
+	std::atomic<unsigned long long> mLostBlocks{ 0 };
+
+	std::string mLastError;
+
+	bool HeaderIsValid();
+
+	void ReadBlocks(uint64_t sequence);
+	bool ReadBlock(const uint64_t& sequence, std::vector<double>& x,
+		std::vector<double>& y, uint32_t& count) const;
+};
+
+}// namespace LibPlot2D
+
+#endif// SHARED_MEMORY_SOURCE_H_
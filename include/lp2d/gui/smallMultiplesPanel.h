@@ -0,0 +1,105 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  smallMultiplesPanel.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Panel containing a grid of plots which share OpenGL resources.
+
+#ifndef SMALL_MULTIPLES_PANEL_H_
+#define SMALL_MULTIPLES_PANEL_H_
+
+// Local headers
+#include "lp2d/gui/guiInterface.h"
+
+// wxWidgets headers
+#include <wx/panel.h>
+
+// Standard C++ headers
+#include <memory>
+#include <vector>
+
+namespace LibPlot2D
+{
+
+/// Panel for displaying a grid of small plots (i.e. one plot per channel).
+/// Each plot has its own interface and (hidden) plot list, so all of the
+/// normal plot settings are available through GetInterface() and
+/// GetRenderer(), but every plot draws with the same OpenGL context, so the
+/// shader programs are built once and the curve data of all plots is held in
+/// a single vertex buffer (each dataset is uploaded once).  The x-axes of all
+/// plots may optionally be linked, so zooming or panning one plot applies the
+/// same x-limits to the others.
+class SmallMultiplesPanel : public wxPanel
+{
+public:
+	/// Constructor.
+	///
+	/// \param parent  Parent window.
+	/// \param id      Window ID.
+	/// \param rows    Number of rows of plots.
+	/// \param columns Number of columns of plots.
+	SmallMultiplesPanel(wxWindow* parent, wxWindowID id,
+		const unsigned int& rows, const unsigned int& columns);
+	~SmallMultiplesPanel();
+
+	/// Gets the number of plots in the panel.
+	/// \returns The number of plots.
+	inline unsigned int GetPlotCount() const
+	{ return static_cast<unsigned int>(mRenderers.size()); }
+
+	/// Gets the interface for loading and manipulating the curves of the
+	/// specified plot.
+	///
+	/// \param i Index of the plot (plots are numbered across each row).
+	///
+	/// \returns The interface object.
+	GuiInterface& GetInterface(const unsigned int& i);
+
+	/// Gets the renderer for modifying the settings of the specified plot.
+	///
+	/// \param i Index of the plot (plots are numbered across each row).
+	///
+	/// \returns The renderer.
+	PlotRenderer& GetRenderer(const unsigned int& i);
+
+	/// Adds a curve to the specified plot.
+	///
+	/// \param i    Index of the plot.
+	/// \param data Data to add.
+	/// \param name Name of the curve.
+	void AddCurve(const unsigned int& i, std::unique_ptr<Dataset2D> data,
+		const wxString& name);
+
+	/// Sets a flag indicating whether or not the x-axes of all plots should
+	/// show the same range.
+	///
+	/// \param link True to link the x-axes.
+	void SetLinkXAxes(const bool& link);
+
+	/// Gets a flag indicating whether or not the x-axes are linked.
+	/// \returns True if the x-axes are linked.
+	inline bool GetLinkXAxes() const { return mLinkXAxes; }
+
+private:
+	std::vector<std::unique_ptr<GuiInterface>> mInterfaces;
+
+	// Owned by this (as child windows)
+	std::vector<PlotRenderer*> mRenderers;
+
+	bool mLinkXAxes = true;
+	bool mSynchronizing = false;
+
+	void SynchronizeXAxes(const PlotRenderer& source);
+
+	void OnXLimitsChanged(wxCommandEvent& event);
+};
+
+}// namespace LibPlot2D
+
+#endif// SMALL_MULTIPLES_PANEL_H_
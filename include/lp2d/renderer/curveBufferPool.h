@@ -0,0 +1,119 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  curveBufferPool.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Vertex buffer shared by all curve batches drawn with one context.
+
+#ifndef CURVE_BUFFER_POOL_H_
+#define CURVE_BUFFER_POOL_H_
+
+// GLEW headers
+#include <GL/glew.h>
+
+// Standard C++ headers
+#include <unordered_map>
+
+namespace LibPlot2D
+{
+
+/// Single vertex buffer (and vertex array) holding the curve data of every
+/// client drawn with one OpenGL context (see RenderWindow::ShareContext()).
+/// Each client (i.e. a PlotCurveBatch) is given a contiguous region of the
+/// buffer, so the data for each curve is uploaded once and windows sharing
+/// the context draw from the same buffer.  Positions and colors are stored in
+/// separate blocks (all positions first).  Regions are allocated with room to
+/// grow; when the buffer must grow, the existing regions are copied on the
+/// GPU (which also discards the space freed by released regions), so clients
+/// must check GetFirstVertex() before each draw.  All methods which access
+/// the buffer require the context to be current.
+class CurveBufferPool
+{
+public:
+	/// Constructor.
+	///
+	/// \param positionLocation Location of the position attribute.
+	/// \param colorLocation    Location of the color attribute.
+	/// \param dimension        Number of components in each position.
+	CurveBufferPool(const GLuint& positionLocation, const GLuint& colorLocation,
+		const unsigned int& dimension);
+	~CurveBufferPool();
+
+	CurveBufferPool(const CurveBufferPool&) = delete;
+	CurveBufferPool& operator=(const CurveBufferPool&) = delete;
+
+	/// Ensures the specified client has room for the specified number of
+	/// vertices.  If the client's region must grow, its contents are copied
+	/// to the new region.
+	///
+	/// \param client Object owning the region.
+	/// \param count  Number of vertices required.
+	///
+	/// \returns Index of the first vertex in the client's region.
+	GLint Reserve(const void* client, const GLsizei& count);
+
+	/// Frees the region owned by the specified client.  Does not require a
+	/// current context.
+	///
+	/// \param client Object owning the region.
+	void Release(const void* client);
+
+	/// Writes vertex data to the buffer.
+	///
+	/// \param first     Index of the first vertex to write.
+	/// \param count     Number of vertices to write.
+	/// \param positions Position data (\p count * dimension values).
+	/// \param colors    Color data (\p count * 4 values).
+	void Write(const GLint& first, const GLsizei& count,
+		const float* positions, const float* colors) const;
+
+	/// Gets the location of the specified client's region.
+	///
+	/// \param client Object owning the region.
+	///
+	/// \returns Index of the first vertex in the client's region, or -1 if
+	///          the client has no region.
+	GLint GetFirstVertex(const void* client) const;
+
+	/// Gets the vertex array describing the buffer.
+	/// \returns The OpenGL id of the vertex array.
+	GLuint GetVertexArray() const { return mVertexArray; }
+
+private:
+	static const GLsizei mMinimumCapacity;// [vertices]
+
+	const GLuint mPositionLocation;
+	const GLuint mColorLocation;
+	const unsigned int mDimension;
+
+	GLuint mVertexArray = 0;
+	GLuint mBuffer = 0;
+
+	// All sizes are in vertices
+	GLsizei mCapacity = 0;
+	GLsizei mUsed = 0;// All space beyond this is free
+	GLsizei mLive = 0;// Space within regions owned by clients
+
+	struct Region
+	{
+		GLint first;
+		GLsizei capacity;
+	};
+
+	std::unordered_map<const void*, Region> mRegions;
+
+	void Reallocate(const GLsizei& capacity);
+	void CopyRegion(const GLuint& sourceBuffer, const GLsizei& sourceCapacity,
+		const GLint& sourceFirst, const GLint& targetFirst,
+		const GLsizei& count) const;
+};
+
+}// namespace LibPlot2D
+
+#endif// CURVE_BUFFER_POOL_H_
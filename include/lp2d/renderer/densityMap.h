@@ -0,0 +1,100 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  densityMap.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Offscreen accumulation of per-pixel hit counts, displayed through a
+//        color map.
+
+#ifndef DENSITY_MAP_H_
+#define DENSITY_MAP_H_
+
+// GLEW headers
+#include <GL/glew.h>
+
+// Standard C++ headers
+#include <string>
+
+namespace LibPlot2D
+{
+
+/// Object for rendering geometry as a density (intensity) image.  Between
+/// calls to BeginAccumulation() and EndAccumulation(), each fragment adds its
+/// red component to a floating-point buffer the size of the viewport.  The
+/// maximum count is found on the GPU and the buffer is drawn into the
+/// previously bound framebuffer through a logarithmic color map.  Pixels that
+/// were not hit are left untouched, so the background shows through.  The cost
+/// of the reduction and display passes depends only on the number of pixels.
+class DensityMap
+{
+public:
+	DensityMap() = default;
+	~DensityMap();
+
+	DensityMap(const DensityMap&) = delete;
+	DensityMap& operator=(const DensityMap&) = delete;
+
+	/// Binds (and clears) the accumulation buffer and enables additive
+	/// blending.  Requires a current OpenGL context.
+	///
+	/// \param reuseMaximum Set true to normalize the counts by the maximum
+	///                     found in the previous accumulation instead of
+	///                     searching this buffer (i.e. for all but the first
+	///                     tile of an offscreen rendering, so all tiles share
+	///                     one color scale).
+	///
+	/// \returns True if the accumulation buffer is available; if false, the
+	///          caller should draw normally and not call EndAccumulation().
+	bool BeginAccumulation(const bool& reuseMaximum = false);
+
+	/// Restores the previous framebuffer and blend state and draws the
+	/// accumulated counts through the color map.  Honors the current scissor
+	/// test.
+	void EndAccumulation();
+
+private:
+	static const std::string mVertexShader;
+	static const std::string mReductionVertexShader;
+	static const std::string mReductionFragmentShader;
+	static const std::string mDisplayFragmentShader;
+
+	bool mUnsupported = false;
+	bool mReuseMaximum = false;
+	bool mMaximumValid = false;
+
+	GLint mWidth = 0;
+	GLint mHeight = 0;
+
+	GLuint mDensityFramebuffer = 0;
+	GLuint mDensityTexture = 0;
+	GLuint mMaximumFramebuffer = 0;
+	GLuint mMaximumTexture = 0;
+
+	GLuint mReductionProgram = 0;
+	GLuint mDisplayProgram = 0;
+	GLuint mVertexArray = 0;
+	GLuint mVertexBuffer = 0;
+
+	// State to be restored at the end of accumulation
+	GLint mPreviousFramebuffer = 0;
+	GLint mPreviousViewport[4];
+	GLint mPreviousProgram = 0;
+	GLboolean mScissorEnabled = GL_FALSE;
+	GLboolean mBlendEnabled = GL_FALSE;
+
+	bool Prepare(const GLint& width, const GLint& height);
+	bool CreateTarget(const GLint& width, const GLint& height,
+		GLuint& framebuffer, GLuint& texture) const;
+	void BuildPrograms();
+	void Free();
+};
+
+}// namespace LibPlot2D
+
+#endif// DENSITY_MAP_H_
@@ -0,0 +1,125 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  fontCache.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Process-wide cache of font faces and glyph atlas textures.
+
+#ifndef FONT_CACHE_H_
+#define FONT_CACHE_H_
+
+// Freetype headers
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+// Standard C++ headers
+#include <string>
+#include <map>
+#include <tuple>
+#include <limits>
+
+namespace LibPlot2D
+{
+
+/// Process-wide cache of Freetype faces and glyph atlas textures.  Each font
+/// file is loaded only once, and all Text objects using the same font file and
+/// size share a single texture containing all of the glyphs.  The OpenGL
+/// contexts of all RenderWindows share objects, so the textures may be used in
+/// any window.
+class FontCache
+{
+public:
+	/// Structure describing the location of a glyph within an atlas and the
+	/// metrics required to position it.
+	struct Glyph
+	{
+		float sLeft;///< Texture coordinate of the left edge.
+		float sRight;///< Texture coordinate of the right edge.
+		float tTop;///< Texture coordinate of the top edge.
+		float tBottom;///< Texture coordinate of the bottom edge.
+		int xSize;///< Width of the glyph in pixels.
+		int ySize;///< Height of the glyph in pixels.
+		int xBearing;///< Horizontal offset from the origin in pixels.
+		int yBearing;///< Vertical offset from the baseline in pixels.
+		unsigned int advance;///< Horizontal advance in 1/64th pixels.
+	};
+
+	/// Structure containing a texture with the packed glyphs for a single font
+	/// file and size.
+	struct Atlas
+	{
+		std::map<char, Glyph> glyphs;///< Glyph information.
+		unsigned int textureId = std::numeric_limits<unsigned int>::max();///< OpenGL texture.
+		unsigned int width = 0;///< Width of the texture in pixels.
+		unsigned int height = 0;///< Height of the texture in pixels.
+	};
+
+	/// Loads the specified font file (or increments the reference count if it
+	/// is already loaded).  Each successful call must be matched by a call to
+	/// ReleaseFace().
+	///
+	/// \param fontFileName Path and file name to the font file.
+	///
+	/// \returns True if the font file was successfully loaded.
+	static bool AcquireFace(const std::string& fontFileName);
+
+	/// Decrements the reference count for the specified font file, and
+	/// unloads the file if it is no longer used.
+	///
+	/// \param fontFileName Path and file name to the font file.
+	static void ReleaseFace(const std::string& fontFileName);
+
+	/// Gets the atlas for the specified font and size, generating it if
+	/// necessary.  Requires a current OpenGL context and that the face has
+	/// been acquired.  Each successful call must be matched by a call to
+	/// ReleaseAtlas().
+	///
+	/// \param fontFileName Path and file name to the font file.
+	/// \param width        Width of the glyphs in pixels (zero to determine
+	///                     width automatically).
+	/// \param height       Height of the glyphs in pixels.
+	///
+	/// \returns Pointer to the atlas, or nullptr if the glyphs could not be
+	///          generated.
+	static const Atlas* AcquireAtlas(const std::string& fontFileName,
+		const unsigned int& width, const unsigned int& height);
+
+	/// Decrements the reference count for the specified atlas, and frees the
+	/// associated texture if it is no longer used.
+	///
+	/// \param atlas Atlas previously obtained from AcquireAtlas().
+	static void ReleaseAtlas(const Atlas* atlas);
+
+private:
+	static FT_Library mFt;
+
+	struct FaceEntry
+	{
+		FT_Face face = nullptr;
+		unsigned int referenceCount = 0;
+	};
+
+	struct AtlasEntry
+	{
+		Atlas atlas;
+		unsigned int referenceCount = 0;
+	};
+
+	typedef std::tuple<std::string, unsigned int, unsigned int> AtlasKey;
+
+	static std::map<std::string, FaceEntry> mFaces;
+	static std::map<AtlasKey, AtlasEntry> mAtlases;
+
+	static bool GenerateAtlas(FT_Face face, const unsigned int& width,
+		const unsigned int& height, Atlas& atlas);
+};
+
+}// namespace LibPlot2D
+
+#endif// FONT_CACHE_H_
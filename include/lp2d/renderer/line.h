@@ -250,6 +250,10 @@ private:
 		double dyEdge;
 	};
 
+	// Scratch storage, re-used to avoid allocating each time a line is built
+	mutable std::vector<Offsets> mOffsets;
+	mutable std::vector<std::pair<double, double>> mPoints;
+
 	void DoUglyDraw(const double &x1, const double &y1, const double &x2,
 		const double &y2, const UpdateMethod& update,
 		Primitive::BufferInfo& bufferInfo) const;
@@ -272,7 +276,8 @@ private:
 		const LineStyle& style, Primitive::BufferInfo& bufferInfo) const;
 
 	void AllocateBuffer(const unsigned int& vertexCount,
-		const unsigned int& triangleCount, Primitive::BufferInfo& bufferInfo) const;
+		const unsigned int& triangleCount, const UpdateMethod& update,
+		Primitive::BufferInfo& bufferInfo) const;
 };
 
 }// namespace LibPlot2D
@@ -32,6 +32,10 @@
 // wxWidgets forward declarations
 class wxString;
 
+/// Event sent (queued) by a PlotRenderer when the limits of its x-axis
+/// change.  Used to keep the x-axes of several plots linked.
+wxDECLARE_EVENT(X_LIMITS_CHANGED_EVENT, wxCommandEvent);
+
 namespace LibPlot2D
 {
 
@@ -56,14 +60,18 @@ public:
 		const wxGLAttributes& attr);
 	~PlotRenderer() = default;
 
-	/// Enumeration of quality levels for drawing curves.
+	/// Enumeration of quality levels for drawing curves.  If the Adaptive
+	/// flag is set, the quality used while dragging is selected automatically
+	/// (including decimation of the rendered points) based on the measured
+	/// frame time (see SetFrameTimeBudget()), and HighDrag is ignored.
 	enum class CurveQuality
 	{
 		AlwaysLow = 0,
 		HighWrite = 1 << 0,
 		HighDrag = 1 << 1,
 		HighStatic = 1 << 2,
-		AlwaysHigh = HighWrite | HighDrag | HighStatic
+		AlwaysHigh = HighWrite | HighDrag | HighStatic,
+		Adaptive = 1 << 3
 	};
 
 	/// \name Getters
@@ -99,6 +107,9 @@ public:
 	bool GetMinorGridOn() const;
 
 	CurveQuality GetCurveQuality() const { return mCurveQuality; }
+	bool GetDensityMode() const;
+	bool GetHoverReadout() const { return mHoverReadout; }
+	bool GetStatisticsOverlay() const { return mStatisticsOverlay; }
 
 	bool LegendIsVisible() const;
 
@@ -136,6 +147,7 @@ public:
 	double GetRightMajorResolution() const;
 
 	void SetGridColor(const Color &color);
+	void SetBackgroundColor(const Color& backgroundColor) override;
 
 	void SetXLabel(wxString text);
 	void SetLeftYLabel(wxString text);
@@ -148,6 +160,29 @@ public:
 
 	void SetCurveQuality(const CurveQuality& curveQuality);
 
+	/// Enables or disables density rendering of the curves.  Density
+	/// rendering is intended for heavily overplotted data; each pixel is
+	/// colored according to the number of curve segments passing through it.
+	///
+	/// \param density True to enable density rendering.
+	void SetDensityMode(const bool& density);
+
+	/// Enables or disables the hover readout.  When enabled, the data point
+	/// closest to the mouse (among all visible curves) is found as the mouse
+	/// moves, and its curve and value are displayed next to the point.
+	///
+	/// \param hover True to enable the hover readout.
+	void SetHoverReadout(const bool& hover);
+
+	/// Enables or disables the statistics overlay.  When enabled, a summary
+	/// of the render statistics for the previous frame is drawn in the corner
+	/// of the plot area (see RenderWindow::GetRenderStatistics()).  Enabling
+	/// the overlay enables collection of statistics.  The overlay is not
+	/// included in exported images.
+	///
+	/// \param show True to enable the overlay.
+	void SetStatisticsOverlay(const bool& show);
+
 	void SetLegendOn();
 	void SetLegendOff();
 
@@ -180,6 +215,22 @@ public:
 	/// \param data Data set to add.
 	void AddCurve(const Dataset2D &data);
 
+	/// Indicates that the data for the specified curve was modified in-place.
+	/// Must be called before the next update for the changes to be shown.
+	///
+	/// \param index Index of the modified curve.
+	void SetCurveDataModified(const unsigned int &index);
+
+	/// Indicates that points were appended to the data for the specified
+	/// curve (and no other points changed), so only the new points must be
+	/// processed.  Must be called before the next update for the changes to
+	/// be shown.
+	///
+	/// \param index Index of the modified curve.
+	/// \param count Number of points appended.
+	void SetCurveDataAppended(const unsigned int &index,
+		const unsigned int &count);
+
 	/// Removes all curves from the list.
 	void RemoveAllCurves();
 
@@ -205,6 +256,16 @@ public:
 
 	void UpdateDisplay();///< Updates the rendered scene.
 
+	/// Requests an update of the rendered scene.  Unlike UpdateDisplay(), the
+	/// update is deferred until the next paint event, so repeated requests
+	/// between frames are coalesced into a single update.
+	void RequestUpdateDisplay();
+
+	/// Requests an update of the rendered scene following changes to overlay
+	/// objects only (i.e. cursors and the zoom box).  Avoids re-formatting the
+	/// plot.  The update is deferred until the next paint event.
+	void UpdateOverlays();
+
 	/// Gets the value at which the cursor intersects the x-axis.
 	/// \returns The value at which the cursor intersects the x-axis.
 	double GetLeftCursorValue() const;
@@ -215,6 +276,12 @@ public:
 
 	void UpdateCursors();///< Updates the cursor calculations.
 
+	/// Re-applies the plot's axis font to the legends and requests an update
+	/// of the rendered scene.  Called when the plot font changes after
+	/// creation (i.e. a fallback font is replaced once the font index is
+	/// available).
+	void UpdateFonts();
+
 	void SaveCurrentZoom();///< Adds the current zoom level to the stack.
 	void ClearZoomStack();///< Empties the zoom stack.
 
@@ -249,20 +316,27 @@ public:
 	};
 
 	/// Loads the specified matrix into the modelview uniform for the current
-	/// shader.
+	/// shader.  If the current shader has a logarithmic scaling uniform, the
+	/// scaling of the associated axes is loaded, too.
 	///
 	/// \param mv Source of matrix to load into the uniform.
 	void LoadModelviewUniform(const Modelview& mv);
 
+	/// Name of the uniform selecting linear or logarithmic scaling for the x
+	/// and y components of curve positions.
+	static const std::string mLogarithmicName;
+
 	/// Sets the valud of the modelview matrix.
 	///
 	/// \param m Value to assign to the modelview matrix.
-	void SetLeftModelview(const Eigen::Matrix4d& m) { mLeftModelview = m; }
+	void SetLeftModelview(const Eigen::Matrix4d& m)
+	{ if (m != mLeftModelview) InvalidateStaticLayer(); mLeftModelview = m; }
 
 	/// Sets the valud of the modelview matrix.
 	///
 	/// \param m Value to assign to the modelview matrix.
-	void SetRightModelview(const Eigen::Matrix4d& m) { mRightModelview = m; }
+	void SetRightModelview(const Eigen::Matrix4d& m)
+	{ if (m != mRightModelview) InvalidateStaticLayer(); mRightModelview = m; }
 
 	/// \name Methods for applying scaling functions
 	/// @{
@@ -336,6 +410,13 @@ public:
 	/// \returns True if curve \p i has visible markers.
 	bool CurveMarkersVisible(const unsigned int& i) const;
 
+	/// Checks to see if the x-values of the specified curve are sorted.
+	///
+	/// \param i Index of curve of interest.
+	///
+	/// \returns False if curve \p i is XY data with unsorted x-values.
+	bool CurveHasSortedX(const unsigned int& i) const;
+
 private:
 	static const std::string mDefaultVertexShader;
 
@@ -361,7 +442,8 @@ private:
 	ZoomBox *mZoomBox;
 	PlotCursor *mLeftCursor;
 	PlotCursor *mRightCursor;
-	Legend *mLegend;
+	Legend *mLegend = nullptr;
+	Legend *mHoverLegend = nullptr;
 
 	bool mDraggingLeftCursor = false;
 	bool mDraggingRightCursor = false;
@@ -383,6 +465,36 @@ private:
 	void PanBottomXAxis(wxMouseEvent &event);
 	void PanLeftYAxis(wxMouseEvent &event);
 	void PanRightYAxis(wxMouseEvent &event);
+	static void ShiftLogarithmicLimits(double& min, double& max,
+		const int& pixelDelta, const int& pixels);
+
+	void UpdatePlot();
+	void ProcessPendingUpdates() override;
+	void OnRenderSizeChange() override;
+
+	void UseStaticCurveQuality();
+	void UseDragCurveQuality();
+	void UpdateAdaptiveCurveQuality();
+	void ApplyAdaptiveCurveQuality();
+
+	bool mDragging = false;
+	unsigned int mAdaptiveQualityLevel = 0;
+	static const unsigned int mMaxAdaptiveQualityLevel;
+
+	bool mPlotUpdatePending = false;
+
+	// For detecting changes to the x-axis limits
+	double mLastXMin = 0.0;
+	double mLastXMax = 0.0;
+	bool mCursorValuesUpdatePending = false;
+
+	bool mHoverReadout = false;
+	bool mStatisticsOverlay = false;
+	void UpdateStatisticsOverlay();
+	bool mHoverUpdatePending = false;
+	static const unsigned int mHoverRadius;// [pixels]
+	void UpdateHoverReadout();
+	void HideHoverReadout();
 
 	void ProcessPlotAreaDoubleClick(const unsigned int &x);
 	void ProcessOffPlotDoubleClick(const unsigned int &x,
@@ -395,6 +507,7 @@ private:
 
 	std::string GetDefaultVertexShader() const override
 	{ return mDefaultVertexShader; }
+	void AssignDefaultLocations(ShaderInfo& shader) override;
 
 	struct Zoom
 	{
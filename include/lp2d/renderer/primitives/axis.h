@@ -159,6 +159,8 @@ public:
 	/// \returns Value in axis units.
 	double PixelToValue(const int &pixel) const;
 
+	std::string GetTypeName() const override { return "Axis"; }
+
 	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
 protected:
@@ -145,6 +145,8 @@ public:
 	/// \returns True if (\p x, \p y) lies within the legend area.
 	bool IsUnder(const unsigned int &x, const unsigned int &y) const;
 
+	std::string GetTypeName() const override { return "Legend"; }
+
 	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
 protected:
@@ -170,7 +172,7 @@ private:
 	unsigned int mSampleLength = 15;// [pixels]
 	double mTextHeight;// [pixels]
 
-	std::vector<std::pair<double, double>> GetCornerVertices() const;
+	void GetCornerVertices(std::vector<std::pair<double, double>>& points) const;
 
 	void UpdateBoundingBox();
 	unsigned int mHeight;
@@ -182,12 +184,20 @@ private:
 
 	Line mLines;
 
+	// Pieces of the background, border, lines and markers, which are
+	// assembled into a single buffer.  Only the first mBufferCount entries are
+	// in use; the rest are kept to re-use their storage in the next update.
 	std::vector<Primitive::BufferInfo> mBufferVector;
-	Primitive::BufferInfo BuildBackground() const;
+	unsigned int mBufferCount = 0;
+	Primitive::BufferInfo& GetNextBuffer();
+
+	std::vector<std::pair<double, double>> mCornerPoints;
+
+	void BuildBackground(Primitive::BufferInfo& buffer);
 	void BuildMarkers();
 	void BuildLabelStrings();
-	Primitive::BufferInfo AssembleBuffers();
-	std::vector<std::pair<double, double>> BuildBorderPoints() const;
+	void AssembleBuffers(Primitive::BufferInfo& buffer);
+	void BuildBorderPoints(std::vector<std::pair<double, double>>& points) const;
 	void BuildSampleLines();
 	void ConfigureVertexArray(Primitive::BufferInfo& buffer) const;
 	void RequiresRedraw();
@@ -60,6 +60,8 @@ public:
 	/// Updates the value of where the cursor instersects the axis.
 	void Recalculate();
 
+	std::string GetTypeName() const override { return "PlotCursor"; }
+
 protected:
 	// Mandatory overloads from Primitive - for creating geometry and testing the
 	// validity of this object's parameters
@@ -17,7 +17,7 @@
 // Local headers
 #include "lp2d/renderer/primitives/primitive.h"
 #include "lp2d/utilities/managedList.h"
-#include "lp2d/renderer/line.h"
+#include "lp2d/utilities/spatialIndex.h"
 
 namespace LibPlot2D
 {
@@ -25,8 +25,16 @@ namespace LibPlot2D
 // Local forward declarations
 class Axis;
 class Dataset2D;
-
-/// Object for rendering a Dataset2D.
+class PlotCurveBatch;
+
+/// Object for rendering a Dataset2D.  The curve buffers the (unscaled) data,
+/// but the drawing is done by the PlotCurveBatch to which the curve is
+/// assigned.  Axis limits and logarithmic scaling are applied in the shaders,
+/// so the buffered data only needs to be rebuilt when the data itself changes.
+/// The exception is data with unsorted x-values (i.e. one channel plotted
+/// against another) drawn with markers only; these curves are indexed with a
+/// SpatialIndex and only one point per pixel within the visible area is
+/// buffered, so the buffer is rebuilt when the axis limits change.
 class PlotCurve : public Primitive
 {
 public:
@@ -58,7 +66,15 @@ public:
 	///
 	/// \param pretty Set to true to use the rendering algorithm with better
 	///               anti-aliasing.
-	inline void SetPretty(const bool &pretty) { mPretty = pretty; mLine.SetPretty(pretty); mModified = true; }
+	inline void SetPretty(const bool &pretty) { mPretty = pretty; }
+
+	/// Sets the factor by which the number of rendered points is reduced.
+	/// Decimation preserves the minimum and maximum values within each group
+	/// of points, so peaks remain visible.
+	///
+	/// \param factor Decimation factor (1 to render all points).
+	inline void SetDecimation(const unsigned int &factor)
+	{ if (factor != mDecimation) { mDecimation = factor; mModified = true; } }
 
 	/// Binds the curve to the specified x-axis.
 	///
@@ -74,6 +90,41 @@ public:
 	/// \returns The associated y-axis.
 	inline Axis* GetYAxis() { return mYAxis; }
 
+	/// Assigns this curve to a batch.  Curves build their vertex data but do
+	/// not upload or draw it; the batch does that for all of its curves at
+	/// once.
+	///
+	/// \param batch Batch responsible for drawing this curve.
+	inline void SetBatch(PlotCurveBatch* batch) { mBatch = batch; }
+
+	/// Flags the data associated with this curve as modified.
+	inline void SetDataModified() { mDataModified = true; mModified = true; }
+
+	/// Flags the data associated with this curve as extended (with no other
+	/// changes).  Unless something else requires the vertex data to be
+	/// rebuilt, only vertices for the new points are added (and uploaded).
+	///
+	/// \param count Number of points appended to the data.
+	void SetDataAppended(const unsigned int& count);
+
+	/// Notifies this curve that the axis limits or the plot area changed.
+	/// Only curves that buffer the visible points are affected.
+	inline void SetLimitsModified() { if (UsesScreenSpaceDecimation()) mModified = true; }
+
+	/// Finds the point closest to the specified location.  Distances are
+	/// normalized by the search ranges, so the ranges can be chosen to
+	/// correspond to equal numbers of pixels in each direction.
+	///
+	/// \param x           X-value of the location.
+	/// \param y           Y-value of the location.
+	/// \param xRange      Maximum distance to search in the x-direction.
+	/// \param yRange      Maximum distance to search in the y-direction.
+	/// \param index [out] Index of the closest point.
+	///
+	/// \returns True if a point was found within the search ranges.
+	bool FindNearestPoint(const double& x, const double& y,
+		const double& xRange, const double& yRange, unsigned int& index) const;
+
 	/// Assignment operator overload.
 	///
 	/// \param plotCurve Curve to assign to this.
@@ -85,6 +136,12 @@ public:
 	/// \returns True if markers should be drawn.
 	bool NeedsMarkersDrawn() const;
 
+	/// Checks to see if the x-values of this curve's data are sorted.
+	/// \returns False for XY data with unsorted x-values.
+	bool HasSortedX() const;
+
+	std::string GetTypeName() const override { return "PlotCurve"; }
+
 protected:
 	// Mandatory overloads from Primitive - for creating geometry and testing the
 	// validity of this object's parameters
@@ -93,21 +150,57 @@ protected:
 	void GenerateGeometry() override;
 
 private:
+	friend PlotCurveBatch;
+
+	static const double mLineSizeScale;
+	static const unsigned int mMaximumSearchCount;
+
 	// The axes with which this object is associated
 	Axis *mXAxis = nullptr;
 	Axis *mYAxis = nullptr;
 
+	PlotCurveBatch* mBatch = nullptr;
+
+	bool IsDrawable() { return mIsVisible && HasValidParameters(); }
+
 	const Dataset2D& mData;
 
-	Line mLine;
+	// Only built for data with unsorted x-values
+	SpatialIndex mSpatialIndex;
+	bool mDataModified = true;
+	bool mIsXY = false;
+
+	// Points appended since the vertex data was built
+	unsigned int mAppendedCount = 0;
+	bool mReceivesAppends = false;// Buffered with room to grow
+
+	// Number of vertices at the start of the vertex data which have not
+	// changed since they were copied by the batch
+	unsigned int mBatchedVertexCount = 0;
+
+	// Stored separately from the positions (in mBufferInfo[0]), so both
+	// can be extended when points are appended
+	std::vector<float> mVertexColors;
 
 	bool mPretty = true;
+	unsigned int mDecimation = 1;
 	double mLineSize = 1.0;
 	double mMarkerSize = -1.0;
 
 	bool PointIsValid(const unsigned int &i) const;
 
-	void BuildMarkers();
+	inline bool UsesScreenSpaceDecimation() const { return mIsXY && mLineSize <= 0.0; }
+	void DecimateToPixels(std::vector<double>& xOut,
+		std::vector<double>& yOut) const;
+	void GetPlotAreaSize(int& width, int& height) const;
+
+	void BuildVertices(const std::vector<double>& x,
+		const std::vector<double>& y);
+	bool CanAppendVertices() const;
+	void AppendVertices(const std::vector<double>& x,
+		const std::vector<double>& y);
+	void SetVertices(const unsigned int& first, const std::vector<double>& x,
+		const std::vector<double>& y);
 
 	enum class RangeSize
 	{
@@ -119,13 +212,11 @@ private:
 	bool RangeIsSmall() const;
 	RangeSize XRangeIsSmall() const;
 	RangeSize YRangeIsSmall() const;
+	bool XYRangeIsSmall() const;
 
-	double mXScale;
-	double mYScale;
-
-	void InitializeMarkerVertexBuffer();
-	static std::vector<double> DoLogarithmicScale(
-		const std::vector<double>& values);
+	static void Decimate(const std::vector<double>& x,
+		const std::vector<double>& y, const unsigned int& factor,
+		std::vector<double>& xOut, std::vector<double>& yOut);
 };
 
 }// namespace LibPlot2D
@@ -0,0 +1,147 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  plotCurveBatch.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Derived from Primitive for rendering many plot curves with a small
+//        number of draw calls.
+
+#ifndef PLOT_CURVE_BATCH_H_
+#define PLOT_CURVE_BATCH_H_
+
+// Local headers
+#include "lp2d/renderer/primitives/primitive.h"
+#include "lp2d/renderer/plotRenderer.h"
+#include "lp2d/renderer/densityMap.h"
+
+// Standard C++ headers
+#include <vector>
+#include <string>
+
+namespace LibPlot2D
+{
+
+// Local forward declarations
+class PlotCurve;
+
+/// Object for rendering all of the curves associated with one y-axis.  The
+/// curves build their (unscaled) vertex data, and this object packs the data
+/// for all curves into a single region of the context's curve buffer (see
+/// RenderWindow::GetCurveBufferPool()) which is drawn with one multi-draw call
+/// each for lines and markers.  Logarithmic scaling is applied in the vertex
+/// shader and the lines and markers are expanded to their on-screen size in a
+/// geometry shader, so the buffer does not change when the axes are zoomed,
+/// panned or switched between linear and logarithmic scaling.  Colors are
+/// stored per-vertex, so no per-draw state is required.
+class PlotCurveBatch : public Primitive
+{
+public:
+	/// Constructor.
+	///
+	/// \param renderer  The window that owns this primitive.
+	/// \param modelview The modelview matrix associated with the y-axis to
+	///                  which the curves are bound.
+	PlotCurveBatch(PlotRenderer& renderer,
+		const PlotRenderer::Modelview& modelview);
+
+	~PlotCurveBatch();
+
+	/// Sets the list of curves to be rendered by this object.  Curves are
+	/// rendered in the order in which they appear in the list.  Setting the
+	/// same list again does not cause the buffer to be re-filled.
+	///
+	/// \param curves List of curves.
+	void SetCurves(const std::vector<PlotCurve*>& curves);
+
+	/// Removes the specified curve from this object (i.e. prior to deletion).
+	///
+	/// \param curve Curve to remove.
+	void RemoveCurve(PlotCurve* curve);
+
+	/// Flags the vertex data of the curves as modified, so the buffer is
+	/// re-filled prior to the next render.
+	inline void SetGeometryModified() { mGeometryModified = true; mModified = true; }
+
+	/// Enables or disables density rendering.  In density mode, the lines of
+	/// all curves are drawn one pixel wide into an offscreen buffer that
+	/// counts the number of hits for each pixel, and the counts are displayed
+	/// through a color map.  Markers are not drawn in density mode.
+	///
+	/// \param density True to enable density rendering.
+	inline void SetDensityMode(const bool& density) { mDensityMode = density; mModified = true; }
+
+	/// Checks to see if density rendering is enabled.
+	/// \returns True if density rendering is enabled.
+	inline bool GetDensityMode() const { return mDensityMode; }
+
+	std::string GetTypeName() const override { return "PlotCurveBatch"; }
+
+protected:
+	bool HasValidParameters() override;
+	void Update(const unsigned int& i) override;
+	void GenerateGeometry() override;
+
+private:
+	static const std::string mVertexShader;
+	static const std::string mGeometryShader;
+	static const std::string mFragmentShader;
+
+	static const std::string mModeName;
+	static const std::string mSizeName;
+
+	GLuint DoGLInitialization();
+	friend RenderWindow;
+
+	PlotRenderer& mRenderer;
+	const PlotRenderer::Modelview mModelview;
+
+	std::vector<PlotCurve*> mCurves;
+	bool mGeometryModified = true;
+
+	// Location of our region within the curve buffer (negative if we have no
+	// region); the region moves if the buffer is re-allocated
+	GLint mRegionFirst = -1;
+
+	// Location of each curve's data within our region (negative for curves
+	// which are not buffered) and the number of vertices reserved for it
+	// (curves which receive appended points are given room to grow)
+	std::vector<GLint> mFirstVertices;
+	std::vector<GLsizei> mCurveCapacities;
+
+	// Draw parameters for groups of curves; the size is either the line width
+	// or the half-size of the markers, in pixels
+	struct DrawList
+	{
+		std::vector<GLint> firsts;
+		std::vector<GLsizei> counts;
+		std::vector<float> sizes;
+
+		void Clear();
+		void Add(const GLint& first, const GLsizei& count, const float& size);
+	};
+
+	DrawList mPrettyLines;// Drawn with triangles by the geometry shader
+	DrawList mUglyLines;// Drawn with OpenGL lines
+	DrawList mMarkers;
+	DrawList mDensityLines;// All lines, including repeated end points
+
+	bool mDensityMode = false;
+	DensityMap mDensityMap;
+
+	void BuildVertexBuffer();
+	bool UploadAppendedVertices();
+	void BuildDrawLists();
+
+	static void DrawGroups(const GLenum& mode, const DrawList& list,
+		const GLint& sizeLocation);
+};
+
+}// namespace LibPlot2D
+
+#endif// PLOT_CURVE_BATCH_H_
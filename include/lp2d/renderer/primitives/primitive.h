@@ -18,6 +18,7 @@
 #include <vector>
 #include <memory>
 #include <limits>
+#include <string>
 
 // Local headers
 #include "lp2d/renderer/color.h"
@@ -75,12 +76,31 @@ public:
 	void SetDrawOrder(const unsigned int &drawOrder);
 	inline void SetModified() { mModified = true; }///< Forces a full re-draw.
 
+	/// Sets a flag indicating whether or not this object is drawn on top of
+	/// the cached static layer (see RenderWindow::SetCacheStaticLayer()).
+	/// Overlay objects are re-drawn every frame, but changes to them do not
+	/// invalidate the cached image of the rest of the scene.
+	///
+	/// \param isOverlay True if this object should be treated as an overlay.
+	void SetIsOverlay(const bool &isOverlay);
+
 	inline Color GetColor() const { return mColor; }
 	inline bool GetIsVisible() const { return mIsVisible; }
 	inline unsigned int GetDrawOrder() const { return mDrawOrder; }
+	inline bool GetIsOverlay() const { return mIsOverlay; }
 
 	/// @}
 
+	/// Checks to see if the next call to Draw() would produce a different
+	/// image than the last call to Draw().
+	/// \returns True if this object needs to be re-drawn.
+	bool NeedsRedraw();
+
+	/// Gets a name describing the type of this object (used to group objects
+	/// in the render statistics).
+	/// \returns The name of this object's type.
+	virtual std::string GetTypeName() const { return "Primitive"; }
+
 	/// \name Overloaded operators
 	/// @{
 
@@ -180,6 +200,8 @@ protected:
 
 private:
 	unsigned int mDrawOrder = 1000;
+	bool mIsOverlay = false;
+	bool mWasDrawn = false;
 };
 
 }// namespace LibPlot2D
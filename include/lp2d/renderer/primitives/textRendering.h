@@ -76,6 +76,8 @@ public:
 
 	/// @}
 
+	std::string GetTypeName() const override { return "TextRendering"; }
+
 	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
 protected:
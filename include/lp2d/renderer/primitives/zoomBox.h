@@ -54,6 +54,8 @@ public:
 
 	/// @}
 
+	std::string GetTypeName() const override { return "ZoomBox"; }
+
 protected:
 	// Mandatory overloads from Primitive - for creating geometry and testing the
 	// validity of this object's parameters
@@ -68,6 +70,7 @@ private:
 	unsigned int mYFloat = 0;
 
 	Line box;
+	std::vector<std::pair<double, double>> mPoints;// Re-used between updates
 };
 
 }// namespace LibPlot2D
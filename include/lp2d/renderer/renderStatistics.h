@@ -0,0 +1,119 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  renderStatistics.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Performance counters collected while rendering a frame.
+
+#ifndef RENDER_STATISTICS_H_
+#define RENDER_STATISTICS_H_
+
+// Standard C++ headers
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace LibPlot2D
+{
+
+/// Performance counters for a single frame (see
+/// RenderWindow::SetCollectStatistics()).  Times are measured on the CPU, so
+/// they describe the cost of preparing and submitting work to the GPU; time
+/// spent by the GPU executing the commands is only reflected in the frame
+/// time to the extent that the driver blocks.
+struct RenderStatistics
+{
+	/// Reasons for a primitive to update its buffers.
+	enum class RebuildReason
+	{
+		Modified,///< A property or the underlying data changed.
+		VertexCountChanged///< The size of a buffer changed.
+	};
+
+	/// Counters accumulated for all primitives of one type.
+	struct PrimitiveTypeStatistics
+	{
+		unsigned int drawCount = 0;///< Number of objects drawn.
+		unsigned int rebuildCount = 0;///< Number of objects rebuilt.
+		double updateTime = 0.0;///< Time spent in Primitive::Update() [sec].
+		double generateTime = 0.0;///< Time spent in Primitive::GenerateGeometry() [sec].
+	};
+
+	/// Record of a primitive which updated its buffers.
+	struct Rebuild
+	{
+		std::string primitiveType;///< Type of the rebuilt primitive.
+		RebuildReason reason;///< Reason for the rebuild.
+		unsigned int bufferCount;///< Number of buffers updated.
+	};
+
+	unsigned long frameNumber = 0;///< Sequential frame number.
+
+	/// Time from the start of the paint event (including deferred updates)
+	/// to the buffer swap [sec].
+	double frameTime = 0.0;
+
+	/// Portion of the frame time spent drawing the scene [sec].
+	double drawTime = 0.0;
+
+	/// True if the frame time exceeded the frame time budget.
+	bool overBudget = false;
+
+	unsigned int drawCalls = 0;///< Number of OpenGL draw calls issued.
+	unsigned long long uploadedVertices = 0;///< Number of vertices sent to the GPU.
+	unsigned long long uploadedBytes = 0;///< Amount of vertex and index data sent to the GPU [bytes].
+
+	/// Counters for each type of primitive drawn during the frame.
+	std::map<std::string, PrimitiveTypeStatistics> primitiveTypes;
+
+	/// Primitives which updated their buffers during the frame.
+	std::vector<Rebuild> rebuilds;
+
+	/// Clears all counters (the frame number is not changed).
+	void Reset();
+
+	/// Adds the timing and rebuild information for one primitive.
+	///
+	/// \param type         Type of the primitive.
+	/// \param bufferCount  Number of buffers updated (zero if not rebuilt).
+	/// \param reason       Reason for the rebuild (ignored if not rebuilt).
+	/// \param updateTime   Time spent updating buffers [sec].
+	/// \param generateTime Time spent generating geometry [sec].
+	void AddPrimitive(const std::string& type, const unsigned int& bufferCount,
+		const RebuildReason& reason, const double& updateTime,
+		const double& generateTime);
+
+	/// Creates a short, single-line description of the frame.
+	/// \returns The description.
+	std::string GetSummary() const;
+
+	/// Writes the column headings for a CSV trace (see WriteTrace()).
+	///
+	/// \param stream Stream to which the headings are written.
+	static void WriteTraceHeader(std::ostream& stream);
+
+	/// Writes the frame to a CSV trace.  One row is written for each type of
+	/// primitive, with the frame-level counters repeated on each row.
+	///
+	/// \param stream Stream to which the rows are written.
+	void WriteTrace(std::ostream& stream) const;
+
+	/// Gets a name for the specified rebuild reason.
+	///
+	/// \param reason Reason to describe.
+	///
+	/// \returns The name of the reason.
+	static std::string GetReasonName(const RebuildReason& reason);
+};
+
+}// namespace LibPlot2D
+
+#endif// RENDER_STATISTICS_H_
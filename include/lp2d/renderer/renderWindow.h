@@ -21,6 +21,8 @@
 // Local headers
 #include "lp2d/utilities/managedList.h"
 #include "lp2d/renderer/primitives/primitive.h"
+#include "lp2d/renderer/renderStatistics.h"
+#include "lp2d/renderer/curveBufferPool.h"
 
 // Eigen headers
 #include <Eigen/Eigen>
@@ -31,9 +33,15 @@
 
 // Standard C++ headers
 #include <memory>
+#include <vector>
 #include <unordered_map>
 #include <typeindex>
 #include <mutex>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <deque>
+#include <fstream>
 
 /// Custom event to know when a scene has been rendered.
 ///
@@ -188,17 +196,123 @@ public:
 	/// \returns True if an error exists.
 	static bool GLHasError();
 
-	/// Writes the current image to file.
+	/// Writes the current image to file.  Blocks until the pixels have been
+	/// read back and the file has been encoded; see WriteImageToFileAsync().
 	///
 	/// \param pathAndFileName Location to write the file.
 	///
 	/// \returns True if the file was successfully written.
 	bool WriteImageToFile(wxString pathAndFileName) const;
 
-	/// Gets an image of the current rendered scene.
+	/// Gets an image of the current rendered scene.  Blocks until the pixels
+	/// have been read back; see RequestCapture().
 	/// \returns An image object representing the current scene.
 	virtual wxImage GetImage() const;
 
+	/// Function called when a capture requested with RequestCapture() is
+	/// complete.  The pixels are RGB, one byte per channel, starting with the
+	/// top row, and were allocated with malloc().  The callback takes
+	/// ownership of the pixels (they may be passed directly to a wxImage).
+	/// The pixels are nullptr if the capture failed.
+	typedef std::function<void(unsigned char* pixels, const int& width,
+		const int& height)> CaptureCallback;
+
+	/// Starts an asynchronous read of the current rendered scene.  The copy
+	/// is made into a pixel buffer object, so this returns without waiting
+	/// for the GPU.  The callback is invoked on the GUI thread once the copy
+	/// is complete (usually during the next idle event).
+	///
+	/// \param callback Function to receive the pixels.
+	void RequestCapture(CaptureCallback callback);
+
+	/// Writes the current image to file without blocking.  The pixels are
+	/// read back asynchronously and the file is encoded on a worker thread.
+	///
+	/// \param pathAndFileName Location to write the file.
+	void WriteImageToFileAsync(const wxString& pathAndFileName);
+
+	/// Writes an image of the specified size to file without blocking.  The
+	/// scene is laid out for the requested size and rendered offscreen (see
+	/// RenderOffscreen()), so the size is not limited by the window size and
+	/// the window itself is not affected.  The file is encoded on a worker
+	/// thread.
+	///
+	/// \param pathAndFileName Location to write the file.
+	/// \param width           Width of the image [pixels].
+	/// \param height          Height of the image [pixels].
+	///
+	/// \returns True if the image was rendered successfully.
+	bool WriteImageToFileAsync(const wxString& pathAndFileName,
+		const int& width, const int& height);
+
+	/// Waits for all captures and image writes started by this object to
+	/// complete.
+	/// \returns True if all image writes since the last call succeeded.
+	bool FinishImageWrites();
+
+	/// Function called as each tile of an offscreen rendering is completed.
+	/// The pixels are RGB, one byte per channel, starting with the bottom
+	/// row, and are only valid for the duration of the call.  The position
+	/// of the tile is measured from the lower left corner of the image.
+	typedef std::function<void(const unsigned char* pixels, const int& x,
+		const int& y, const int& width, const int& height)> TileCallback;
+
+	/// Renders the scene at the specified size into an offscreen framebuffer.
+	/// Images larger than the maximum framebuffer size are rendered in tiles,
+	/// so only one tile needs to be held in memory at a time.  While
+	/// rendering, GetRenderSize() returns the requested size, so the scene is
+	/// laid out as if the window were that size.  Blocks until complete.
+	///
+	/// \param width    Width of the image [pixels].
+	/// \param height   Height of the image [pixels].
+	/// \param callback Function to receive each tile.
+	///
+	/// \returns True if the image was rendered successfully.
+	bool RenderOffscreen(const int& width, const int& height,
+		TileCallback callback);
+
+	/// Gets the size of the image being rendered.  This is the size of the
+	/// window, except during RenderOffscreen().  Layout computations should
+	/// use this instead of GetSize().
+	/// \returns The size of the rendered image [pixels].
+	wxSize GetRenderSize() const
+	{ return mRenderingOffscreen ? mOffscreenSize : GetSize(); }
+
+	/// Checks to see if the scene is being rendered by RenderOffscreen().
+	/// \returns True if rendering offscreen.
+	inline bool IsRenderingOffscreen() const { return mRenderingOffscreen; }
+
+	/// Checks to see if the tile being drawn is the first (lower left) tile
+	/// of an offscreen rendering.  The viewport for the first tile covers the
+	/// entire image, so values that must be consistent across tiles (i.e.
+	/// image-wide maximums) should be computed while drawing it and re-used
+	/// for the remaining tiles.  Always true when drawing on-screen.
+	/// \returns True if drawing the first tile.
+	inline bool IsRenderingFirstTile() const
+	{ return mTileOffset[0] == 0 && mTileOffset[1] == 0; }
+
+	/// Sets the scissor box.  Should be used instead of glScissor(), so the
+	/// box is correctly positioned on each tile of offscreen renderings.
+	///
+	/// \param x      Left edge of the box [pixels].
+	/// \param y      Bottom edge of the box [pixels].
+	/// \param width  Width of the box [pixels].
+	/// \param height Height of the box [pixels].
+	void SetScissorBox(const int& x, const int& y, const int& width,
+		const int& height);
+
+	/// Uses the OpenGL context of another window instead of creating a new
+	/// one.  Windows sharing a context use a single set of context objects
+	/// (vertex arrays and framebuffers, in addition to the textures and
+	/// buffers that are shared between all contexts), a single set of shader
+	/// programs and a single curve buffer (see GetCurveBufferPool()), and
+	/// avoid the cost of switching between contexts.  The windows must be of
+	/// the same type and created with the same attributes, and this must be
+	/// called before this window is first drawn.
+	///
+	/// \param window Window whose context is to be used.
+	void ShareContext(RenderWindow& window);
+
 	/// Determines if a particular primitive is in the scene owned by this
 	/// object.
 	///
@@ -215,6 +329,21 @@ public:
 	/// prior to rendering.
 	void SetNeedOrderSort() { mNeedOrderSort = true; }
 
+	/// Enables or disables caching of the static layer.  When enabled, all
+	/// primitives that are not overlays are rendered into an offscreen
+	/// texture, which is re-used until one of those primitives changes.
+	/// Overlay primitives are drawn on top of the cached image every frame.
+	/// Only used for single-viewport 2D scenes.
+	///
+	/// \param cache True to enable caching of the static layer.
+	void SetCacheStaticLayer(const bool& cache)
+	{ mCacheStaticLayer = cache; mStaticLayerValid = false; }
+
+	/// Forces the static layer to be re-drawn on the next render.  Required
+	/// when state that is not owned by a primitive (i.e. uniforms loaded by
+	/// derived classes) changes.
+	void InvalidateStaticLayer() { mStaticLayerValid = false; }
+
 	/// Compiles the specified shader.
 	///
 	/// \param type           Type of shader to build.
@@ -226,10 +355,39 @@ public:
 
 	/// Creates the program using the specified shaders.
 	///
-	/// \param shaderList List of shaders to include in the program.
+	/// \param shaderList        List of shaders to include in the program.
+	/// \param retrievableBinary Flag indicating whether or not the program
+	///                          binary will be requested after linking.
+	///
+	/// \returns Index for the program.
+	static GLuint CreateProgram(const std::vector<GLuint>& shaderList,
+		const bool& retrievableBinary = false);
+
+	/// Structure describing a single shader for CreateCachedProgram().
+	struct ShaderSource
+	{
+		GLenum type;///< Type of shader (i.e. GL_VERTEX_SHADER).
+		std::string contents;///< Shader instructions.
+	};
+
+	/// Creates a program from the specified shader sources.  If the driver
+	/// supports program binaries, the linked program is saved to disk (keyed
+	/// by the driver vendor, renderer and version and by the shader sources)
+	/// and subsequent calls load the binary instead of compiling.  Falls back
+	/// to compiling if the binary can't be loaded.
+	///
+	/// \param sources List of shaders to include in the program.
 	///
 	/// \returns Index for the program.
-	static GLuint CreateProgram(const std::vector<GLuint>& shaderList);
+	static GLuint CreateCachedProgram(const std::vector<ShaderSource>& sources);
+
+	/// Sets the directory in which program binaries are stored.  If empty
+	/// (the default), a directory within the user's local data directory is
+	/// used.
+	///
+	/// \param directory Path to the cache directory.
+	static void SetProgramCacheDirectory(const wxString& directory)
+	{ mProgramCacheDirectory = directory; }
 
 	/// Applies a small shift to the modelview matrix to enable exact
 	/// pixelization.
@@ -251,6 +409,13 @@ public:
 	/// \returns The dimension of a vertex in the default program.
 	virtual unsigned int GetVertexDimension() const { return 4; }
 
+	/// Gets the buffer holding curve data for all windows using this
+	/// object's context.
+	/// \returns The curve buffer, or nullptr if OpenGL has not been
+	///          initialized.
+	CurveBufferPool* GetCurveBufferPool() const
+	{ return mContextResources->curveBufferPool.get(); }
+
 	/// \name Matrix manipulation methods
 	/// @{
 
@@ -281,15 +446,15 @@ public:
 
 	/// Gets information about the active GL program.
 	/// \returns Information for the active GL program.
-	const ShaderInfo& GetActiveProgramInfo() const { return mShaders[mActiveProgram]; }
+	const ShaderInfo& GetActiveProgramInfo() const { return mContextResources->shaders[mActiveProgram]; }
 
 	/// Gets information about the default GL program.
 	/// \returns Information for the default GL program.
-	const ShaderInfo& GetDefaultProgramInfo() const { return mShaders.front(); }
+	const ShaderInfo& GetDefaultProgramInfo() const { return mContextResources->shaders.front(); }
 
 	/// Gets information about the specified GL program.
 	/// \returns Information for the specified GL program.
-	const ShaderInfo& GetProgramInfo(const GLuint& program) const { return mShaders[program]; }
+	const ShaderInfo& GetProgramInfo(const GLuint& program) const { return mContextResources->shaders[program]; }
 
 	/// Adds the specified shader to our list of programs.
 	///
@@ -355,6 +520,80 @@ public:
 	/// Makes the GL context associated with this object current.
 	void MakeCurrent();
 
+	/// Gets the time required to process the most recent paint event,
+	/// including any deferred updates (see ProcessPendingUpdates()).  This is
+	/// the larger of the CPU time and the GPU time (measured with a timer
+	/// query).  The GPU time is read back one or two frames late to avoid
+	/// waiting for the GPU, so it describes a slightly older frame.  Time
+	/// spent waiting for the buffer swap (i.e. for vertical sync) is excluded.
+	/// \returns The duration of the most recent frame [sec].
+	double GetLastFrameTime() const { return mLastFrameTime; }
+
+	/// \name Instrumentation
+	/// @{
+
+	/// Sets a flag indicating whether or not performance counters should be
+	/// collected for each frame.  Collection adds a small amount of overhead,
+	/// so it is disabled by default.
+	///
+	/// \param collect True to collect statistics.
+	void SetCollectStatistics(const bool& collect);
+	inline bool GetCollectStatistics() const { return mCollectStatistics; }
+
+	/// Gets the performance counters for the most recent frame.  Only valid
+	/// when statistics are being collected.
+	/// \returns The statistics for the most recent frame.
+	const RenderStatistics& GetRenderStatistics() const { return mStatistics; }
+
+	/// Sets the frame time budget.  Frames exceeding the budget are flagged
+	/// in the statistics and counted (see GetFramesOverBudget()).  Derived
+	/// classes may also use the budget to adjust the level of detail (see
+	/// PlotRenderer::CurveQuality::Adaptive).
+	///
+	/// \param budget Target time to render a single frame [sec].
+	void SetFrameTimeBudget(const double& budget);
+	inline double GetFrameTimeBudget() const { return mFrameTimeBudget; }
+
+	/// Gets the number of frames which exceeded the frame time budget since
+	/// the budget was set.
+	/// \returns The number of frames over budget.
+	inline unsigned long GetFramesOverBudget() const { return mFramesOverBudget; }
+
+	/// Starts writing the statistics for every frame to a CSV file.  Enables
+	/// collection of statistics.
+	///
+	/// \param pathAndFileName Location of the file to write.
+	///
+	/// \returns True if the file was opened successfully.
+	bool StartStatisticsTrace(const wxString& pathAndFileName);
+
+	/// Stops writing statistics to file (collection of statistics
+	/// continues).
+	void StopStatisticsTrace();
+
+	/// Adds to the draw call count for the frame being rendered (if
+	/// statistics are being collected).  Must be called with the render
+	/// mutex locked.
+	///
+	/// \param count Number of draw calls issued.
+	static void RecordDrawCalls(const unsigned int& count = 1);
+
+	/// Adds to the upload counters for the frame being rendered (if
+	/// statistics are being collected).  Must be called with the render
+	/// mutex locked.
+	///
+	/// \param vertexCount Number of vertices sent to the GPU.
+	/// \param bytes       Amount of data sent to the GPU [bytes].
+	static void RecordUpload(const unsigned int& vertexCount,
+		const std::size_t& bytes);
+
+	/// Gets the statistics for the frame being rendered.
+	/// \returns Pointer to the statistics, or nullptr if statistics are not
+	///          being collected.
+	static RenderStatistics* GetActiveStatistics() { return mActiveStatistics; }
+
+	/// @}
+
 	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
 protected:
@@ -364,6 +603,16 @@ protected:
 
 	virtual void UpdateUniformWithModelView() {};///< Method for derived classes to implement required uniform updates when the model view matrix changes.
 
+	/// Method for derived classes to apply deferred changes to the scene.
+	/// Called immediately before rendering in response to a paint event, so
+	/// any number of requests made between two frames are processed once.
+	virtual void ProcessPendingUpdates() {}
+
+	/// Method for derived classes to update the scene layout when the value
+	/// returned by GetRenderSize() changes without the window being resized
+	/// (i.e. at the start and end of RenderOffscreen()).
+	virtual void OnRenderSizeChange() {}
+
 	ManagedList<Primitive> mPrimitiveList;///< List of objects to be rendered.
 
 	GLuint mActiveProgram = 0;
@@ -446,7 +695,19 @@ protected:
 	
 	double mPanFactor = 0.15;///< Scale factor for 3D pan events.
 
-	std::vector<ShaderInfo> mShaders;///< List of available shader programs.
+	/// Objects which belong to the context (and are therefore shared between
+	/// windows sharing the context).
+	struct ContextResources
+	{
+		std::vector<ShaderInfo> shaders;///< List of available shader programs.
+
+		std::unordered_map<std::type_index, bool> typeInitializedMap;
+		std::unordered_map<std::type_index, GLuint> typeProgramMap;
+
+		std::unique_ptr<CurveBufferPool> curveBufferPool;
+	};
+
+	std::shared_ptr<ContextResources> mContextResources;
 
 	/// Gets the default vertex shader for this object.
 	/// \returns Default vertex shader.
@@ -490,9 +751,16 @@ protected:
 	DECLARE_EVENT_TABLE()
 
 private:
-	std::unique_ptr<wxGLContext> mContext;
+	std::shared_ptr<wxGLContext> mContext;
 	wxGLContext* GetContext();
 
+	// Windows sharing a context must restore its state when they draw
+	bool mContextShared = false;
+	static const RenderWindow* mLastDrawnWindow;
+
+	// All contexts share textures (i.e. the font cache) and buffers
+	static std::vector<const wxGLContext*> mContextList;
+
 	static const double mExactPixelShift;
 
 	// Flags describing the options for this object's functionality
@@ -501,6 +769,28 @@ private:
 
 	bool mRenderedEvent = false;
 
+	std::chrono::steady_clock::time_point mFrameStartTime;
+	double mLastFrameTime = 0.0;// [sec]
+
+	// GPU time is measured with GL_TIME_ELAPSED queries; several are used in
+	// turn so results can be read without stalling the pipeline
+	static const unsigned int mTimerQueryCount = 3;
+	GLuint mTimerQueries[mTimerQueryCount] = {};
+	bool mTimerQueryPending[mTimerQueryCount] = {};
+	unsigned int mNextTimerQuery = 0;
+	double mLastGPUFrameTime = 0.0;// [sec]
+	void ReadTimerQueries();
+
+	// Instrumentation
+	bool mCollectStatistics = false;
+	RenderStatistics mStatistics;
+	double mFrameTimeBudget = 1.0 / 30.0;// [sec]
+	unsigned long mFramesOverBudget = 0;
+	std::ofstream mStatisticsTrace;
+	static RenderStatistics* mActiveStatistics;
+	void FinishStatistics(
+		const std::chrono::steady_clock::time_point& drawStartTime);
+
 	// The parameters that describe the viewing frustum
 	double mTopMinusBottom = 100.0;// in model-space units
 	double mAspectRatio;
@@ -520,6 +810,53 @@ private:
 	bool mNeedAlphaSort = true;
 	bool mNeedOrderSort = true;
 
+	// Offscreen cache for non-overlay primitives
+	bool mCacheStaticLayer = false;
+	bool mStaticLayerValid = false;
+	int mStaticLayerWidth = 0;
+	int mStaticLayerHeight = 0;
+	GLuint mStaticLayerFramebuffer = 0;
+	GLuint mStaticLayerTexture = 0;
+	GLuint mStaticLayerProgram = 0;
+	GLuint mStaticLayerVertexArray = 0;
+	GLuint mStaticLayerVertexBuffer = 0;
+
+	static const std::string mStaticLayerVertexShader;
+	static const std::string mStaticLayerFragmentShader;
+
+	void DrawWithStaticLayer(bool updateStaticLayer);
+	bool PrepareStaticLayer();
+	void CompositeStaticLayer();
+	void FreeStaticLayer();
+
+	// Asynchronous readback and image encoding
+	static const unsigned int mMaximumPendingCaptures;
+
+	struct PendingCapture;
+	std::deque<std::unique_ptr<PendingCapture>> mPendingCaptures;
+	void ProcessCaptures(const bool& wait);
+
+	std::vector<std::future<bool>> mImageWriters;
+	bool mImageWriteFailed = false;
+	void StartImageWriter(unsigned char* pixels, const int& width,
+		const int& height, const wxString& pathAndFileName);
+	void CollectImageWriters(const bool& wait);
+
+	// Offscreen (tiled) rendering
+	static const int mMaximumTileSize;// [pixels]
+	static const int mOffscreenSamples;
+
+	bool mRenderingOffscreen = false;
+	wxSize mOffscreenSize;
+	int mTileOffset[2] = { 0, 0 };// [pixels]
+
+	bool mScissorBoxSet = false;
+	int mScissorBox[4];
+	void ApplyScissorBox() const;
+
+	bool InitializeOpenGL();
+	void DrawScene(const bool& cacheStaticLayer, const bool& staticLayerDirty);
+
 	// Event handlers-----------------------------------------------------
 	// Interactor events
 	virtual void OnMouseWheelEvent(wxMouseEvent &event);
@@ -531,6 +868,7 @@ private:
 	void OnPaint(wxPaintEvent& event);
 	void OnSize(wxSizeEvent& event);
 	void OnEnterWindow(wxMouseEvent &event);
+	void OnIdle(wxIdleEvent& event);
 	// End event handlers-------------------------------------------------
 
 	void Render();
@@ -556,15 +894,19 @@ private:
 
 	void BuildShaders();
 
+	static wxString mProgramCacheDirectory;
+	static wxString GetProgramCacheFileName(
+		const std::vector<ShaderSource>& sources);
+	static GLuint LoadProgramBinary(const wxString& fileName);
+	static void SaveProgramBinary(const GLuint& program,
+		const wxString& fileName);
+
 	Eigen::Vector3d mFocalPoint;
 
 	bool mGlewInitialized = false;
 
 	static void GetGLInfo();
 
-	std::unordered_map<std::type_index, bool> mTypeInitializedMap;
-	std::unordered_map<std::type_index, GLuint> mTypeProgramMap;
-
 	static std::mutex renderMutex;
 };
 
@@ -590,8 +932,8 @@ void RenderWindow::InitializePrimitiveType(T& primitive)
 	if (IsPrimitiveTypeInitialized<T>())
 		return;
 
-	mTypeProgramMap[typeid(T)] = primitive.DoGLInitialization();
-	mTypeInitializedMap[typeid(T)] = true;
+	mContextResources->typeProgramMap[typeid(T)] = primitive.DoGLInitialization();
+	mContextResources->typeInitializedMap[typeid(T)] = true;
 }
 
 //=============================================================================
@@ -613,8 +955,8 @@ void RenderWindow::InitializePrimitiveType(T& primitive)
 template<typename T>
 bool RenderWindow::IsPrimitiveTypeInitialized() const
 {
-	const auto& it(mTypeInitializedMap.find(typeid(T)));
-	if (it == mTypeInitializedMap.end())
+	const auto& it(mContextResources->typeInitializedMap.find(typeid(T)));
+	if (it == mContextResources->typeInitializedMap.end())
 		return false;
 	return it->second;
 }
@@ -638,8 +980,8 @@ bool RenderWindow::IsPrimitiveTypeInitialized() const
 template<typename T>
 GLuint RenderWindow::GetPrimitiveTypeProgram() const
 {
-	const auto& it(mTypeProgramMap.find(typeid(T)));
-	if (it == mTypeProgramMap.end())
+	const auto& it(mContextResources->typeProgramMap.find(typeid(T)));
+	if (it == mContextResources->typeProgramMap.end())
 		return static_cast<GLuint>(-1);
 	return it->second;
 }
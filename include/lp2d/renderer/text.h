@@ -16,18 +16,15 @@
 
 // Local headers
 #include "lp2d/renderer/primitives/primitive.h"
+#include "lp2d/renderer/fontCache.h"
 
 // Eigen headers
 #include <Eigen/Eigen>
 
-// Freetype headers
-#include <ft2build.h>
-#include FT_FREETYPE_H
-
 // Standard C++ headers
 #include <string>
-#include <map>
-#include <limits>
+#include <vector>
+#include <unordered_map>
 
 namespace LibPlot2D
 {
@@ -60,7 +57,10 @@ public:
 	/// \param height Height of the text in pixels.
 	void SetSize(const double& width, const double& height);
 
-	/// Sets the TrueType font file to use for generating glyphs.
+	/// Sets the TrueType font file to use for generating glyphs.  Glyphs are
+	/// shared with all other Text objects using the same font file and size
+	/// (see FontCache).  May be called again to replace the face, in which
+	/// case SetSize() must also be called again.
 	///
 	/// \param fontFileName Path and file name to the font file.
 	///
@@ -84,27 +84,39 @@ public:
 	/// \param y Y-location.
 	inline void SetPosition(const double& x, const double& y) { mX = x; mY = y; }
 
-	/// Sets the scale factor.
+	/// Sets the scale factor.  Changing the scale discards all cached string
+	/// meshes.
 	///
 	/// \param scale Factor to use.
-	inline void SetScale(const double& scale) { assert(scale > 0.0); mScale = scale; }
+	void SetScale(const double& scale);
 
 	/// Sets the string to render.
 	///
 	/// \param text String to render.
 	inline void SetText(const std::string& text) { mText = text; }
 
-	/// Appends text to the existing string contents.
+	/// Adds an instance of the specified string at the current position.  Use
+	/// this instead of SetText() when multiple strings must be rendered at
+	/// different positions.
 	///
-	/// \param text Strint to append.
+	/// \param text String to append.
 	void AppendText(const std::string& text);
 
-	/// Builds a buffer for rendering the associated glyphs.
-	/// \returns A buffer for rendering the associated glyphs.
-	Primitive::BufferInfo BuildText();
-
-	/// Function to render the buffered glyph (i.e. to be called from
-	/// Primitive::GenerateGeometry()).
+	/// Prepares the appended strings (or the string set with SetText() if none
+	/// were appended) for rendering.  Strings are laid out only the first time
+	/// they are seen; the resulting meshes are cached within this object and
+	/// each instance is drawn from the cache at its own offset.
+	///
+	/// \param bufferInfo [out] Buffer describing the number of vertices to
+	///                        render.  The vertex data itself is owned by
+	///                        this object, so the buffer's vectors and OpenGL
+	///                        objects are not used.
+	void BuildText(Primitive::BufferInfo& bufferInfo);
+
+	/// Function to render the buffered glyphs (i.e. to be called from
+	/// Primitive::GenerateGeometry()).  Binds its own vertex array.
+	///
+	/// \param vertexCount Number of vertices set by BuildText().
 	void RenderBufferedGlyph(const unsigned int& vertexCount);
 
 	/// Structure representing bounding box information.
@@ -126,7 +138,7 @@ public:
 	/// Checks to see if this object is ready to render.
 	/// \returns True if this object was successfully initialized and is ready
 	///          to render.
-	bool IsOK() const { return mIsOK && (mGlyphsGenerated || mFace); }
+	bool IsOK() const { return mIsOK && (mAtlas || mFaceLoaded); }
 
 	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
@@ -135,59 +147,71 @@ private:
 	static const std::string mFragmentShader;
 
 	static const std::string mTextColorName;
+	static const std::string mOffsetName;
 	static const std::string mVertexName;
-	static const std::string mTextureIndexName;
 
 	RenderWindow& mRenderer;
 
 	static GLint mVertexLocation;
-	static GLint mIndexLocation;
 
-	static FT_Library mFt;
-	static unsigned int mFtReferenceCount;
+	std::string mFontFileName;
+	bool mFaceLoaded = false;
+	unsigned int mWidth = 0;
+	unsigned int mHeight = 0;
+	const FontCache::Atlas* mAtlas = nullptr;
 
-	FT_Face mFace = nullptr;
 	Color mColor = Color::ColorBlack;
 
 	double mX;
 	double mY;
 	double mScale = 1.0;
 
-	unsigned int mMaxXSize;
-	unsigned int mMaxYSize;
-
 	std::string mText;
 
-	struct Glyph
-	{
-		unsigned int index;
-		int xSize;
-		int ySize;
-		int xBearing;
-		int yBearing;
-		unsigned int advance;
-	};
-
-	std::map<char, Glyph> mGlyphs;
-	unsigned int mTextureId = std::numeric_limits<unsigned int>::max();
-
 	void DoInternalInitialization();
 	GLuint DoGLInitialization();
 	friend RenderWindow;
 
-	bool GenerateGlyphs();
-	bool mGlyphsGenerated = false;
-
-	void Initialize();
-	void FreeFTResources();
 	bool mIsOK = true;
 
 	Eigen::Matrix4d mModelview;
 
-	std::vector<Primitive::BufferInfo> mBufferVector;
-	Primitive::BufferInfo AssembleBuffers();
-	Primitive::BufferInfo BuildLocalText();
-	void ConfigureVertexArray(Primitive::BufferInfo& bufferInfo) const;
+	struct StringMesh
+	{
+		unsigned int firstVertex;
+		unsigned int vertexCount;
+		BoundingBox boundingBox;
+	};
+
+	struct Instance
+	{
+		std::string text;
+		double x;
+		double y;
+	};
+
+	struct DrawItem
+	{
+		unsigned int firstVertex;
+		unsigned int vertexCount;
+		float x;
+		float y;
+	};
+
+	static const unsigned int mMaxCachedStrings = 256;
+
+	std::unordered_map<std::string, StringMesh> mMeshCache;
+	std::vector<float> mMeshVertices;
+	std::vector<Instance> mInstances;
+	std::vector<DrawItem> mDrawList;
+
+	Primitive::BufferInfo mMeshBuffer;
+	unsigned int mUploadedSize = 0;
+	unsigned int mBufferCapacity = 0;
+
+	const StringMesh& GetMesh(const std::string& s);
+	void ClearMeshCache();
+	void UploadMeshes();
 };
 
 }// namespace LibPlot2D
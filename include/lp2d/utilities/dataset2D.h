@@ -85,9 +85,14 @@ public:
 	/// \param exactValue [out] Set to indicate whether or not the returned
 	///                         y-value was interpolated, or if it represents
 	///                         an exact value that is present in the raw data.
+	/// \param sortedX          Indicates that the x-values are known to be
+	///                         sorted, so the point can be located by binary
+	///                         search.  Otherwise, the data is scanned for the
+	///                         first point at or beyond \p x.
 	///
 	/// \returns The new
-	bool GetYAt(const double &x, double &y, bool *exactValue = nullptr) const;// TODO:  Get rid of this (only used in one place in MainFrame::UpdateCursorValues)
+	bool GetYAt(const double &x, double &y, bool *exactValue = nullptr,
+		const bool &sortedX = false) const;// TODO:  Get rid of this (only used in one place in MainFrame::UpdateCursorValues)
 
 	/// Shiftes the x-data in this dataset by the specified amount.
 	///
@@ -21,10 +21,21 @@ class wxString;
 // Local headers
 #include "lp2d/utilities/machineDefinitions.h"
 
+// Standard C++ headers
+#include <string>
+#include <map>
+#include <mutex>
+#include <future>
+#include <atomic>
+
 namespace LibPlot2D
 {
 
-/// Class for finding TrueType font files in a cross-platform way.
+/// Class for finding TrueType font files in a cross-platform way.  Font names
+/// are looked up in an index that is saved to disk and re-used as long as the
+/// modification times of the font directories have not changed.  When the
+/// index is missing or stale, the font directories are scanned in the
+/// background.
 class FontFinder
 {
 public:
@@ -47,7 +58,9 @@ public:
 	static bool GetFontFaceName(wxFontEncoding encoding, const wxArrayString &preferredFonts,
 		const bool &fixedWidth, wxString &fontName);
 
-	/// Gets the file name corresponding to the specified face name.
+	/// Gets the file name corresponding to the specified face name.  If the
+	/// font index is being rebuilt and the font was not found in the previous
+	/// index, this waits for the rebuild to complete.
 	///
 	/// \param fontName Name of the desired font.
 	///
@@ -59,21 +72,28 @@ public:
 	/// fonts.  Using a list of preferred fonts allows calling code to specify
 	/// the names of multiple fonts, some of which may be more likely to exist
 	/// on one platform over another.  Then the path and file name of the
-	/// matching font will be returned.
+	/// matching font will be returned.  If the font index is being rebuilt
+	/// and none of the fonts are in the previous index, a platform-specific
+	/// fallback font is returned instead of waiting for the rebuild.  In that
+	/// case, this returns false and callers should call this again once
+	/// IndexBuildInProgress() returns false.
 	///
-	/// \param encoding       Desired font encoding.
-	/// \param preferredFonts List of preferred font face names.
-	/// \param fixedWidth     Indicates whether or not a fixed-width font is
-	///                       desired.
-	/// \param fontFile [out] The name of a font that matches one of the
-	///                       preferred face names.
+	/// \param encoding           Desired font encoding.
+	/// \param preferredFonts     List of preferred font face names.
+	/// \param fixedWidth         Indicates whether or not a fixed-width font
+	///                           is desired.
+	/// \param fontFile [out]     The name of a font that matches one of the
+	///                           preferred face names.
+	/// \param indexPending [out] Optional; set to true if fontFile is a
+	///                           fallback font used only until the index is
+	///                           available.
 	///
 	/// \returns True if a matching font file was found.
 	///
 	/// \see GetFontFaceName
 	static bool GetPreferredFontFileName(wxFontEncoding encoding,
 		const wxArrayString &preferredFonts, const bool &fixedWidth,
-		wxString &fontFile);
+		wxString &fontFile, bool *indexPending = nullptr);
 
 	/// Gets the font name from the specified font file.
 	///
@@ -84,6 +104,16 @@ public:
 	///          file.
 	static bool GetFontName(const wxString &fontFile, wxString &fontName);
 
+	/// Checks to see if the font index is being rebuilt in the background.
+	///
+	/// \returns True if the worker thread is still scanning.
+	static bool IndexBuildInProgress();
+
+	/// Stops any background index build and waits for the worker thread to
+	/// finish.  The partial index is discarded.  Called automatically when
+	/// wxWidgets is cleaned up.
+	static void CancelIndexBuild();
+
 	/// TODO:  Allow the user to specify additional preferences
 	/*enum class StylePreference
 	{
@@ -100,6 +130,35 @@ private:
 	static const unsigned int mSubFamilyNameRecordId;
 	static const unsigned int mFullNameRecordId;
 
+	static const std::string mIndexHeader;
+
+	struct FontIndex
+	{
+		std::map<std::string, std::string> files;// Lower-case name to file
+		std::map<std::string, long long> directories;// Directory to modification time
+	};
+
+	static std::mutex mIndexMutex;
+	static FontIndex mIndex;
+	static bool mIndexLoaded;
+	static std::future<void> mIndexBuilder;
+	static std::atomic<bool> mCancelIndexBuild;
+
+	static wxString GetFontDirectory();
+	static wxString GetFallbackFontFileName();
+	static wxString GetIndexFileName();
+
+	static void LoadIndex();
+	static bool IndexIsCurrent(const FontIndex& index);
+	static void StartIndexBuild();
+	static void WaitForIndex();
+	static void ScanDirectory(const wxString& directory, FontIndex& index);
+	static bool SaveIndex(const FontIndex& index, const wxString& fileName);
+
+	static wxString LookUpFontFile(const wxString &fontName);
+	static bool SearchFontList(const wxArrayString &fontList,
+		const wxArrayString &preferredFonts, wxString &fontFile);
+
 	// TTF file header
 	struct TT_OFFSET_TABLE
 	{
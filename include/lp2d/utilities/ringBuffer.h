@@ -0,0 +1,196 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  ringBuffer.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Lock-free, fixed-capacity queue for passing data from one producer
+//        thread to one consumer thread.
+
+#ifndef RING_BUFFER_H_
+#define RING_BUFFER_H_
+
+// Standard C++ headers
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace LibPlot2D
+{
+
+/// Single-producer, single-consumer queue with fixed capacity.  Push() may be
+/// called from one thread while Pop() is called from another without any
+/// locking.  When the buffer is full, new values are rejected (the producer
+/// never blocks and never overwrites values the consumer has not read).
+template <class T>
+class RingBuffer
+{
+public:
+	/// Constructor.
+	///
+	/// \param capacity Minimum number of values the buffer can hold (rounded
+	///                 up to the next power of two).
+	explicit RingBuffer(const size_t& capacity);
+
+	RingBuffer(const RingBuffer&) = delete;
+	RingBuffer& operator=(const RingBuffer&) = delete;
+
+	/// Adds values to the buffer.  Must only be called by the producer
+	/// thread.
+	///
+	/// \param values Values to add.
+	/// \param count  Number of values to add.
+	///
+	/// \returns The number of values added (less than \p count if the buffer
+	///          is full).
+	size_t Push(const T* values, const size_t& count);
+
+	/// Removes all available values from the buffer.  Must only be called by
+	/// the consumer thread.
+	///
+	/// \param values [out] Vector to which the values are appended.
+	///
+	/// \returns The number of values removed.
+	size_t Pop(std::vector<T>& values);
+
+	/// Gets the number of values the buffer can hold.
+	/// \returns The capacity of the buffer.
+	inline size_t GetCapacity() const { return mBuffer.size(); }
+
+private:
+	std::vector<T> mBuffer;
+	const size_t mMask;
+
+	// Indices increase without bound (wrapping is handled by mMask); the
+	// padding keeps the indices written by each thread on separate cache
+	// lines
+	std::atomic<size_t> mHead{ 0 };// Written by the producer
+	char mPadding[64 - sizeof(std::atomic<size_t>)];
+	std::atomic<size_t> mTail{ 0 };// Written by the consumer
+
+	static size_t RoundUpToPowerOfTwo(const size_t& value);
+};
+
+//=============================================================================
+// Class:			RingBuffer
+// Function:		RingBuffer
+//
+// Description:		Constructor for RingBuffer class.
+//
+// Input Arguments:
+//		capacity	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <class T>
+RingBuffer<T>::RingBuffer(const size_t& capacity)
+	: mBuffer(RoundUpToPowerOfTwo(capacity)), mMask(mBuffer.size() - 1)
+{
+}
+
+//=============================================================================
+// Class:			RingBuffer
+// Function:		Push
+//
+// Description:		Adds values to the buffer.  Called by the producer thread.
+//
+// Input Arguments:
+//		values	= const T*
+//		count	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t, number of values added
+//
+//=============================================================================
+template <class T>
+size_t RingBuffer<T>::Push(const T* values, const size_t& count)
+{
+	const size_t head(mHead.load(std::memory_order_relaxed));
+	const size_t tail(mTail.load(std::memory_order_acquire));
+	const size_t accepted(std::min(count, mBuffer.size() - (head - tail)));
+
+	size_t i;
+	for (i = 0; i < accepted; ++i)
+		mBuffer[(head + i) & mMask] = values[i];
+
+	mHead.store(head + accepted, std::memory_order_release);
+	return accepted;
+}
+
+//=============================================================================
+// Class:			RingBuffer
+// Function:		Pop
+//
+// Description:		Removes all available values from the buffer.  Called by
+//					the consumer thread.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		values	= std::vector<T>&
+//
+// Return Value:
+//		size_t, number of values removed
+//
+//=============================================================================
+template <class T>
+size_t RingBuffer<T>::Pop(std::vector<T>& values)
+{
+	const size_t tail(mTail.load(std::memory_order_relaxed));
+	const size_t head(mHead.load(std::memory_order_acquire));
+
+	values.reserve(values.size() + head - tail);
+	size_t i;
+	for (i = tail; i != head; ++i)
+		values.push_back(mBuffer[i & mMask]);
+
+	mTail.store(head, std::memory_order_release);
+	return head - tail;
+}
+
+//=============================================================================
+// Class:			RingBuffer
+// Function:		RoundUpToPowerOfTwo
+//
+// Description:		Returns the smallest power of two greater than or equal to
+//					the specified value.
+//
+// Input Arguments:
+//		value	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t
+//
+//=============================================================================
+template <class T>
+size_t RingBuffer<T>::RoundUpToPowerOfTwo(const size_t& value)
+{
+	assert(value > 0);
+	size_t result(1);
+	while (result < value)
+		result <<= 1;
+	return result;
+}
+
+}// namespace LibPlot2D
+
+#endif// RING_BUFFER_H_
@@ -0,0 +1,93 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  sharedMemoryProducer.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Reference writer for the shared-memory streaming protocol.
+
+#ifndef SHARED_MEMORY_PRODUCER_H_
+#define SHARED_MEMORY_PRODUCER_H_
+
+// Local headers
+#include "lp2d/utilities/sharedMemoryProtocol.h"
+#include "lp2d/utilities/sharedMemoryRegion.h"
+
+// Standard C++ headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace LibPlot2D
+{
+
+/// Writer for the protocol described in SharedMemoryProtocol.  Intended to
+/// be linked into acquisition processes and test programs; it depends only on
+/// the C++ standard library and POSIX (not on wxWidgets or OpenGL), so the
+/// source files can be compiled into a producer without the rest of
+/// LibPlot2D.  On Linux with glibc older than 2.34, link with -lrt.
+class SharedMemoryProducer
+{
+public:
+	SharedMemoryProducer() = default;
+	~SharedMemoryProducer();
+
+	SharedMemoryProducer(const SharedMemoryProducer&) = delete;
+	SharedMemoryProducer& operator=(const SharedMemoryProducer&) = delete;
+
+	/// Creates the shared-memory object and writes the header.
+	///
+	/// \param name          Name of the object (should begin with '/').
+	/// \param channelNames  Names of the y-channels.
+	/// \param blockCapacity Maximum number of samples per block.
+	/// \param blockCount    Number of blocks in the ring.  Consumers which
+	///                      fall more than this many blocks behind lose data.
+	///
+	/// \returns True if the object was created.
+	bool Create(const std::string& name,
+		const std::vector<std::string>& channelNames,
+		const unsigned int& blockCapacity = 1024,
+		const unsigned int& blockCount = 64);
+
+	/// Writes samples for all channels.  Samples are split into as many
+	/// blocks as required.
+	///
+	/// \param x     X-values of the samples (common to all channels).
+	/// \param y     Y-values of the samples, one pointer per channel.
+	/// \param count Number of samples.
+	///
+	/// \returns True if the samples were written.
+	bool Write(const double* x, const std::vector<const double*>& y,
+		const unsigned int& count);
+
+	/// Marks the stream as closed and removes the shared-memory object.
+	/// Consumers which are already attached may finish reading the data.
+	void Close();
+
+	/// Gets the sequence number of the most recently written block.
+	/// \returns The sequence number (zero if nothing has been written).
+	inline uint64_t GetSequence() const { return mSequence; }
+
+	/// Gets a description of the most recent error.
+	/// \returns The error description.
+	inline const std::string& GetLastError() const { return mLastError; }
+
+private:
+	SharedMemoryRegion mRegion;
+	SharedMemoryProtocol::Header* mHeader = nullptr;
+	uint64_t mSequence = 0;
+
+	std::string mLastError;
+
+	void WriteBlock(const double* x, const std::vector<const double*>& y,
+		const unsigned int& count);
+};
+
+}// namespace LibPlot2D
+
+#endif// SHARED_MEMORY_PRODUCER_H_
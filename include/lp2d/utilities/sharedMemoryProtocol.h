@@ -0,0 +1,189 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  sharedMemoryProtocol.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Layout of the shared-memory ring buffer used to receive samples from
+//        external acquisition processes.
+
+#ifndef SHARED_MEMORY_PROTOCOL_H_
+#define SHARED_MEMORY_PROTOCOL_H_
+
+// Standard C++ headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace LibPlot2D
+{
+
+/// Definition of the shared-memory protocol for streaming samples from an
+/// acquisition process into a plot (see SharedMemoryProducer for the
+/// reference implementation of the writer and SharedMemorySource for the
+/// reader).
+///
+/// The producer creates a POSIX shared-memory object (shm_open()) containing
+/// a Header followed by Header::blockCount blocks of Header::blockSize bytes.
+/// Each block holds a BlockHeader, followed by Header::blockCapacity x-values
+/// and then Header::blockCapacity y-values for each channel in turn.  All
+/// values are native-endian, and the producer and consumer must run on the
+/// same machine.
+///
+/// Blocks are numbered with a sequence number starting at one; block \c n is
+/// written to slot <tt>(n - 1) % blockCount</tt>.  To write block \c n, the
+/// producer:
+/// 1. Stores zero to BlockHeader::sequence, followed by a release fence.
+/// 2. Writes the sample count and sample values.
+/// 3. Stores \c n to BlockHeader::sequence (release).
+/// 4. Stores \c n to Header::writeSequence (release).
+///
+/// A consumer expecting block \c n waits until Header::writeSequence is at
+/// least \c n, then reads BlockHeader::sequence (acquire), copies the
+/// samples, and reads BlockHeader::sequence again.  If either read is not
+/// \c n, the producer has overwritten the block and the consumer has fallen
+/// more than blockCount blocks behind; it should skip ahead to
+/// <tt>writeSequence - blockCount + 1</tt>.  The producer never waits for
+/// consumers, so any number of consumers may attach.
+namespace SharedMemoryProtocol
+{
+	/// Value of Header::magic ("LP2D").
+	const uint32_t Magic = 0x4C503244;
+
+	/// Value of Header::version for the layout described here.
+	const uint32_t Version = 1;
+
+	const unsigned int MaxChannels = 64;///< Maximum number of y-channels.
+	const unsigned int NameLength = 64;///< Size of channel names (including the terminating null).
+
+	/// Alignment of the header size and block size [bytes].
+	const unsigned int Alignment = 64;
+
+	/// Description of one channel.
+	struct ChannelInfo
+	{
+		char name[NameLength];///< Null-terminated UTF-8 name.
+	};
+
+	/// Data at the start of the shared-memory object.  All fields except
+	/// writeSequence and closed are written once, before writeSequence is
+	/// first updated.
+	struct Header
+	{
+		uint32_t magic;///< Must equal Magic.
+		uint32_t version;///< Must equal Version.
+		uint32_t channelCount;///< Number of y-channels.
+		uint32_t blockCapacity;///< Maximum number of samples per block.
+		uint32_t blockCount;///< Number of blocks in the ring.
+		uint32_t reserved;///< Set to zero.
+		uint64_t headerSize;///< Offset of the first block [bytes].
+		uint64_t blockSize;///< Distance between blocks [bytes].
+
+		/// Sequence number of the most recently completed block (zero if no
+		/// blocks have been written).
+		std::atomic<uint64_t> writeSequence;
+
+		/// Non-zero once the producer has stopped writing.
+		std::atomic<uint32_t> closed;
+
+		ChannelInfo channels[MaxChannels];///< Channel descriptions.
+	};
+
+	/// Data at the start of each block.
+	struct BlockHeader
+	{
+		/// Sequence number of the block (zero while it is being written).
+		std::atomic<uint64_t> sequence;
+		uint32_t sampleCount;///< Number of valid samples in the block.
+		uint32_t reserved;///< Set to zero.
+	};
+
+	static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+		"Shared-memory protocol requires lock-free atomics");
+
+	/// Rounds the specified size up to a multiple of Alignment.
+	///
+	/// \param size Size to round [bytes].
+	///
+	/// \returns The aligned size [bytes].
+	inline uint64_t Align(const uint64_t& size)
+	{
+		return (size + Alignment - 1) / Alignment * Alignment;
+	}
+
+	/// Computes the size of the header.
+	/// \returns The size of the header, including padding [bytes].
+	inline uint64_t GetHeaderSize()
+	{
+		return Align(sizeof(Header));
+	}
+
+	/// Computes the size of each block.
+	///
+	/// \param channelCount  Number of y-channels.
+	/// \param blockCapacity Maximum number of samples per block.
+	///
+	/// \returns The size of each block, including padding [bytes].
+	inline uint64_t GetBlockSize(const uint32_t& channelCount,
+		const uint32_t& blockCapacity)
+	{
+		return Align(sizeof(BlockHeader) + sizeof(double) *
+			static_cast<uint64_t>(blockCapacity) * (channelCount + 1));
+	}
+
+	/// Computes the size of the shared-memory object.
+	///
+	/// \param header Header describing the layout.
+	///
+	/// \returns The total size [bytes].
+	inline uint64_t GetTotalSize(const Header& header)
+	{
+		return header.headerSize + header.blockSize * header.blockCount;
+	}
+
+	/// Gets the block in which the specified sequence number is stored.
+	///
+	/// \param header   Header at the start of the shared-memory object.
+	/// \param sequence Sequence number (must be greater than zero).
+	///
+	/// \returns The block header.
+	inline BlockHeader& GetBlock(Header& header, const uint64_t& sequence)
+	{
+		return *reinterpret_cast<BlockHeader*>(
+			reinterpret_cast<char*>(&header) + header.headerSize +
+			header.blockSize * ((sequence - 1) % header.blockCount));
+	}
+
+	/// Gets the x-values stored in the specified block.
+	///
+	/// \param block Block containing the values.
+	///
+	/// \returns Pointer to the first x-value.
+	inline double* GetXData(BlockHeader& block)
+	{
+		return reinterpret_cast<double*>(&block + 1);
+	}
+
+	/// Gets the y-values for one channel stored in the specified block.
+	///
+	/// \param header  Header at the start of the shared-memory object.
+	/// \param block   Block containing the values.
+	/// \param channel Index of the channel.
+	///
+	/// \returns Pointer to the first y-value.
+	inline double* GetYData(const Header& header, BlockHeader& block,
+		const unsigned int& channel)
+	{
+		return GetXData(block) + static_cast<uint64_t>(header.blockCapacity) *
+			(channel + 1);
+	}
+}
+
+}// namespace LibPlot2D
+
+#endif// SHARED_MEMORY_PROTOCOL_H_
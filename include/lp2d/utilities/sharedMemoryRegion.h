@@ -0,0 +1,82 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  sharedMemoryRegion.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Mapping of a named POSIX shared-memory object.
+
+#ifndef SHARED_MEMORY_REGION_H_
+#define SHARED_MEMORY_REGION_H_
+
+// Standard C++ headers
+#include <cstddef>
+#include <string>
+
+namespace LibPlot2D
+{
+
+/// Named shared-memory object mapped into the address space of this process.
+/// The mapping is removed when the object is destroyed; the shared-memory
+/// object itself is also removed if it was created by this object.  Not
+/// supported on Windows (Create() and Open() always fail).
+class SharedMemoryRegion
+{
+public:
+	SharedMemoryRegion() = default;
+	~SharedMemoryRegion();
+
+	SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+	SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+	/// Creates a new shared-memory object (replacing any existing object with
+	/// the same name) and maps it for reading and writing.  The contents are
+	/// initialized to zero.
+	///
+	/// \param name Name of the object (should begin with '/').
+	/// \param size Size of the object [bytes].
+	///
+	/// \returns True if the object was created.
+	bool Create(const std::string& name, const size_t& size);
+
+	/// Maps an existing shared-memory object for reading and writing.
+	///
+	/// \param name Name of the object.
+	///
+	/// \returns True if the object was opened.
+	bool Open(const std::string& name);
+
+	/// Unmaps the object (and removes it, if it was created by this object).
+	void Close();
+
+	/// Gets a pointer to the start of the mapped memory.
+	/// \returns The address of the mapping (nullptr if not mapped).
+	inline void* GetData() const { return mData; }
+
+	/// Gets the size of the mapped memory.
+	/// \returns The size of the mapping [bytes].
+	inline size_t GetSize() const { return mSize; }
+
+	/// Gets a description of the most recent error.
+	/// \returns The error description.
+	inline const std::string& GetLastError() const { return mLastError; }
+
+private:
+	std::string mName;
+	void* mData = nullptr;
+	size_t mSize = 0;
+	bool mOwner = false;
+
+	std::string mLastError;
+
+	bool Map(const int& fileDescriptor, const size_t& size);
+};
+
+}// namespace LibPlot2D
+
+#endif// SHARED_MEMORY_REGION_H_
@@ -25,6 +25,7 @@ namespace LibPlot2D
 
 // Local forward declarations
 class Dataset2D;
+class RealFFTPlan;
 
 /// Class for performing FFTs and related operations.
 class FastFourierTransform
@@ -43,8 +44,8 @@ public:
 	};
 
 	/// Computes FFT of the specified dataset with default options.  By
-	/// default, the sample is chopped so the size is equal to the next-lowest
-	/// power of two.  No averaging is used.  A Hann window is applied and the
+	/// default, the entire sample is used (any number of points may be
+	/// transformed).  No averaging is used.  A Hann window is applied and the
 	/// data is mean-subtracted.
 	///
 	/// \param data Data set for which FFT should be computed.
@@ -58,7 +59,8 @@ public:
 	///
 	/// \param data         Data for which FFT should be computed.
 	/// \param window       Window function to be applied.
-	/// \param windowSize   Length of the window.
+	/// \param windowSize   Length of the window (any length is allowed; zero
+	///                     uses the entire sample).
 	/// \param overlap      Overlap between adjacent windows in percent (0.0 to
 	///                     1.0).
 	/// \param subtractMean Indicates whether or not the data should be
@@ -147,23 +149,22 @@ public:
 	static unsigned int GetMaxPowerOfTwo(const std::vector<double>::size_type &sampleSize);
 
 private:
-	static void ApplyWindow(Dataset2D &data, const WindowType &window);
-	static void ApplyHannWindow(Dataset2D &data);
-	static void ApplyHammingWindow(Dataset2D &data);
-	static void ApplyFlatTopWindow(Dataset2D &data);
-	//static void ApplyForceWindow(Dataset2D &data);
-	static void ApplyExponentialWindow(Dataset2D &data);
-
-	static void DoBitReversal(Dataset2D &set);
-	static void DoFFT(Dataset2D &temp);
+	static void ApplyWindow(std::vector<double> &data, const WindowType &window);
+	static void ApplyHannWindow(std::vector<double> &data);
+	static void ApplyHammingWindow(std::vector<double> &data);
+	static void ApplyFlatTopWindow(std::vector<double> &data);
+	//static void ApplyForceWindow(std::vector<double> &data);
+	static void ApplyExponentialWindow(std::vector<double> &data);
 
 	static void ZeroDataset(Dataset2D &data);
 	static Dataset2D GenerateConstantDataset(const double &xValue, const double &yValue, const std::vector<double>::size_type &size);
 
-	static Dataset2D ComputeCrossPowerSpectrum(const Dataset2D &fftIn, const Dataset2D &fftOut);
-	static Dataset2D ComputePowerSpectrum(const Dataset2D &fft);
+	static Dataset2D ComputeCrossPowerSpectrum(const Dataset2D &fftIn, const Dataset2D &fftOut,
+		const unsigned int &fftSize);
+	static Dataset2D ComputePowerSpectrum(const Dataset2D &fft, const unsigned int &fftSize);
 
 	static Dataset2D ConvertDoubleSidedToSingleSided(const Dataset2D &fullSpectrum, const bool &preserveDCValue = true);
+	static Dataset2D ConvertHalfSpectrumToSingleSided(const Dataset2D &halfSpectrum, const bool &preserveDCValue = true);
 
 	static Dataset2D ChopSample(const Dataset2D &data, const std::vector<double>::size_type &sample,
 		const unsigned int &windowSize, const double &overlap);
@@ -172,14 +173,17 @@ private:
 
 	static void ConvertAmplitudeToDecibels(Dataset2D &fft, const double& referenceAmplitude);
 
-	static void PopulateFrequencyData(Dataset2D &data, const double &sampleRate);
+	static void PopulateFrequencyData(Dataset2D &data, const double &sampleRate,
+		const unsigned int &fftSize);
 
-	static Dataset2D GetAmplitudeData(const Dataset2D &rawFFT, const double &sampleRate);
+	static Dataset2D GetAmplitudeData(const Dataset2D &rawFFT, const double &sampleRate,
+		const unsigned int &fftSize);
 
-	static Dataset2D GetPhaseData(const Dataset2D &rawFFT, const double &sampleRate, const bool &moduloPhase);
+	static Dataset2D GetPhaseData(const Dataset2D &rawFFT, const double &sampleRate,
+		const unsigned int &fftSize, const bool &moduloPhase);
 
-	static Dataset2D ComputeRawFFT(const Dataset2D &data, const WindowType &window);
-	static void InitializeRawFFTDataset(Dataset2D &rawFFT, const Dataset2D &data, const WindowType &window);
+	static Dataset2D ComputeRawFFT(const Dataset2D &data, const WindowType &window,
+		const RealFFTPlan& plan);
 
 	static Dataset2D ComplexAdd(const Dataset2D &a, const Dataset2D &b);
 	static Dataset2D ComplexMultiply(const Dataset2D &a, const Dataset2D &b);
@@ -0,0 +1,109 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  fftPlan.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Precomputed factors and twiddles for a complex FFT of any length.
+
+#ifndef FFT_PLAN_H_
+#define FFT_PLAN_H_
+
+// Standard C++ headers
+#include <complex>
+#include <memory>
+#include <vector>
+
+namespace LibPlot2D
+{
+
+/// Forward discrete Fourier transform of a fixed length.  Lengths whose
+/// prime factors are all small are computed with mixed-radix Cooley-Tukey
+/// passes (with dedicated kernels for radix 2, 3, 4 and 5); lengths with a
+/// large prime factor are computed with Bluestein's algorithm (as a
+/// convolution using power-of-two transforms).  Either way, the cost is
+/// O(N log N).  Creating a plan is relatively expensive, so plans should be
+/// re-used when transforming many blocks of the same length.  Execute() uses
+/// internal scratch space, so a plan must not be used by multiple threads at
+/// the same time.
+class FFTPlan
+{
+public:
+	/// Constructor.
+	///
+	/// \param size Length of the transform.
+	explicit FFTPlan(const size_t& size);
+	~FFTPlan();
+
+	/// Computes the forward transform (unscaled, with a negative exponent).
+	///
+	/// \param data [in/out] Data to transform (must have the length of the
+	///             plan).
+	void Execute(std::vector<std::complex<double>>& data) const;
+
+	/// Gets the length of the transform.
+	/// \returns The length of the transform.
+	inline size_t GetSize() const { return mSize; }
+
+	/// Checks to see if the transform is computed with Bluestein's algorithm.
+	/// \returns True if the length has a prime factor too large for a direct
+	///          pass.
+	inline bool UsesBluestein() const { return mConvolutionPlan != nullptr; }
+
+private:
+	typedef std::complex<double> Complex;
+
+	// Largest prime factor computed directly; beyond this, Bluestein's
+	// algorithm is cheaper than the O(p) work per output of a generic pass
+	static const size_t MaxDirectRadix;
+
+	const size_t mSize;
+
+	struct Stage
+	{
+		size_t radix;
+		size_t remaining;// Length of each sub-transform (product of later radices)
+	};
+
+	std::vector<Stage> mStages;
+	std::vector<Complex> mTwiddles;
+	mutable std::vector<Complex> mWork;
+	mutable std::vector<Complex> mGenericScratch;
+
+	// Bluestein's algorithm
+	std::unique_ptr<FFTPlan> mConvolutionPlan;
+	std::vector<Complex> mChirp;
+	std::vector<Complex> mChirpSpectrum;
+	mutable std::vector<Complex> mConvolution;
+
+	bool Factor();
+	void InitializeBluestein();
+
+	void Transform(Complex* output, const Complex* input, const size_t& stride,
+		const size_t& stage) const;
+
+	void Butterfly2(Complex* data, const size_t& stride,
+		const size_t& m) const;
+	void Butterfly3(Complex* data, const size_t& stride,
+		const size_t& m) const;
+	void Butterfly4(Complex* data, const size_t& stride,
+		const size_t& m) const;
+	void Butterfly5(Complex* data, const size_t& stride,
+		const size_t& m) const;
+	void ButterflyGeneric(Complex* data, const size_t& stride,
+		const size_t& m, const size_t& p) const;
+
+	void ExecuteBluestein(std::vector<Complex>& data) const;
+
+	static Complex Multiply(const Complex& a, const Complex& b);
+	static Complex MultiplyByI(const Complex& a);
+};
+
+}// namespace LibPlot2D
+
+#endif// FFT_PLAN_H_
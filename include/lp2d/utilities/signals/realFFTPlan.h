@@ -0,0 +1,73 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  realFFTPlan.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Real-input FFT producing the non-redundant half of the spectrum.
+
+#ifndef REAL_FFT_PLAN_H_
+#define REAL_FFT_PLAN_H_
+
+// Local headers
+#include "lp2d/utilities/signals/fftPlan.h"
+
+// Standard C++ headers
+#include <complex>
+#include <vector>
+
+namespace LibPlot2D
+{
+
+/// Forward discrete Fourier transform of real data of a fixed length.  The
+/// spectrum of real data is conjugate-symmetric, so only bins 0 through N / 2
+/// are computed.  For even lengths, the samples are packed into a complex
+/// sequence of length N / 2 (even samples real, odd samples imaginary), which
+/// is transformed and then separated with one additional twiddle pass, so
+/// the work and memory are roughly half that of a complex transform.  Odd
+/// lengths use a complex transform of the full length.  As with FFTPlan, a
+/// plan must not be used by multiple threads at the same time.
+class RealFFTPlan
+{
+public:
+	/// Constructor.
+	///
+	/// \param size Length of the transform (number of real samples).
+	explicit RealFFTPlan(const size_t& size);
+
+	/// Computes the forward transform (unscaled, with a negative exponent).
+	///
+	/// \param input        Data to transform (must have the length of the
+	///                     plan).
+	/// \param [out] output Bins 0 through N / 2 of the spectrum.
+	void Execute(const std::vector<double>& input,
+		std::vector<std::complex<double>>& output) const;
+
+	/// Gets the length of the transform.
+	/// \returns The number of real samples.
+	inline size_t GetSize() const { return mSize; }
+
+	/// Gets the number of bins computed by Execute().
+	/// \returns The number of non-redundant bins.
+	inline size_t GetSpectrumSize() const
+	{ return mSize == 0 ? 0 : mSize / 2 + 1; }
+
+private:
+	typedef std::complex<double> Complex;
+
+	const size_t mSize;
+	const bool mPacked;
+
+	FFTPlan mComplexPlan;
+	std::vector<Complex> mTwiddles;
+	mutable std::vector<Complex> mBuffer;
+};
+
+}// namespace LibPlot2D
+
+#endif// REAL_FFT_PLAN_H_
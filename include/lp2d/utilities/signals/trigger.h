@@ -0,0 +1,119 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  trigger.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Locates oscilloscope-style trigger events in a Dataset2D.
+
+#ifndef TRIGGER_H_
+#define TRIGGER_H_
+
+// Standard C++ headers
+#include <cstddef>
+#include <vector>
+
+namespace LibPlot2D
+{
+
+// Local forward declarations
+class Dataset2D;
+
+/// Object for locating trigger events (i.e. threshold crossings) in data
+/// where the x-values increase monotonically.  Scanning may be continued as
+/// data is appended (i.e. for streamed data); each call to Scan() considers
+/// only points beyond those already scanned, so the state of the hysteresis
+/// and holdoff carries over between calls.
+class Trigger
+{
+public:
+	/// Conditions which cause an event.
+	enum class Type
+	{
+		Edge,///< The signal crosses the level in the direction of the slope.
+		Level///< The signal is beyond the level (in the direction of the slope).
+	};
+
+	/// Direction of the signal for an event.
+	enum class Slope
+	{
+		Rising,
+		Falling,
+		Either///< Edge triggers only (treated as Rising for level triggers).
+	};
+
+	/// Parameters describing the trigger and the captured window.
+	struct Settings
+	{
+		Type type = Type::Edge;///< Type of trigger.
+		Slope slope = Slope::Rising;///< Direction of the signal.
+		double level = 0.0;///< Threshold value.
+
+		/// For edge triggers, distance the signal must move away from the
+		/// level (on the opposite side of the slope) before another crossing
+		/// is accepted.  Prevents noise from causing repeated events.
+		double hysteresis = 0.0;
+
+		double preTrigger = 0.0;///< Portion of each capture before the event (x-units).
+		double postTrigger = 1.0;///< Portion of each capture after the event (x-units).
+
+		/// Minimum distance between events (x-units).  Crossings within the
+		/// holdoff are ignored.  Level triggers are always held off for at
+		/// least the length of the capture window.
+		double holdoff = 0.0;
+	};
+
+	/// Constructor.
+	///
+	/// \param settings Trigger parameters.
+	explicit Trigger(const Settings& settings);
+
+	/// Clears the scan state, so the next call to Scan() starts from the
+	/// beginning of the data.
+	void Reset();
+
+	/// Finds events in points which have not already been scanned.
+	///
+	/// \param data Data to scan.
+	///
+	/// \returns The x-values of the events found.  Edge events are
+	///          interpolated between samples.
+	std::vector<double> Scan(const Dataset2D& data);
+
+	/// Gets the trigger parameters.
+	/// \returns The trigger parameters.
+	inline const Settings& GetSettings() const { return mSettings; }
+
+private:
+	const Settings mSettings;
+
+	struct EdgeDetector
+	{
+		bool rising;
+		bool armed = false;
+	};
+
+	EdgeDetector mRisingDetector;
+	EdgeDetector mFallingDetector;
+
+	bool mScanned = false;
+	double mLastX = 0.0;
+	double mLastY = 0.0;
+	double mNextAllowedX;
+
+	bool DetectorEnabled(const EdgeDetector& detector) const;
+
+	void ScanEdges(const std::vector<double>& x, const std::vector<double>& y,
+		const size_t& start, const size_t& end, std::vector<double>& events);
+	void ScanLevel(const std::vector<double>& x, const std::vector<double>& y,
+		const size_t& start, const size_t& end, std::vector<double>& events);
+};
+
+}// namespace LibPlot2D
+
+#endif// TRIGGER_H_
@@ -0,0 +1,87 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  triggeredCapture.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Collects and averages segments of data aligned to trigger events.
+
+#ifndef TRIGGERED_CAPTURE_H_
+#define TRIGGERED_CAPTURE_H_
+
+// Local headers
+#include "lp2d/utilities/signals/trigger.h"
+#include "lp2d/utilities/dataset2D.h"
+
+// Standard C++ headers
+#include <deque>
+#include <vector>
+
+namespace LibPlot2D
+{
+
+/// Object for capturing the data around each trigger event, with the
+/// x-values shifted so that every event occurs at zero.  The most recent
+/// segments are kept for overlaying, and every segment is added to a running
+/// average, so any number of events may be processed with constant memory.
+/// Update() may be called once for a complete data set, or repeatedly as data
+/// is appended (events are captured once the post-trigger window is
+/// complete).
+class TriggeredCapture
+{
+public:
+	/// Constructor.
+	///
+	/// \param settings     Trigger and capture window parameters.
+	/// \param segmentCount Number of recent segments to keep.
+	TriggeredCapture(const Trigger::Settings& settings,
+		const unsigned int& segmentCount);
+
+	/// Scans new points and captures the completed events.
+	///
+	/// \param data Data to scan (x-values must increase monotonically).
+	///
+	/// \returns The number of segments captured.
+	unsigned int Update(const Dataset2D& data);
+
+	/// Discards all segments and the average and restarts the scan.
+	void Reset();
+
+	/// Gets the most recent segments (oldest first).
+	/// \returns The recent segments.
+	inline const std::deque<Dataset2D>& GetSegments() const
+	{ return mSegments; }
+
+	/// Gets the average of all captured segments, sampled at the sample
+	/// period of the data.
+	/// \returns The average segment (empty if nothing has been captured).
+	Dataset2D GetAverage() const;
+
+	/// Gets the number of segments captured since the last reset.
+	/// \returns The number of captured segments.
+	inline unsigned long long GetCaptureCount() const { return mCaptureCount; }
+
+private:
+	Trigger mTrigger;
+	const unsigned int mSegmentCount;
+
+	std::deque<double> mPendingEvents;
+	std::deque<Dataset2D> mSegments;
+	unsigned long long mCaptureCount = 0;
+
+	double mAverageStep = 0.0;
+	std::vector<double> mAverageSums;
+	std::vector<unsigned int> mAverageCounts;
+
+	void CaptureSegment(const Dataset2D& data, const double& eventX);
+	void AddToAverage(const Dataset2D& data, const double& eventX);
+};
+
+}// namespace LibPlot2D
+
+#endif// TRIGGERED_CAPTURE_H_
@@ -0,0 +1,116 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  spatialIndex.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Uniform grid for locating the points of a Dataset2D by position.
+
+#ifndef SPATIAL_INDEX_H_
+#define SPATIAL_INDEX_H_
+
+// Standard C++ headers
+#include <vector>
+
+namespace LibPlot2D
+{
+
+// Local forward declarations
+class Dataset2D;
+
+/// Uniform grid over the points of a Dataset2D.  Intended for data where the
+/// x-values are not sorted (i.e. one channel plotted against another), where
+/// searching by x-value alone is not possible.  Points with non-finite values
+/// are not indexed.  The index must be rebuilt whenever the data changes.
+class SpatialIndex
+{
+public:
+	/// Constructor.
+	///
+	/// \param data The data to be indexed.
+	explicit SpatialIndex(const Dataset2D& data) : mData(data) {}
+
+	/// Builds the index from the current contents of the data.
+	void Rebuild();
+
+	/// Removes all points from the index.
+	void Clear();
+
+	/// Checks to see if the index contains any points.
+	/// \returns True if no points are indexed.
+	inline bool IsEmpty() const { return mPoints.empty(); }
+
+	/// Finds all points within the specified rectangle.  Points are returned
+	/// grouped by grid cell, not in their original order.
+	///
+	/// \param xMin          Minimum x-value.
+	/// \param xMax          Maximum x-value.
+	/// \param yMin          Minimum y-value.
+	/// \param yMax          Maximum y-value.
+	/// \param indices [out] Indices of the points within the rectangle.
+	void FindInRectangle(const double& xMin, const double& xMax,
+		const double& yMin, const double& yMax,
+		std::vector<unsigned int>& indices) const;
+
+	/// Counts the points within the specified rectangle.
+	///
+	/// \param xMin  Minimum x-value.
+	/// \param xMax  Maximum x-value.
+	/// \param yMin  Minimum y-value.
+	/// \param yMax  Maximum y-value.
+	/// \param limit Counting stops once this number of points is found.
+	///
+	/// \returns The number of points within the rectangle (no more than
+	///          \p limit).
+	unsigned int CountInRectangle(const double& xMin, const double& xMax,
+		const double& yMin, const double& yMax,
+		const unsigned int& limit) const;
+
+	/// Finds the point closest to the specified location.  Distances are
+	/// normalized by the search ranges, so the ranges can be chosen to
+	/// correspond to equal numbers of pixels in each direction.
+	///
+	/// \param x           X-value of the location.
+	/// \param y           Y-value of the location.
+	/// \param xRange      Maximum distance to search in the x-direction.
+	/// \param yRange      Maximum distance to search in the y-direction.
+	/// \param index [out] Index of the closest point.
+	///
+	/// \returns True if a point was found within the search ranges.
+	bool FindNearest(const double& x, const double& y, const double& xRange,
+		const double& yRange, unsigned int& index) const;
+
+private:
+	static const unsigned int mTargetPointsPerCell;
+	static const unsigned int mMaximumCellsPerSide;
+
+	const Dataset2D& mData;
+
+	double mXMin = 0.0;
+	double mYMin = 0.0;
+	double mXCellScale = 0.0;// [cells/unit]
+	double mYCellScale = 0.0;// [cells/unit]
+	unsigned int mColumns = 0;
+	unsigned int mRows = 0;
+
+	// Point indices sorted by cell; the points in cell i are stored between
+	// mCellStarts[i] and mCellStarts[i + 1]
+	std::vector<unsigned int> mCellStarts;
+	std::vector<unsigned int> mPoints;
+
+	unsigned int GetColumn(const double& x) const;
+	unsigned int GetRow(const double& y) const;
+
+	template <typename Visitor>
+	void VisitRectangle(const double& xMin, const double& xMax,
+		const double& yMin, const double& yMax, Visitor visit) const;
+};
+
+}// namespace LibPlot2D
+
+#endif// SPATIAL_INDEX_H_
@@ -0,0 +1,141 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  streamChannel.h
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Channel for passing samples from an acquisition thread to a plot.
+
+#ifndef STREAM_CHANNEL_H_
+#define STREAM_CHANNEL_H_
+
+// Local headers
+#include "lp2d/utilities/ringBuffer.h"
+
+// Standard C++ headers
+#include <atomic>
+#include <deque>
+#include <vector>
+
+namespace LibPlot2D
+{
+
+// Local forward declarations
+class Dataset2D;
+
+/// Channel for streaming samples to a plot (see
+/// GuiInterface::AddStreamChannel()).  Push() may be called by one producer
+/// thread at a time, concurrently with the GUI thread reading the samples.
+/// Samples are expected to arrive in order of increasing x-value (i.e. time).
+/// If the producer gets ahead of the display by more than the capacity of the
+/// channel, new samples are dropped.
+class StreamChannel
+{
+public:
+	/// Constructor.
+	///
+	/// \param capacity Number of samples which can be queued between display
+	///                 updates.
+	explicit StreamChannel(const size_t& capacity);
+
+	/// Adds samples to the channel.  Must only be called by the producer.
+	///
+	/// \param x     X-values of the samples.
+	/// \param y     Y-values of the samples.
+	/// \param count Number of samples.
+	///
+	/// \returns The number of samples accepted (less than \p count if the
+	///          channel is full).
+	size_t Push(const double* x, const double* y, const size_t& count);
+
+	/// Adds a single sample to the channel.  Must only be called by the
+	/// producer.
+	///
+	/// \param x X-value of the sample.
+	/// \param y Y-value of the sample.
+	///
+	/// \returns True if the sample was accepted.
+	bool Push(const double& x, const double& y);
+
+	/// Gets the number of samples rejected because the channel was full.
+	/// \returns The number of dropped samples.
+	inline unsigned long long GetDroppedCount() const { return mDroppedCount; }
+
+	/// \name Methods called by GuiInterface on the GUI thread.
+	/// @{
+
+	/// Moves queued samples into the specified data set.  Removing the
+	/// oldest points shifts the whole data set (and requires the curve to be
+	/// rebuilt), so points beyond the history size are removed in blocks:
+	/// up to a quarter of the history size may be retained in addition to
+	/// the most recent \p historySize points.  Extra points are not included
+	/// in the ranges reported by GetRange().
+	///
+	/// \param data            Data set to which samples are appended.
+	/// \param historySize     Number of points to retain.
+	/// \param trimmed   [out] Optional; set to true if points were removed
+	///                        from the start of the data set (otherwise
+	///                        the samples were only appended).
+	///
+	/// \returns The number of samples added.
+	size_t Drain(Dataset2D& data, const size_t& historySize,
+		bool* trimmed = nullptr);
+
+	/// Gets the index of the oldest point within the history.
+	///
+	/// \param data        Data set filled by Drain().
+	/// \param historySize Number of points to retain.
+	///
+	/// \returns Index of the oldest point to be shown.
+	static size_t GetHistoryStart(const Dataset2D& data,
+		const size_t& historySize);
+
+	/// Gets the range of y-values for points at or beyond the specified
+	/// x-value.  The range is tracked incrementally as samples arrive, so
+	/// \p xStart must never decrease between calls (unless
+	/// ResetExtrema() is called).
+	///
+	/// \param xStart       Smallest x-value to consider.
+	/// \param yMin   [out] Minimum y-value.
+	/// \param yMax   [out] Maximum y-value.
+	///
+	/// \returns True if any finite points are in the range.
+	bool GetRange(const double& xStart, double& yMin, double& yMax);
+
+	/// Rebuilds the range information from the specified data set.
+	///
+	/// \param data Data set containing all points received so far.
+	void ResetExtrema(const Dataset2D& data);
+
+	/// @}
+
+private:
+	struct Sample
+	{
+		double x;
+		double y;
+	};
+
+	RingBuffer<Sample> mBuffer;
+	std::atomic<unsigned long long> mDroppedCount{ 0 };
+
+	std::vector<Sample> mReceived;
+
+	// Candidates for the minimum and maximum of every window ending at the
+	// latest sample, ordered by x; each sample is added and removed at most
+	// once, so the range is maintained in constant amortized time
+	std::deque<Sample> mMinimums;
+	std::deque<Sample> mMaximums;
+
+	void AddToExtrema(const Sample& sample);
+	void DiscardExtremaBefore(const double& x);
+};
+
+}// namespace LibPlot2D
+
+#endif// STREAM_CHANNEL_H_
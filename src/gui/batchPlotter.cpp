@@ -0,0 +1,198 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  batchPlotter.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Non-interactive interface for loading data and writing plot images.
+
+// GLEW headers
+#include <GL/glew.h>
+
+// wxWidgets headers
+#include <wx/frame.h>
+
+// Local headers
+#include "lp2d/gui/batchPlotter.h"
+#include "lp2d/gui/plotListGrid.h"
+#include "lp2d/renderer/plotRenderer.h"
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			BatchPlotter
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for the BatchPlotter class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const wxPoint BatchPlotter::mOffscreenPosition(-10000, -10000);
+
+//=============================================================================
+// Class:			BatchPlotter
+// Function:		BatchPlotter
+//
+// Description:		Constructor for BatchPlotter class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+BatchPlotter::BatchPlotter() : mFrame(new wxFrame(nullptr, wxID_ANY,
+	_T("LibPlot2D"), mOffscreenPosition, wxDefaultSize,
+	wxBORDER_NONE | wxFRAME_NO_TASKBAR | wxFRAME_TOOL_WINDOW)),
+	mGuiInterface(mFrame)
+{
+	wxGLAttributes attributes;
+	attributes.PlatformDefaults().RGBA().DoubleBuffer().EndList();
+
+	mGrid = new PlotListGrid(mGuiInterface, mFrame, wxID_ANY);
+	mRenderer = new PlotRenderer(mGuiInterface, *mFrame, wxID_ANY, attributes);
+
+#ifdef __WXGTK__
+	// Under GTK, a context can only be made current for a realized window.
+	// This is why a display is required even though nothing is painted.  The
+	// frame is placed outside the desktop and is not raised or given focus.
+	mFrame->ShowWithoutActivating();
+#endif
+}
+
+//=============================================================================
+// Class:			BatchPlotter
+// Function:		~BatchPlotter
+//
+// Description:		Destructor for BatchPlotter class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+BatchPlotter::~BatchPlotter()
+{
+	mRenderer->FinishImageWrites();
+
+	// Deleted immediately (instead of with Destroy()) so the windows do not
+	// outlive the interface they reference
+	delete mFrame;
+}
+
+//=============================================================================
+// Class:			BatchPlotter
+// Function:		LoadFiles
+//
+// Description:		Loads the specified files, replacing any existing curves.
+//
+// Input Arguments:
+//		fileList	= const wxArrayString&
+//		channels	= const wxArrayInt&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the files were loaded successfully
+//
+//=============================================================================
+bool BatchPlotter::LoadFiles(const wxArrayString& fileList,
+	const wxArrayInt& channels)
+{
+	DataFile::SelectionData selectionInfo;
+	selectionInfo.selections = channels;
+	selectionInfo.removeExisting = true;
+	return mGuiInterface.LoadFiles(fileList, selectionInfo);
+}
+
+//=============================================================================
+// Class:			BatchPlotter
+// Function:		Clear
+//
+// Description:		Removes all curves.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void BatchPlotter::Clear()
+{
+	mGuiInterface.ClearAllCurves();
+}
+
+//=============================================================================
+// Class:			BatchPlotter
+// Function:		WriteImage
+//
+// Description:		Renders the plot offscreen and starts writing it to file.
+//
+// Input Arguments:
+//		pathAndFileName	= const wxString&
+//		width			= const int& [pixels]
+//		height			= const int& [pixels]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the image was rendered successfully
+//
+//=============================================================================
+bool BatchPlotter::WriteImage(const wxString& pathAndFileName,
+	const int& width, const int& height)
+{
+	return mRenderer->WriteImageToFileAsync(pathAndFileName, width, height);
+}
+
+//=============================================================================
+// Class:			BatchPlotter
+// Function:		Finish
+//
+// Description:		Waits for all image files to be written.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if all files were written successfully
+//
+//=============================================================================
+bool BatchPlotter::Finish()
+{
+	return mRenderer->FinishImageWrites();
+}
+
+}// namespace LibPlot2D
@@ -229,6 +229,11 @@ void FFTDialog::ConfigureControls()
 	for (i = 1; i <= maxPower; ++i)
 		mWindowSizeCombo->Append(wxString::Format("%u",
 			static_cast<unsigned int>(pow(2, i))));
+
+	// Any length may be transformed, so the entire sample is also offered
+	const unsigned int pointCount(GetPointCount());
+	if (pointCount > static_cast<unsigned int>(pow(2, maxPower)))
+		mWindowSizeCombo->Append(wxString::Format("%u", pointCount));
 	mWindowSizeCombo->SetSelection(mWindowSizeCombo->GetCount() - 1);
 }
 
@@ -44,6 +44,9 @@
 // Standard C++ headers
 #include <map>
 #include <algorithm>
+#include <limits>
+#include <cassert>
+#include <cmath>
 
 namespace LibPlot2D
 {
@@ -66,6 +69,10 @@ namespace LibPlot2D
 //=============================================================================
 GuiInterface::GuiInterface(wxFrame* owner) : mOwner(owner)
 {
+	mStreamTimer.Bind(wxEVT_TIMER, [this](wxTimerEvent&)
+	{
+		UpdateStreams();
+	});
 }
 
 //=============================================================================
@@ -85,6 +92,56 @@ GuiInterface::GuiInterface(wxFrame* owner) : mOwner(owner)
 //
 //=============================================================================
 bool GuiInterface::LoadFiles(const wxArrayString &fileList)
+{
+	return DoLoadFiles(fileList, nullptr);
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		LoadFiles
+//
+// Description:		Method for loading a multiple files without prompting the
+//					user.  The same selections are applied to every file.
+//
+// Input Arguments:
+//		fileList		= const wxArrayString&
+//		selectionInfo	= const DataFile::SelectionData&; if no channels are
+//						  selected, all channels are loaded
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		true for files successfully loaded, false otherwise
+//
+//=============================================================================
+bool GuiInterface::LoadFiles(const wxArrayString &fileList,
+	const DataFile::SelectionData& selectionInfo)
+{
+	return DoLoadFiles(fileList, &selectionInfo);
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		DoLoadFiles
+//
+// Description:		Loads the specified files, either prompting the user for
+//					selections or using the specified selections.
+//
+// Input Arguments:
+//		fileList		= const wxArrayString&
+//		fixedSelections	= const DataFile::SelectionData*; if nullptr, the
+//						  user is prompted for selections
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		true for files successfully loaded, false otherwise
+//
+//=============================================================================
+bool GuiInterface::DoLoadFiles(const wxArrayString &fileList,
+	const DataFile::SelectionData* fixedSelections)
 {
 	unsigned int i, j;
 	std::vector<bool> loaded(fileList.size());
@@ -106,7 +163,19 @@ bool GuiInterface::LoadFiles(const wxArrayString &fileList)
 
 		files[i]->Initialize();
 		it = selectionInfoMap.find(files[i]->GetAllDescriptions());
-		if (it == selectionInfoMap.end())
+		if (it == selectionInfoMap.end() && fixedSelections)
+		{
+			selectionInfo = *fixedSelections;
+			if (selectionInfo.selections.Count() == 0)
+			{
+				// X column counts as one description
+				for (j = 0; j + 1 < files[i]->GetAllDescriptions().Count(); ++j)
+					selectionInfo.selections.Add(j);
+			}
+
+			selectionInfoMap[files[i]->GetAllDescriptions()] = selectionInfo;
+		}
+		else if (it == selectionInfoMap.end())
 		{
 			if (files[i]->DescriptionsMatch(mLastDescriptions))
 				selectionInfo = mLastSelectionInfo;
@@ -463,6 +532,17 @@ void GuiInterface::RemoveCurve(const unsigned int &i)
 		mGrid->AutoSizeColumns();
 	}
 
+	mStreamCurves.erase(std::remove_if(mStreamCurves.begin(),
+		mStreamCurves.end(), [this, i](const StreamCurve& stream)
+	{
+		return stream.data == mPlotList[i].get();
+	}), mStreamCurves.end());
+	mStreamTriggers.erase(std::remove_if(mStreamTriggers.begin(),
+		mStreamTriggers.end(), [this, i](const StreamTrigger& trigger)
+	{
+		return trigger.source == mPlotList[i].get();
+	}), mStreamTriggers.end());
+
 	mRenderer->RemoveCurve(i);
 	mPlotList.Remove(i);
 
@@ -566,7 +646,9 @@ void GuiInterface::UpdateCursorValues(const bool &leftVisible, const bool &right
 		if (leftVisible && rightVisible)
 		{
 			double left, right;
-			if (mPlotList[i - 1]->GetYAt(leftValue, left) && mPlotList[i - 1]->GetYAt(rightValue, right))
+			const bool sortedX(mRenderer->CurveHasSortedX(i - 1));
+			if (mPlotList[i - 1]->GetYAt(leftValue, left, nullptr, sortedX) &&
+				mPlotList[i - 1]->GetYAt(rightValue, right, nullptr, sortedX))
 			{
 				mGrid->SetCellValue(i, static_cast<int>(PlotListGrid::Column::Difference), wxString::Format("%f", right - left));
 				showXDifference = true;
@@ -608,7 +690,8 @@ void GuiInterface::UpdateSingleCursorValue(const unsigned int &row,
 
 		bool exact;
 		double valueOut;
-		if (mPlotList[row - 1]->GetYAt(value, valueOut, &exact))
+		if (mPlotList[row - 1]->GetYAt(value, valueOut, &exact,
+			mRenderer->CurveHasSortedX(row - 1)))
 		{
 			if (exact)
 				mGrid->SetCellValue(row, static_cast<int>(column), _T("*") + wxString::Format("%f", valueOut));
@@ -1732,8 +1815,6 @@ void GuiInterface::UpdateLegend()
 	if (!mGrid)// TODO:  Eliminate need for this check
 		return;
 
-	double lineSize;
-	long markerSize;
 	std::vector<LibPlot2D::Legend::LegendEntryInfo> entries;
 	LibPlot2D::Legend::LegendEntryInfo info;
 	int i;
@@ -1742,23 +1823,52 @@ void GuiInterface::UpdateLegend()
 		if (!CurveIsVisible(i - 1))
 			continue;
 
-		mGrid->GetCellValue(i, static_cast<int>(PlotListGrid::Column::LineSize)).ToDouble(&lineSize);
-		info.lineSize = lineSize;
-		info.color = LibPlot2D::Color(mGrid->GetCellBackgroundColour(i, static_cast<int>(PlotListGrid::Column::Color)));
-		info.text = mGrid->GetCellValue(i, static_cast<int>(PlotListGrid::Column::Name));
-
-		mGrid->GetCellValue(i, static_cast<int>(PlotListGrid::Column::MarkerSize)).ToLong(&markerSize);
-		if (mRenderer->CurveMarkersVisible(i - 1))
-				info.markerSize = std::max(markerSize, 1L);
-		else
-			info.markerSize = markerSize;
-
+		GetLegendEntry(i - 1, info);
 		entries.push_back(info);
 	}
 	mRenderer->UpdateLegend(entries);
 	mRenderer->UpdateDisplay();
 }
 
+//=============================================================================
+// Class:			GuiInterface
+// Function:		GetLegendEntry
+//
+// Description:		Gets the legend entry for the specified curve.
+//
+// Input Arguments:
+//		i		= const unsigned int&
+//
+// Output Arguments:
+//		info	= Legend::LegendEntryInfo&
+//
+// Return Value:
+//		bool, true if the curve exists
+//
+//=============================================================================
+bool GuiInterface::GetLegendEntry(const unsigned int& i,
+	Legend::LegendEntryInfo& info) const
+{
+	if (!mGrid || i + 1 >= static_cast<unsigned int>(mGrid->GetNumberRows()))
+		return false;
+
+	const int row(static_cast<int>(i) + 1);
+	double lineSize;
+	mGrid->GetCellValue(row, static_cast<int>(PlotListGrid::Column::LineSize)).ToDouble(&lineSize);
+	info.lineSize = lineSize;
+	info.color = LibPlot2D::Color(mGrid->GetCellBackgroundColour(row, static_cast<int>(PlotListGrid::Column::Color)));
+	info.text = mGrid->GetCellValue(row, static_cast<int>(PlotListGrid::Column::Name));
+
+	long markerSize;
+	mGrid->GetCellValue(row, static_cast<int>(PlotListGrid::Column::MarkerSize)).ToLong(&markerSize);
+	if (mRenderer->CurveMarkersVisible(i))
+		info.markerSize = std::max(markerSize, 1L);
+	else
+		info.markerSize = markerSize;
+
+	return true;
+}
+
 //=============================================================================
 // Class:			GuiInterface
 // Function:		SetMarkerSize
@@ -1786,8 +1896,9 @@ void GuiInterface::SetMarkerSize(const unsigned int &curve, const int &size)
 // Class:			GuiInterface
 // Function:		UpdateCurveQuality
 //
-// Description:		Sets curve quality according to how many lines need to
-//					be rendered.
+// Description:		Sets curve quality.  Curves are always rendered at high
+//					quality when static; while dragging, the renderer selects
+//					the quality according to the measured frame time.
 //
 // Input Arguments:
 //		None
@@ -1801,11 +1912,9 @@ void GuiInterface::SetMarkerSize(const unsigned int &curve, const int &size)
 //=============================================================================
 void GuiInterface::UpdateCurveQuality()
 {
-	//if (mRenderer->GetTotalPointCount() > highQualityCurvePointLimit)
-		mRenderer->SetCurveQuality(LibPlot2D::PlotRenderer::CurveQuality::HighWrite);
-	/*else
-		mRenderer->SetCurveQuality(static_cast<PlotRenderer::CurveQuality>(
-		PlotRenderer::CurveQuality::HighStatic | PlotRenderer::CurveQuality::HighWrite));*/// TODO:  Fix this after line rendering is improved
+	mRenderer->SetCurveQuality(PlotRenderer::CurveQuality::HighStatic
+		| PlotRenderer::CurveQuality::HighWrite
+		| PlotRenderer::CurveQuality::Adaptive);
 }
 
 //=============================================================================
@@ -2352,4 +2461,429 @@ bool GuiInterface::CurveIsOnRightAxis(const unsigned int& i) const
 	return !(rightAxisValue.IsEmpty() || rightAxisValue.Cmp(_T("0")) == 0);
 }
 
+//=============================================================================
+// Class:			GuiInterface
+// Function:		AddStreamChannel
+//
+// Description:		Adds a new (empty) curve which is fed by a stream of
+//					samples.
+//
+// Input Arguments:
+//		name		= const wxString&
+//		historySize	= const size_t&
+//		capacity	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::shared_ptr<StreamChannel>
+//
+//=============================================================================
+std::shared_ptr<StreamChannel> GuiInterface::AddStreamChannel(
+	const wxString& name, const size_t& historySize, const size_t& capacity)
+{
+	assert(historySize > 0);
+
+	StreamCurve stream;
+	stream.channel = std::make_shared<StreamChannel>(capacity);
+	stream.historySize = historySize;
+
+	auto data(std::make_unique<Dataset2D>());
+	stream.data = data.get();
+	mStreamCurves.push_back(stream);
+
+	AddCurve(std::move(data), name);
+
+	return stream.channel;
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		AddTriggeredCurves
+//
+// Description:		Adds curves showing the segments of data around each
+//					trigger event in the specified curve (and optionally their
+//					average).  Streamed curves are re-triggered as data
+//					arrives.
+//
+// Input Arguments:
+//		curve			= const unsigned int&
+//		settings		= const Trigger::Settings&
+//		segmentCount	= const unsigned int&
+//		includeAverage	= const bool&
+//		target			= GuiInterface*, interface to which the curves are
+//						  added (this, if nullptr)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::AddTriggeredCurves(const unsigned int& curve,
+	const Trigger::Settings& settings, const unsigned int& segmentCount,
+	const bool& includeAverage, GuiInterface* target)
+{
+	assert(curve < mPlotList.GetCount());
+
+	GuiInterface& destination(target ? *target : *this);
+	const Dataset2D& source(*mPlotList[curve]);
+	const wxString name(mGrid ? mGrid->GetCellValue(curve + 1,
+		static_cast<int>(PlotListGrid::Column::Name)) :
+		wxString::Format(_T("Curve %u"), curve + 1));
+	auto capture(std::make_unique<TriggeredCapture>(settings, segmentCount));
+
+	const bool streamed(std::any_of(mStreamCurves.begin(),
+		mStreamCurves.end(), [&source](const StreamCurve& stream)
+	{
+		return stream.data == &source;
+	}));
+
+	if (!streamed)
+	{
+		capture->Update(source);
+
+		unsigned int i(0);
+		for (const auto& segment : capture->GetSegments())
+			destination.AddCurve(std::make_unique<Dataset2D>(segment),
+				name + wxString::Format(_T(" [Trigger %u]"), ++i));
+
+		if (includeAverage && capture->GetCaptureCount() > 0)
+			destination.AddCurve(std::make_unique<Dataset2D>(
+				capture->GetAverage()), name + wxString::Format(
+				_T(" [Average of %llu]"), capture->GetCaptureCount()));
+		return;
+	}
+
+	// Curves for streamed data start out empty and are filled as events are
+	// captured
+	StreamTrigger trigger;
+	trigger.source = &source;
+	trigger.target = &destination;
+
+	unsigned int i;
+	for (i = 0; i < segmentCount; ++i)
+	{
+		auto data(std::make_unique<Dataset2D>());
+		trigger.segments.push_back(data.get());
+		destination.AddCurve(std::move(data),
+			name + wxString::Format(_T(" [Trigger %u]"), i + 1));
+	}
+
+	if (includeAverage)
+	{
+		auto data(std::make_unique<Dataset2D>());
+		trigger.average = data.get();
+		destination.AddCurve(std::move(data), name + _T(" [Average]"));
+	}
+
+	trigger.capture = std::move(capture);
+	mStreamTriggers.push_back(std::move(trigger));
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		StartStreaming
+//
+// Description:		Starts periodically updating the streamed curves.
+//
+// Input Arguments:
+//		refreshRate	= const double& [Hz]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::StartStreaming(const double& refreshRate)
+{
+	assert(refreshRate > 0.0);
+	mStreamTimer.Start(std::max(1, static_cast<int>(1000.0 / refreshRate)));
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		StopStreaming
+//
+// Description:		Stops updating the streamed curves.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::StopStreaming()
+{
+	mStreamTimer.Stop();
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		SetStreamWindow
+//
+// Description:		Sets the width of the scrolling x-axis range.
+//
+// Input Arguments:
+//		width	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::SetStreamWindow(const double& width)
+{
+	assert(width >= 0.0);
+	mStreamWindow = width;
+
+	// Points which were outside of a narrower window may now be visible
+	for (auto& stream : mStreamCurves)
+		stream.channel->ResetExtrema(*stream.data);
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		SetStreamFollow
+//
+// Description:		Sets the flag indicating whether or not the axis limits
+//					follow the streamed data.
+//
+// Input Arguments:
+//		follow	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::SetStreamFollow(const bool& follow)
+{
+	mStreamFollow = follow;
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		UpdateStreams
+//
+// Description:		Moves queued samples into the streamed curves and updates
+//					the display.  Called at the streaming refresh rate.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::UpdateStreams()
+{
+	bool modified(false);
+	double latestX(-std::numeric_limits<double>::max());
+	for (auto& stream : mStreamCurves)
+	{
+		// Between removals of old points, only the new samples need to be
+		// added to the curve's vertex buffer
+		unsigned int index;
+		bool trimmed;
+		const size_t added(stream.channel->Drain(*stream.data,
+			stream.historySize, &trimmed));
+		if (added > 0 && GetCurveIndex(stream.data, index))
+		{
+			if (trimmed)
+				mRenderer->SetCurveDataModified(index);
+			else
+				mRenderer->SetCurveDataAppended(index, added);
+			modified = true;
+		}
+
+		if (stream.data->GetNumberOfPoints() > 0)
+			latestX = std::max(latestX, stream.data->GetX().back());
+	}
+
+	if (!modified)
+		return;
+
+	UpdateStreamTriggers();
+
+	if (mStreamFollow)
+		UpdateStreamLimits(latestX);
+	mRenderer->UpdateDisplay();
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		UpdateStreamTriggers
+//
+// Description:		Captures new trigger events in streamed curves and updates
+//					the curves showing the captured segments.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::UpdateStreamTriggers()
+{
+	for (auto& trigger : mStreamTriggers)
+	{
+		if (trigger.capture->Update(*trigger.source) == 0)
+			continue;
+
+		// The newest segment is always shown by the last curve
+		const auto& segments(trigger.capture->GetSegments());
+		const size_t offset(trigger.segments.size() - segments.size());
+		size_t i;
+		for (i = 0; i < segments.size(); ++i)
+			trigger.target->ReplaceCurveData(trigger.segments[offset + i],
+				segments[i]);
+
+		if (trigger.average)
+			trigger.target->ReplaceCurveData(trigger.average,
+				trigger.capture->GetAverage());
+
+		if (trigger.target != this)
+			trigger.target->mRenderer->UpdateDisplay();
+	}
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		ReplaceCurveData
+//
+// Description:		Replaces the contents of the data set for a curve.
+//
+// Input Arguments:
+//		data	= Dataset2D*, owned by mPlotList
+//		newData	= const Dataset2D&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, false if the curve no longer exists
+//
+//=============================================================================
+bool GuiInterface::ReplaceCurveData(Dataset2D* data, const Dataset2D& newData)
+{
+	unsigned int index;
+	if (!GetCurveIndex(data, index))
+		return false;
+
+	*data = newData;
+	mRenderer->SetCurveDataModified(index);
+	return true;
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		UpdateStreamLimits
+//
+// Description:		Scrolls the x-axis to show the newest samples and scales
+//					the left y-axis to the range of the visible streamed
+//					points.
+//
+// Input Arguments:
+//		latestX	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void GuiInterface::UpdateStreamLimits(const double& latestX)
+{
+	// With no window, all retained points are shown (points beyond the
+	// history size have already been removed from the range information)
+	const double rangeStart(mStreamWindow > 0.0 ? latestX - mStreamWindow :
+		-std::numeric_limits<double>::max());
+
+	double xStart(latestX - mStreamWindow);
+	double yMin(std::numeric_limits<double>::max());
+	double yMax(-std::numeric_limits<double>::max());
+	for (auto& stream : mStreamCurves)
+	{
+		if (stream.data->GetNumberOfPoints() == 0)
+			continue;
+
+		if (mStreamWindow == 0.0)
+			xStart = std::min(xStart, stream.data->GetX()[
+				StreamChannel::GetHistoryStart(*stream.data, stream.historySize)]);
+
+		unsigned int index;
+		if (!GetCurveIndex(stream.data, index) || (mGrid &&
+			(!CurveIsVisible(index) || CurveIsOnRightAxis(index))))
+			continue;
+
+		double curveMin, curveMax;
+		if (stream.channel->GetRange(rangeStart, curveMin, curveMax))
+		{
+			yMin = std::min(yMin, curveMin);
+			yMax = std::max(yMax, curveMax);
+		}
+	}
+
+	if (latestX > xStart)
+		mRenderer->SetXLimits(xStart, latestX);
+
+	if (yMax < yMin)
+		return;
+
+	// Leave a small margin so the extreme points are not drawn on the axes
+	double margin(0.05 * (yMax - yMin));
+	if (margin == 0.0)
+		margin = std::max(0.05 * std::abs(yMax), 1.0e-6);
+	mRenderer->SetLeftYLimits(yMin - margin, yMax + margin);
+}
+
+//=============================================================================
+// Class:			GuiInterface
+// Function:		GetCurveIndex
+//
+// Description:		Finds the index of the curve for the specified data set.
+//
+// Input Arguments:
+//		data	= const Dataset2D*
+//
+// Output Arguments:
+//		index	= unsigned int&
+//
+// Return Value:
+//		bool, true if the data set belongs to a curve
+//
+//=============================================================================
+bool GuiInterface::GetCurveIndex(const Dataset2D* data,
+	unsigned int& index) const
+{
+	for (index = 0; index < mPlotList.GetCount(); ++index)
+	{
+		if (mPlotList[index].get() == data)
+			return true;
+	}
+
+	return false;
+}
+
 }// namespace LibPlot2D
@@ -20,12 +20,17 @@
 #include "lp2d/renderer/plotRenderer.h"
 #include "lp2d/renderer/color.h"
 #include "lp2d/renderer/primitives/plotCurve.h"
+#include "lp2d/renderer/primitives/plotCurveBatch.h"
 #include "lp2d/renderer/primitives/textRendering.h"
 #include "lp2d/renderer/primitives/legend.h"
 #include "lp2d/utilities/math/plotMath.h"
 #include "lp2d/utilities/dataset2D.h"
 #include "lp2d/utilities/fontFinder.h"
 
+// Standard C++ headers
+#include <algorithm>
+#include <cassert>
+
 namespace LibPlot2D
 {
 
@@ -72,6 +77,11 @@ const unsigned int PlotObject::mVerticalOffsetWithoutScale(25);
 PlotObject::PlotObject(PlotRenderer &renderer, GuiInterface& guiInterface)
 	: mRenderer(renderer), mGuiInterface(guiInterface)
 {
+	mFontIndexTimer.Bind(wxEVT_TIMER, [this](wxTimerEvent&)
+	{
+		OnFontIndexTimer();
+	});
+
 	CreateAxisObjects();
 	InitializeFonts();
 	ResetAutoScaling();
@@ -100,6 +110,11 @@ void PlotObject::CreateAxisObjects()
 	mAxisLeft = new Axis(mRenderer);
 	mAxisRight = new Axis(mRenderer);
 	mTitleObject = new TextRendering(mRenderer);
+	mStatisticsObject = new TextRendering(mRenderer);
+	mStatisticsObject->SetIsOverlay(true);
+	mStatisticsObject->SetVisibility(false);
+	mLeftCurveBatch = new PlotCurveBatch(mRenderer, PlotRenderer::Modelview::Left);
+	mRightCurveBatch = new PlotCurveBatch(mRenderer, PlotRenderer::Modelview::Right);
 
 	// Tell each axis how they relate to other axes
 	mAxisTop->SetAxisAtMaxEnd(mAxisRight);
@@ -146,10 +161,17 @@ void PlotObject::InitializeFonts()
 	preferredFonts.Add(_T("DejaVu Sans"));// GTK preference
 	preferredFonts.Add(_T("Arial"));// MSW preference
 
+	bool indexPending;
 	bool foundFont = FontFinder::GetPreferredFontFileName(wxFONTENCODING_SYSTEM,
-		preferredFonts, false, fontFile);
+		preferredFonts, false, fontFile, &indexPending);
 
-	if (!foundFont)
+	if (indexPending)
+	{
+		// Use the fallback font until the font index is available, then look
+		// for the preferred fonts again
+		mFontIndexTimer.Start(250);
+	}
+	else if (!foundFont)
 	{
 		if (!fontFile.IsEmpty())
 		{
@@ -171,6 +193,46 @@ void PlotObject::InitializeFonts()
 	mAxisRight->InitializeFonts(mFontFileName, 12);
 
 	mTitleObject->InitializeFonts(mFontFileName, 18);
+	mStatisticsObject->InitializeFonts(mFontFileName, 12);// Must match SetStatisticsText()
+}
+
+//=============================================================================
+// Class:			PlotObject
+// Function:		OnFontIndexTimer
+//
+// Description:		Checks to see if the font index has been built and, if so,
+//					replaces the fallback font with the preferred font.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotObject::OnFontIndexTimer()
+{
+	if (FontFinder::IndexBuildInProgress())
+		return;
+
+	mFontIndexTimer.Stop();
+
+	const std::string fallbackFontFileName(mFontFileName);
+	InitializeFonts();
+	if (mFontFileName == fallbackFontFileName)
+		return;
+
+	mAxisBottom->SetModified();
+	mAxisLeft->SetModified();
+	mAxisRight->SetModified();
+	mTitleObject->SetModified();
+	mStatisticsObject->SetModified();
+
+	Invalidate(Dirty::Layout);
+	mRenderer.UpdateFonts();
 }
 
 //=============================================================================
@@ -178,7 +240,8 @@ void PlotObject::InitializeFonts()
 // Function:		Update
 //
 // Description:		Updates the data in the plot and re-sets the fonts, sizes
-//					and positions.
+//					and positions.  Only the objects that depend on the state
+//					which was modified since the last update are rebuilt.
 //
 // Input Arguments:
 //		None
@@ -192,13 +255,143 @@ void PlotObject::InitializeFonts()
 //=============================================================================
 void PlotObject::Update()
 {
-	FormatPlot();
-	ComputeTransformationMatrices();
+	if (mDirty == 0)
+		return;
+
+	if ((mDirty & (Dirty::Data | Dirty::Limits | Dirty::Layout | Dirty::Size)) != 0)
+	{
+		FormatPlot();
+		ComputeTransformationMatrices();
+
+		// Cursor values depend on both the data and the axis limits
+		mDirty |= Dirty::Cursors;
+	}
+
+	FormatCurves();
+
+	if ((mDirty & Dirty::Cursors) != 0)
+	{
+		mRenderer.UpdateCursors();
+		mGuiInterface.UpdateCursorValues(
+			mRenderer.GetLeftCursorVisible(), mRenderer.GetRightCursorVisible(),
+			mRenderer.GetLeftCursorValue(), mRenderer.GetRightCursorValue());
+	}
+
+	mDirty = Dirty::None;
+}
+
+//=============================================================================
+// Class:			PlotObject
+// Function:		Invalidate
+//
+// Description:		Flags the specified state as modified.
+//
+// Input Arguments:
+//		dirty	= const Dirty&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotObject::Invalidate(const Dirty& dirty)
+{
+	mDirty |= dirty;
+}
+
+//=============================================================================
+// Class:			PlotObject
+// Function:		SetPrettyCurves
+//
+// Description:		Sets the curve rendering algorithm.
+//
+// Input Arguments:
+//		pretty	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotObject::SetPrettyCurves(const bool &pretty)
+{
+	if (mPretty == pretty)
+		return;
 
-	mRenderer.UpdateCursors();
-	mGuiInterface.UpdateCursorValues(
-		mRenderer.GetLeftCursorVisible(), mRenderer.GetRightCursorVisible(),
-		mRenderer.GetLeftCursorValue(), mRenderer.GetRightCursorValue());
+	mPretty = pretty;
+	Invalidate(Dirty::Style);
+}
+
+//=============================================================================
+// Class:			PlotObject
+// Function:		SetCurveDecimation
+//
+// Description:		Sets the decimation factor for rendering curves.
+//
+// Input Arguments:
+//		decimation	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotObject::SetCurveDecimation(const unsigned int &decimation)
+{
+	if (mDecimation == decimation)
+		return;
+
+	mDecimation = decimation;
+	Invalidate(Dirty::Style);
+}
+
+//=============================================================================
+// Class:			PlotObject
+// Function:		SetDensityCurves
+//
+// Description:		Sets the flag for rendering curves as a density image.
+//
+// Input Arguments:
+//		density	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotObject::SetDensityCurves(const bool &density)
+{
+	mLeftCurveBatch->SetDensityMode(density);
+	mRightCurveBatch->SetDensityMode(density);
+}
+
+//=============================================================================
+// Class:			PlotObject
+// Function:		GetDensityCurves
+//
+// Description:		Returns the flag for rendering curves as a density image.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//=============================================================================
+bool PlotObject::GetDensityCurves() const
+{
+	return mLeftCurveBatch->GetDensityMode();
 }
 
 //=============================================================================
@@ -220,6 +413,7 @@ void PlotObject::Update()
 void PlotObject::SetEqualScaling(const bool& equalScaling)
 {
 	mEqualScaling = equalScaling;
+	Invalidate(Dirty::Limits);
 }
 
 //=============================================================================
@@ -367,6 +561,7 @@ void PlotObject::SetRightYMinorGrid(const bool &gridOn)
 void PlotObject::SetXMajorResolution(const double &resolution)
 {
 	mXMajorResolution = resolution;
+	Invalidate(Dirty::Layout);
 }
 
 //=============================================================================
@@ -388,6 +583,7 @@ void PlotObject::SetXMajorResolution(const double &resolution)
 void PlotObject::SetLeftYMajorResolution(const double &resolution)
 {
 	mYLeftMajorResolution = resolution;
+	Invalidate(Dirty::Layout);
 }
 
 //=============================================================================
@@ -409,6 +605,7 @@ void PlotObject::SetLeftYMajorResolution(const double &resolution)
 void PlotObject::SetRightYMajorResolution(const double &resolution)
 {
 	mYRightMajorResolution = resolution;
+	Invalidate(Dirty::Layout);
 }
 
 //=============================================================================
@@ -451,10 +648,15 @@ void PlotObject::RemoveExistingPlots()
 //=============================================================================
 void PlotObject::RemovePlot(const unsigned int &index)
 {
-	mRenderer.RemoveActor(mPlotList[index]);
+	PlotCurve* plot(mPlotList[index]);
+	mLeftCurveBatch->RemoveCurve(plot);
+	mRightCurveBatch->RemoveCurve(plot);
+	mRenderer.RemoveActor(plot);
 
 	mPlotList.erase(mPlotList.begin() + index);
 	mDataList.erase(mDataList.begin() + index);
+	mExtremesList.erase(mExtremesList.begin() + index);
+	Invalidate(Dirty::Data);
 }
 
 //=============================================================================
@@ -478,9 +680,72 @@ void PlotObject::AddCurve(const Dataset2D &data)
 	PlotCurve *newPlot = new PlotCurve(mRenderer, data);
 	mPlotList.push_back(newPlot);
 	mDataList.push_back(&data);
+	mExtremesList.push_back(CurveExtremes());
 
 	newPlot->BindToXAxis(mAxisBottom);
 	newPlot->BindToYAxis(mAxisLeft);
+	newPlot->SetPretty(mPretty);
+	newPlot->SetDecimation(mDecimation);
+	Invalidate(Dirty::Data);
+}
+
+//=============================================================================
+// Class:			PlotObject
+// Function:		SetCurveDataModified
+//
+// Description:		Flags the data for the specified curve as modified.
+//
+// Input Arguments:
+//		index	= const unsigned int& specifying the modified curve
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotObject::SetCurveDataModified(const unsigned int &index)
+{
+	assert(index < mPlotList.size());
+	mExtremesList[index].valid = false;
+	mPlotList[index]->SetDataModified();
+	Invalidate(Dirty::Data);
+}
+
+//=============================================================================
+// Class:			PlotObject
+// Function:		SetCurveDataAppended
+//
+// Description:		Flags the data for the specified curve as extended.  The
+//					cached range is expanded to include the new points.
+//
+// Input Arguments:
+//		index	= const unsigned int& specifying the modified curve
+//		count	= const unsigned int& number of points appended
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotObject::SetCurveDataAppended(const unsigned int &index,
+	const unsigned int &count)
+{
+	assert(index < mPlotList.size());
+	assert(count <= mDataList[index]->GetNumberOfPoints());
+
+	const unsigned int firstPoint(static_cast<unsigned int>(
+		mDataList[index]->GetNumberOfPoints()) - count);
+	if (mExtremesList[index].valid && firstPoint > 0)
+		UpdateCurveExtremes(index, firstPoint);
+	else
+		mExtremesList[index].valid = false;
+
+	mPlotList[index]->SetDataAppended(count);
+	Invalidate(Dirty::Data);
 }
 
 //=============================================================================
@@ -510,7 +775,6 @@ void PlotObject::FormatPlot()
 	CheckForZeroRange();
 	CheckAutoScaling();
 	MatchYAxes();
-	FormatCurves();
 
 	bool forceLeftYLimits(!mAutoScaleLeftY), forceRightYLimits(!mAutoScaleRightY);
 	if (mLeftUsed && !mRightUsed)
@@ -831,8 +1095,8 @@ void PlotObject::FormatTitle()
 {
 	mTitleObject->SetCentered(true);
 	mTitleObject->SetPosition(mAxisLeft->GetOffsetFromWindowEdge()
-		+ (mRenderer.GetSize().GetWidth() - mAxisLeft->GetOffsetFromWindowEdge() - mAxisRight->GetOffsetFromWindowEdge()) / 2.0,
-		mRenderer.GetSize().GetHeight() - mAxisTop->GetOffsetFromWindowEdge() / 2.0);
+		+ (mRenderer.GetRenderSize().GetWidth() - mAxisLeft->GetOffsetFromWindowEdge() - mAxisRight->GetOffsetFromWindowEdge()) / 2.0,
+		mRenderer.GetRenderSize().GetHeight() - mAxisTop->GetOffsetFromWindowEdge() / 2.0);
 }
 
 //=============================================================================
@@ -840,7 +1104,9 @@ void PlotObject::FormatTitle()
 // Function:		SetOriginalAxisLimits
 //
 // Description:		Finds the range of each axis and sets the "original" values
-//					(limits for if the axese were autoscaled).
+//					(limits for if the axese were autoscaled).  The range of
+//					each data set is cached, so the data is only scanned
+//					after it changes.
 //
 // Input Arguments:
 //		None
@@ -862,27 +1128,88 @@ void PlotObject::SetOriginalAxisLimits()
 	{
 		if (!mPlotList[i]->GetIsVisible())
 			continue;
+
+		if (!mExtremesList[i].valid)
+			UpdateCurveExtremes(i);
+
 		if (!mLeftUsed && !mRightUsed)
 		{
-			mXMinOriginal = GetFirstValidValue(mDataList[i]->GetX());
-			mXMaxOriginal = mXMinOriginal;
+			mXMinOriginal = mExtremesList[i].xMin;
+			mXMaxOriginal = mExtremesList[i].xMax;
 		}
 
 		yAxis = mPlotList[i]->GetYAxis();
 		if (yAxis == mAxisLeft && !mLeftUsed)
 		{
 			mLeftUsed = true;
-			mYLeftMinOriginal = GetFirstValidValue(mDataList[i]->GetY());
-			mYLeftMaxOriginal = mYLeftMinOriginal;
+			mYLeftMinOriginal = mExtremesList[i].yMin;
+			mYLeftMaxOriginal = mExtremesList[i].yMax;
 		}
 		else if (yAxis == mAxisRight && !mRightUsed)
 		{
 			mRightUsed = true;
-			mYRightMinOriginal = GetFirstValidValue(mDataList[i]->GetY());
-			mYRightMaxOriginal = mYRightMinOriginal;
+			mYRightMinOriginal = mExtremesList[i].yMin;
+			mYRightMaxOriginal = mExtremesList[i].yMax;
+		}
+		GetAxisExtremes(i, yAxis);
+	}
+}
+
+//=============================================================================
+// Class:			PlotObject
+// Function:		UpdateCurveExtremes
+//
+// Description:		Scans the data for the specified curve and stores the
+//					range of valid values.  If the first point is not zero,
+//					the existing range is expanded to include the points
+//					beginning with the first point.
+//
+// Input Arguments:
+//		index		= const unsigned int& specifying the curve
+//		firstPoint	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotObject::UpdateCurveExtremes(const unsigned int &index,
+	const unsigned int &firstPoint)
+{
+	const Dataset2D& data(*mDataList[index]);
+	CurveExtremes& extremes(mExtremesList[index]);
+
+	if (firstPoint == 0)
+	{
+		extremes.xMin = GetFirstValidValue(data.GetX());
+		extremes.xMax = extremes.xMin;
+		extremes.yMin = GetFirstValidValue(data.GetY());
+		extremes.yMax = extremes.yMin;
+	}
+
+	unsigned int i;
+	for (i = firstPoint; i < data.GetNumberOfPoints(); ++i)
+	{
+		if (PlotMath::IsValid<double>(data.GetX()[i]))
+		{
+			if (data.GetX()[i] > extremes.xMax)
+				extremes.xMax = data.GetX()[i];
+			else if (data.GetX()[i] < extremes.xMin)
+				extremes.xMin = data.GetX()[i];
+		}
+
+		if (PlotMath::IsValid<double>(data.GetY()[i]))
+		{
+			if (data.GetY()[i] > extremes.yMax)
+				extremes.yMax = data.GetY()[i];
+			else if (data.GetY()[i] < extremes.yMin)
+				extremes.yMin = data.GetY()[i];
 		}
-		GetAxisExtremes(*mDataList[i], yAxis);
 	}
+
+	extremes.valid = true;
 }
 
 //=============================================================================
@@ -956,11 +1283,11 @@ void PlotObject::MatchYAxes()
 // Class:			PlotObject
 // Function:		GetAxisExtremes
 //
-// Description:		Parese the specified dataset and sets the associated mins
-//					and maxes (original) equal to the extremum for the dataset.
+// Description:		Expands the associated mins and maxes (original) to
+//					include the cached extremum for the specified curve.
 //
 // Input Arguments:
-//		data	= const Dataset2D&
+//		index	= const unsigned int& specifying the curve
 //		yAxis	= Axis* indicating the associated y-axis for the data
 //
 // Output Arguments:
@@ -970,33 +1297,23 @@ void PlotObject::MatchYAxes()
 //		None
 //
 //=============================================================================
-void PlotObject::GetAxisExtremes(const Dataset2D &data, Axis *yAxis)
+void PlotObject::GetAxisExtremes(const unsigned int &index, Axis *yAxis)
 {
-	unsigned int i;
-	for (i = 0; i < data.GetNumberOfPoints(); ++i)
-	{
-		if (PlotMath::IsValid<double>(data.GetX()[i]))
-		{
-			if (data.GetX()[i] > mXMaxOriginal)
-				mXMaxOriginal = data.GetX()[i];
-			else if (data.GetX()[i] < mXMinOriginal)
-				mXMinOriginal = data.GetX()[i];
-		}
+	const CurveExtremes& extremes(mExtremesList[index]);
+	assert(extremes.valid);
 
-		if (yAxis == mAxisLeft && PlotMath::IsValid<double>(data.GetY()[i]))
-		{
-			if (data.GetY()[i] > mYLeftMaxOriginal)
-				mYLeftMaxOriginal = data.GetY()[i];
-			else if (data.GetY()[i] < mYLeftMinOriginal)
-				mYLeftMinOriginal = data.GetY()[i];
-		}
-		else if (yAxis == mAxisRight && PlotMath::IsValid<double>(data.GetY()[i]))
-		{
-			if (data.GetY()[i] > mYRightMaxOriginal)
-				mYRightMaxOriginal = data.GetY()[i];
-			else if (data.GetY()[i] < mYRightMinOriginal)
-				mYRightMinOriginal = data.GetY()[i];
-		}
+	mXMinOriginal = std::min(mXMinOriginal, extremes.xMin);
+	mXMaxOriginal = std::max(mXMaxOriginal, extremes.xMax);
+
+	if (yAxis == mAxisLeft)
+	{
+		mYLeftMinOriginal = std::min(mYLeftMinOriginal, extremes.yMin);
+		mYLeftMaxOriginal = std::max(mYLeftMaxOriginal, extremes.yMax);
+	}
+	else if (yAxis == mAxisRight)
+	{
+		mYRightMinOriginal = std::min(mYRightMinOriginal, extremes.yMin);
+		mYRightMaxOriginal = std::max(mYRightMaxOriginal, extremes.yMax);
 	}
 }
 
@@ -1538,6 +1855,7 @@ void PlotObject::SetXMin(const double &xMin)
 	else
 		mAutoScaleX = false;
 	mXMin = xMin;
+	Invalidate(Dirty::Limits);
 }
 
 //=============================================================================
@@ -1564,6 +1882,7 @@ void PlotObject::SetXMax(const double &xMax)
 	else
 		mAutoScaleX = false;
 	mXMax = xMax;
+	Invalidate(Dirty::Limits);
 }
 
 //=============================================================================
@@ -1590,6 +1909,7 @@ void PlotObject::SetLeftYMin(const double &yMin)
 	else
 		mAutoScaleLeftY = false;
 	mYLeftMin = yMin;
+	Invalidate(Dirty::Limits);
 }
 
 //=============================================================================
@@ -1616,6 +1936,7 @@ void PlotObject::SetLeftYMax(const double &yMax)
 	else
 		mAutoScaleLeftY = false;
 	mYLeftMax = yMax;
+	Invalidate(Dirty::Limits);
 }
 
 //=============================================================================
@@ -1642,6 +1963,7 @@ void PlotObject::SetRightYMin(const double &yMin)
 	else
 		mAutoScaleRightY = false;
 	mYRightMin = yMin;
+	Invalidate(Dirty::Limits);
 }
 
 //=============================================================================
@@ -1668,6 +1990,7 @@ void PlotObject::SetRightYMax(const double &yMax)
 	else
 		mAutoScaleRightY = false;
 	mYRightMax = yMax;
+	Invalidate(Dirty::Limits);
 }
 
 //=============================================================================
@@ -1695,6 +2018,7 @@ void PlotObject::ResetAutoScaling()
 	mXMajorResolution = 0.0;
 	mYLeftMajorResolution = 0.0;
 	mYRightMajorResolution = 0.0;
+	Invalidate(Dirty::Limits);
 }
 
 //=============================================================================
@@ -1721,15 +2045,19 @@ void PlotObject::ResetAutoScaling()
 void PlotObject::SetCurveProperties(const unsigned int &index, const Color &color,
 	const bool &visible, const bool &rightAxis, const double &lineSize, const int &markerSize)
 {
+	Axis* yAxis(rightAxis ? mAxisRight : mAxisLeft);
+
+	// Color and size changes only affect this curve, but visibility and axis
+	// assignment may change the axis limits
+	if (mPlotList[index]->GetIsVisible() != visible ||
+		mPlotList[index]->GetYAxis() != yAxis)
+		Invalidate(Dirty::Data);
+
 	mPlotList[index]->SetColor(color);
 	mPlotList[index]->SetVisibility(visible);
 	mPlotList[index]->SetLineSize(lineSize);
 	mPlotList[index]->SetMarkerSize(markerSize);
-
-	if (rightAxis)
-		mPlotList[index]->BindToYAxis(mAxisRight);
-	else
-		mPlotList[index]->BindToYAxis(mAxisLeft);
+	mPlotList[index]->BindToYAxis(yAxis);
 }
 
 //=============================================================================
@@ -1852,6 +2180,7 @@ void PlotObject::SetXLabel(wxString text)
 {
 	mAxisBottom->SetLabel(text);
 	mNeedScissorUpdate = true;
+	Invalidate(Dirty::Layout);
 }
 
 //=============================================================================
@@ -1898,6 +2227,7 @@ void PlotObject::SetLeftYLabel(wxString text)
 {
 	mAxisLeft->SetLabel(text);
 	mNeedScissorUpdate = true;
+	Invalidate(Dirty::Layout);
 }
 
 //=============================================================================
@@ -1920,6 +2250,7 @@ void PlotObject::SetRightYLabel(wxString text)
 {
 	mAxisRight->SetLabel(text);
 	mNeedScissorUpdate = true;
+	Invalidate(Dirty::Layout);
 }
 
 //=============================================================================
@@ -1942,6 +2273,40 @@ void PlotObject::SetTitle(wxString text)
 {
 	mTitleObject->SetText(text);
 	mNeedScissorUpdate = true;
+	Invalidate(Dirty::Layout);
+}
+
+//=============================================================================
+// Class:			PlotObject
+// Function:		SetStatisticsText
+//
+// Description:		Sets the text of the statistics overlay.  The overlay does
+//					not affect the plot layout.
+//
+// Input Arguments:
+//		text	= const wxString&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotObject::SetStatisticsText(const wxString& text)
+{
+	mStatisticsObject->SetVisibility(!text.IsEmpty());
+	if (text.IsEmpty())
+		return;
+
+	// Position is based on the font size instead of GetTextHeight(), which
+	// requires a current context
+	const double margin(5.0);// [pixels]
+	const double fontSize(12.0);// [pixels]
+	mStatisticsObject->SetText(text);
+	mStatisticsObject->SetPosition(mAxisLeft->GetOffsetFromWindowEdge() + margin,
+		mRenderer.GetRenderSize().GetHeight() - mAxisTop->GetOffsetFromWindowEdge()
+		- margin - fontSize);
 }
 
 //=============================================================================
@@ -2011,6 +2376,10 @@ void PlotObject::SetXLogarithmic(const bool &log)
 		return;
 
 	mAxisBottom->SetLogarithmicScale(log);
+
+	// Logarithmic scaling is applied when the curves are rendered, so the
+	// curve data does not need to be rebuilt
+	Invalidate(Dirty::Limits);
 }
 
 //=============================================================================
@@ -2035,6 +2404,10 @@ void PlotObject::SetLeftLogarithmic(const bool &log)
 		return;
 
 	mAxisLeft->SetLogarithmicScale(log);
+
+	// Logarithmic scaling is applied when the curves are rendered, so the
+	// curve data does not need to be rebuilt
+	Invalidate(Dirty::Limits);
 }
 
 //=============================================================================
@@ -2059,6 +2432,10 @@ void PlotObject::SetRightLogarithmic(const bool &log)
 		return;
 
 	mAxisRight->SetLogarithmicScale(log);
+
+	// Logarithmic scaling is applied when the curves are rendered, so the
+	// curve data does not need to be rebuilt
+	Invalidate(Dirty::Limits);
 }
 
 //=============================================================================
@@ -2079,11 +2456,63 @@ void PlotObject::SetRightLogarithmic(const bool &log)
 //=============================================================================
 void PlotObject::FormatCurves()
 {
+	// Curve visibility or axis assignments may have changed
+	if ((mDirty & Dirty::Data) != 0)
+		AssignCurveBatches();
+
+	// Curve geometry is independent of the axis limits and scaling (these are
+	// applied when rendering), but whether or not markers are drawn depends
+	// on the limits, so the batches must always re-evaluate their draw lists
+	mLeftCurveBatch->SetModified();
+	mRightCurveBatch->SetModified();
+
+	// Some curves only buffer the points within the visible area
+	if ((mDirty & (Dirty::Data | Dirty::Limits | Dirty::Layout | Dirty::Size)) != 0)
+	{
+		for (auto& plot : mPlotList)
+			plot->SetLimitsModified();
+	}
+
+	if ((mDirty & Dirty::Style) == 0)
+		return;
+
 	for (auto& plot : mPlotList)
 	{
-		plot->SetModified();
 		plot->SetPretty(mPretty);
+		plot->SetDecimation(mDecimation);
+	}
+}
+
+//=============================================================================
+// Class:			PlotObject
+// Function:		AssignCurveBatches
+//
+// Description:		Distributes the curves to the batch associated with the
+//					y-axis to which each curve is bound.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotObject::AssignCurveBatches()
+{
+	std::vector<PlotCurve*> leftCurves, rightCurves;
+	for (auto& plot : mPlotList)
+	{
+		if (plot->GetYAxis() == mAxisRight)
+			rightCurves.push_back(plot);
+		else
+			leftCurves.push_back(plot);
 	}
+
+	mLeftCurveBatch->SetCurves(leftCurves);
+	mRightCurveBatch->SetCurves(rightCurves);
 }
 
 //=============================================================================
@@ -2224,8 +2653,8 @@ void PlotObject::ComputeTransformationMatrices()
 		mAxisLeft->GetOffsetFromWindowEdge(),
 		mAxisBottom->GetOffsetFromWindowEdge(), 0.0));
 
-	int width, height;
-	mRenderer.GetSize(&width, &height);
+	const int width(mRenderer.GetRenderSize().GetWidth());
+	const int height(mRenderer.GetRenderSize().GetHeight());
 
 	const double plotAreaWidth{ static_cast<double>(
 		width - mAxisLeft->GetOffsetFromWindowEdge()
@@ -2279,10 +2708,10 @@ void PlotObject::UpdateScissorArea() const
 {
 	assert(!RenderWindow::GLHasError());
 
-	int width, height;
-	mRenderer.GetSize(&width, &height);
+	const int width(mRenderer.GetRenderSize().GetWidth());
+	const int height(mRenderer.GetRenderSize().GetHeight());
 	glEnable(GL_SCISSOR_TEST);
-	glScissor(mAxisLeft->GetOffsetFromWindowEdge(),
+	mRenderer.SetScissorBox(mAxisLeft->GetOffsetFromWindowEdge(),
 		mAxisBottom->GetOffsetFromWindowEdge(),
 		width - mAxisRight->GetOffsetFromWindowEdge() - mAxisLeft->GetOffsetFromWindowEdge(),
 		height - mAxisTop->GetOffsetFromWindowEdge() - mAxisBottom->GetOffsetFromWindowEdge());
@@ -2313,4 +2742,91 @@ bool PlotObject::CurveMarkersVisible(const unsigned int& i) const
 	return mPlotList[i]->NeedsMarkersDrawn();
 }
 
+//=============================================================================
+// Class:			PlotObject
+// Function:		CurveHasSortedX
+//
+// Description:		Checks to see if the specified curve has sorted x-values.
+//
+// Input Arguments:
+//		i	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//=============================================================================
+bool PlotObject::CurveHasSortedX(const unsigned int& i) const
+{
+	return mPlotList[i]->HasSortedX();
+}
+
+//=============================================================================
+// Class:			PlotObject
+// Function:		FindNearestSample
+//
+// Description:		Finds the data point closest to the specified location.
+//					The search ranges are converted to axis units for each
+//					curve, and the best point from each curve is compared by
+//					its distance in pixels.
+//
+// Input Arguments:
+//		x		= const int& [pixels]
+//		y		= const int& [pixels]
+//		radius	= const unsigned int& [pixels]
+//
+// Output Arguments:
+//		sample	= Sample&
+//
+// Return Value:
+//		bool, true if a point was found
+//
+//=============================================================================
+bool PlotObject::FindNearestSample(const int& x, const int& y,
+	const unsigned int& radius, Sample& sample) const
+{
+	const int r(static_cast<int>(radius));
+	const double xValue(mAxisBottom->PixelToValue(x));
+	const double xRange(std::max(fabs(mAxisBottom->PixelToValue(x + r) - xValue),
+		fabs(xValue - mAxisBottom->PixelToValue(x - r))));
+	if (!PlotMath::IsValid(xRange) || xRange <= 0.0)
+		return false;
+
+	double closest(static_cast<double>(radius * radius));
+	bool found(false);
+	unsigned int i, index;
+	for (i = 0; i < mPlotList.size(); ++i)
+	{
+		if (!mPlotList[i]->GetIsVisible())
+			continue;
+
+		const Axis& yAxis(*mPlotList[i]->GetYAxis());
+		const double yValue(yAxis.PixelToValue(y));
+		const double yRange(std::max(fabs(yAxis.PixelToValue(y + r) - yValue),
+			fabs(yValue - yAxis.PixelToValue(y - r))));
+		if (!PlotMath::IsValid(yRange) || yRange <= 0.0 ||
+			!mPlotList[i]->FindNearestPoint(xValue, yValue, xRange, yRange, index))
+			continue;
+
+		const double xPixel(mAxisBottom->ValueToPixel(mDataList[i]->GetX()[index]));
+		const double yPixel(yAxis.ValueToPixel(mDataList[i]->GetY()[index]));
+		const double distance((xPixel - x) * (xPixel - x) + (yPixel - y) * (yPixel - y));
+		if (distance > closest)
+			continue;
+
+		closest = distance;
+		sample.curve = i;
+		sample.index = index;
+		sample.x = mDataList[i]->GetX()[index];
+		sample.y = mDataList[i]->GetY()[index];
+		sample.xPixel = xPixel;
+		sample.yPixel = yPixel;
+		found = true;
+	}
+
+	return found;
+}
+
 }// namespace LibPlot2D
@@ -0,0 +1,339 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  sharedMemorySource.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Feeds streamed curves from an external process through shared
+//        memory.
+
+// Local headers
+#include "lp2d/gui/sharedMemorySource.h"
+#include "lp2d/gui/guiInterface.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			SharedMemorySource
+// Function:		SharedMemorySource
+//
+// Description:		Constructor for SharedMemorySource class.
+//
+// Input Arguments:
+//		guiInterface	= GuiInterface&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+SharedMemorySource::SharedMemorySource(GuiInterface& guiInterface)
+	: mGuiInterface(guiInterface)
+{
+}
+
+//=============================================================================
+// Class:			SharedMemorySource
+// Function:		~SharedMemorySource
+//
+// Description:		Destructor for SharedMemorySource class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+SharedMemorySource::~SharedMemorySource()
+{
+	Detach();
+}
+
+//=============================================================================
+// Class:			SharedMemorySource
+// Function:		Attach
+//
+// Description:		Attaches to the specified shared-memory object, adds a
+//					streamed curve for each channel and starts reading.
+//
+// Input Arguments:
+//		name		= const std::string&
+//		historySize	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success
+//
+//=============================================================================
+bool SharedMemorySource::Attach(const std::string& name,
+	const size_t& historySize)
+{
+	Detach();
+
+	if (!mRegion.Open(name))
+	{
+		mLastError = mRegion.GetLastError();
+		return false;
+	}
+
+	mHeader = static_cast<SharedMemoryProtocol::Header*>(mRegion.GetData());
+	if (!HeaderIsValid())
+	{
+		mHeader = nullptr;
+		mRegion.Close();
+		return false;
+	}
+
+	// Each channel can queue the entire ring, so nothing is dropped as long
+	// as the display keeps up with the producer on average
+	const size_t capacity(static_cast<size_t>(mHeader->blockCapacity) *
+		mHeader->blockCount);
+	unsigned int i;
+	for (i = 0; i < mHeader->channelCount; ++i)
+	{
+		const std::string channelName(mHeader->channels[i].name,
+			strnlen(mHeader->channels[i].name,
+			SharedMemoryProtocol::NameLength));
+		mChannels.push_back(mGuiInterface.AddStreamChannel(
+			wxString::FromUTF8(channelName.c_str()), historySize, capacity));
+	}
+
+	const uint64_t latest(mHeader->writeSequence.load(
+		std::memory_order_acquire));
+	const uint64_t oldest(latest < mHeader->blockCount ? 1 :
+		latest - mHeader->blockCount + 1);
+
+	mLostBlocks = 0;
+	mStopReading = false;
+	mReader = std::thread(&SharedMemorySource::ReadBlocks, this, oldest);
+
+	return true;
+}
+
+//=============================================================================
+// Class:			SharedMemorySource
+// Function:		Detach
+//
+// Description:		Stops reading and unmaps the shared-memory object.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SharedMemorySource::Detach()
+{
+	mStopReading = true;
+	if (mReader.joinable())
+		mReader.join();
+
+	mChannels.clear();
+	mHeader = nullptr;
+	mRegion.Close();
+}
+
+//=============================================================================
+// Class:			SharedMemorySource
+// Function:		IsProducerClosed
+//
+// Description:		Checks to see if the producer has closed the stream.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if closed (or not attached)
+//
+//=============================================================================
+bool SharedMemorySource::IsProducerClosed() const
+{
+	return !mHeader || mHeader->closed.load(std::memory_order_acquire) != 0;
+}
+
+//=============================================================================
+// Class:			SharedMemorySource
+// Function:		HeaderIsValid
+//
+// Description:		Checks the header of the mapped object against the
+//					protocol definition and the size of the mapping.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the header is valid
+//
+//=============================================================================
+bool SharedMemorySource::HeaderIsValid()
+{
+	if (mRegion.GetSize() < sizeof(SharedMemoryProtocol::Header))
+	{
+		mLastError = "Shared memory is too small to contain a header";
+		return false;
+	}
+	else if (mHeader->magic != SharedMemoryProtocol::Magic)
+	{
+		mLastError = "Shared memory does not contain LibPlot2D stream data";
+		return false;
+	}
+	else if (mHeader->version != SharedMemoryProtocol::Version)
+	{
+		mLastError = "Unsupported stream protocol version";
+		return false;
+	}
+	else if (mHeader->channelCount == 0 ||
+		mHeader->channelCount > SharedMemoryProtocol::MaxChannels ||
+		mHeader->blockCapacity == 0 || mHeader->blockCount == 0)
+	{
+		mLastError = "Invalid stream layout";
+		return false;
+	}
+	else if (mHeader->headerSize < sizeof(SharedMemoryProtocol::Header) ||
+		mHeader->blockSize < SharedMemoryProtocol::GetBlockSize(
+		mHeader->channelCount, mHeader->blockCapacity) ||
+		SharedMemoryProtocol::GetTotalSize(*mHeader) > mRegion.GetSize())
+	{
+		mLastError = "Stream layout does not match shared memory size";
+		return false;
+	}
+
+	return true;
+}
+
+//=============================================================================
+// Class:			SharedMemorySource
+// Function:		ReadBlocks
+//
+// Description:		Reader thread.  Copies each new block into the stream
+//					channels until stopped or until the producer closes the
+//					stream.
+//
+// Input Arguments:
+//		sequence	= uint64_t, sequence number of the first block to read
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SharedMemorySource::ReadBlocks(uint64_t sequence)
+{
+	const std::chrono::milliseconds pollPeriod(1);
+
+	std::vector<double> x(mHeader->blockCapacity);
+	std::vector<double> y(static_cast<size_t>(mHeader->blockCapacity) *
+		mHeader->channelCount);
+
+	while (!mStopReading)
+	{
+		const uint64_t latest(mHeader->writeSequence.load(
+			std::memory_order_acquire));
+		if (latest < sequence)
+		{
+			if (mHeader->closed.load(std::memory_order_acquire) != 0)
+				break;
+
+			std::this_thread::sleep_for(pollPeriod);
+			continue;
+		}
+
+		// Skip blocks which have already been overwritten
+		if (latest - sequence >= mHeader->blockCount)
+		{
+			const uint64_t oldest(latest - mHeader->blockCount + 1);
+			mLostBlocks += oldest - sequence;
+			sequence = oldest;
+		}
+
+		uint32_t count;
+		if (ReadBlock(sequence, x, y, count))
+		{
+			unsigned int i;
+			for (i = 0; i < mChannels.size(); ++i)
+				mChannels[i]->Push(x.data(),
+					y.data() + static_cast<size_t>(mHeader->blockCapacity) * i,
+					count);
+		}
+		else
+			++mLostBlocks;
+
+		++sequence;
+	}
+}
+
+//=============================================================================
+// Class:			SharedMemorySource
+// Function:		ReadBlock
+//
+// Description:		Copies one block out of shared memory.  Fails if the
+//					producer overwrites the block while it is being copied.
+//
+// Input Arguments:
+//		sequence	= const uint64_t&
+//
+// Output Arguments:
+//		x			= std::vector<double>&
+//		y			= std::vector<double>& (channels stored consecutively)
+//		count		= uint32_t&
+//
+// Return Value:
+//		bool, true if the block was copied intact
+//
+//=============================================================================
+bool SharedMemorySource::ReadBlock(const uint64_t& sequence,
+	std::vector<double>& x, std::vector<double>& y, uint32_t& count) const
+{
+	SharedMemoryProtocol::BlockHeader& block(
+		SharedMemoryProtocol::GetBlock(*mHeader, sequence));
+	if (block.sequence.load(std::memory_order_acquire) != sequence)
+		return false;
+
+	count = std::min(block.sampleCount, mHeader->blockCapacity);
+	std::memcpy(x.data(), SharedMemoryProtocol::GetXData(block),
+		sizeof(double) * count);
+
+	unsigned int i;
+	for (i = 0; i < mHeader->channelCount; ++i)
+		std::memcpy(y.data() + static_cast<size_t>(mHeader->blockCapacity) * i,
+			SharedMemoryProtocol::GetYData(*mHeader, block, i),
+			sizeof(double) * count);
+
+	// The copy must complete before checking that the block was not
+	// overwritten in the meantime
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return block.sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+}// namespace LibPlot2D
@@ -0,0 +1,266 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  smallMultiplesPanel.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Panel containing a grid of plots which share OpenGL resources.
+
+// GLEW headers
+#include <GL/glew.h>
+
+// wxWidgets headers
+#include <wx/sizer.h>
+
+// Local headers
+#include "lp2d/gui/smallMultiplesPanel.h"
+#include "lp2d/gui/plotListGrid.h"
+#include "lp2d/renderer/plotRenderer.h"
+
+// Standard C++ headers
+#include <cassert>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			SmallMultiplesPanel
+// Function:		SmallMultiplesPanel
+//
+// Description:		Constructor for SmallMultiplesPanel class.  The first plot
+//					creates the OpenGL context; all others share it.
+//
+// Input Arguments:
+//		parent	= wxWindow*
+//		id		= wxWindowID
+//		rows	= const unsigned int&
+//		columns	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+SmallMultiplesPanel::SmallMultiplesPanel(wxWindow* parent, wxWindowID id,
+	const unsigned int& rows, const unsigned int& columns)
+	: wxPanel(parent, id)
+{
+	assert(rows > 0 && columns > 0);
+
+	wxGLAttributes attributes;
+	attributes.PlatformDefaults().RGBA().DoubleBuffer().EndList();
+
+	wxGridSizer* sizer(new wxGridSizer(rows, columns, 0, 0));
+	unsigned int i;
+	for (i = 0; i < rows * columns; ++i)
+	{
+		mInterfaces.push_back(std::make_unique<GuiInterface>(nullptr));
+
+		// The plot list is never shown, but keeps track of curve colors,
+		// visibility, etc. exactly as it would for a stand-alone plot
+		PlotListGrid* grid(new PlotListGrid(*mInterfaces.back(), this,
+			wxID_ANY));
+		grid->Hide();
+
+		mRenderers.push_back(new PlotRenderer(*mInterfaces.back(), *this,
+			wxID_ANY, attributes));
+		if (i > 0)
+			mRenderers.back()->ShareContext(*mRenderers.front());
+
+		sizer->Add(mRenderers.back(), wxSizerFlags().Expand());
+	}
+
+	SetSizer(sizer);
+
+	Bind(X_LIMITS_CHANGED_EVENT, &SmallMultiplesPanel::OnXLimitsChanged,
+		this);
+}
+
+//=============================================================================
+// Class:			SmallMultiplesPanel
+// Function:		~SmallMultiplesPanel
+//
+// Description:		Destructor for SmallMultiplesPanel class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+SmallMultiplesPanel::~SmallMultiplesPanel()
+{
+	// Child windows are destroyed here (instead of by the wxWindow
+	// destructor) so they do not outlive the interfaces they reference
+	DestroyChildren();
+}
+
+//=============================================================================
+// Class:			SmallMultiplesPanel
+// Function:		GetInterface
+//
+// Description:		Returns the interface for the specified plot.
+//
+// Input Arguments:
+//		i	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		GuiInterface&
+//
+//=============================================================================
+GuiInterface& SmallMultiplesPanel::GetInterface(const unsigned int& i)
+{
+	assert(i < mInterfaces.size());
+	return *mInterfaces[i];
+}
+
+//=============================================================================
+// Class:			SmallMultiplesPanel
+// Function:		GetRenderer
+//
+// Description:		Returns the renderer for the specified plot.
+//
+// Input Arguments:
+//		i	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		PlotRenderer&
+//
+//=============================================================================
+PlotRenderer& SmallMultiplesPanel::GetRenderer(const unsigned int& i)
+{
+	assert(i < mRenderers.size());
+	return *mRenderers[i];
+}
+
+//=============================================================================
+// Class:			SmallMultiplesPanel
+// Function:		AddCurve
+//
+// Description:		Adds a curve to the specified plot.
+//
+// Input Arguments:
+//		i		= const unsigned int&
+//		data	= std::unique_ptr<Dataset2D>
+//		name	= const wxString&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SmallMultiplesPanel::AddCurve(const unsigned int& i,
+	std::unique_ptr<Dataset2D> data, const wxString& name)
+{
+	assert(i < mInterfaces.size());
+	mInterfaces[i]->AddCurve(std::move(data), name);
+}
+
+//=============================================================================
+// Class:			SmallMultiplesPanel
+// Function:		SetLinkXAxes
+//
+// Description:		Sets the flag indicating whether or not the x-axes are
+//					linked.  When linking, all plots are given the x-limits of
+//					the first plot.
+//
+// Input Arguments:
+//		link	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SmallMultiplesPanel::SetLinkXAxes(const bool& link)
+{
+	mLinkXAxes = link;
+	if (mLinkXAxes)
+		SynchronizeXAxes(*mRenderers.front());
+}
+
+//=============================================================================
+// Class:			SmallMultiplesPanel
+// Function:		SynchronizeXAxes
+//
+// Description:		Applies the x-limits of the specified plot to all other
+//					plots.
+//
+// Input Arguments:
+//		source	= const PlotRenderer&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SmallMultiplesPanel::SynchronizeXAxes(const PlotRenderer& source)
+{
+	if (mSynchronizing)
+		return;
+
+	mSynchronizing = true;
+	const double xMin(source.GetXMin());
+	const double xMax(source.GetXMax());
+	for (auto& renderer : mRenderers)
+	{
+		// Plots which already match are skipped, so the change events
+		// raised by the updated plots do not cause further updates
+		if (renderer == &source || (renderer->GetXMin() == xMin &&
+			renderer->GetXMax() == xMax))
+			continue;
+
+		renderer->SetXLimits(xMin, xMax);
+	}
+
+	mSynchronizing = false;
+}
+
+//=============================================================================
+// Class:			SmallMultiplesPanel
+// Function:		OnXLimitsChanged
+//
+// Description:		Event handler for changes to the x-limits of any plot.
+//
+// Input Arguments:
+//		event	= wxCommandEvent&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SmallMultiplesPanel::OnXLimitsChanged(wxCommandEvent& event)
+{
+	const PlotRenderer* source(dynamic_cast<PlotRenderer*>(
+		event.GetEventObject()));
+	if (mLinkXAxes && source)
+		SynchronizeXAxes(*source);
+}
+
+}// namespace LibPlot2D
@@ -0,0 +1,346 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  curveBufferPool.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Vertex buffer shared by all curve batches drawn with one context.
+
+// GLEW headers
+#include <GL/glew.h>
+
+// Local headers
+#include "lp2d/renderer/curveBufferPool.h"
+#include "lp2d/renderer/renderWindow.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <cassert>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			CurveBufferPool
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for the CurveBufferPool class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const GLsizei CurveBufferPool::mMinimumCapacity(4096);
+
+//=============================================================================
+// Class:			CurveBufferPool
+// Function:		CurveBufferPool
+//
+// Description:		Constructor for the CurveBufferPool class.  No OpenGL
+//					objects are created until space is first reserved.
+//
+// Input Arguments:
+//		positionLocation	= const GLuint&
+//		colorLocation		= const GLuint&
+//		dimension			= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+CurveBufferPool::CurveBufferPool(const GLuint& positionLocation,
+	const GLuint& colorLocation, const unsigned int& dimension)
+	: mPositionLocation(positionLocation), mColorLocation(colorLocation),
+	mDimension(dimension)
+{
+}
+
+//=============================================================================
+// Class:			CurveBufferPool
+// Function:		~CurveBufferPool
+//
+// Description:		Destructor for the CurveBufferPool class.  The context
+//					must be current.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+CurveBufferPool::~CurveBufferPool()
+{
+	if (mBuffer == 0)
+		return;
+
+	glDeleteBuffers(1, &mBuffer);
+	glDeleteVertexArrays(1, &mVertexArray);
+}
+
+//=============================================================================
+// Class:			CurveBufferPool
+// Function:		Reserve
+//
+// Description:		Ensures the specified client has a region large enough for
+//					the specified number of vertices.  New regions are given
+//					room to grow, so data which grows a little at a time (i.e.
+//					streamed data) rarely needs to be moved.
+//
+// Input Arguments:
+//		client	= const void*
+//		count	= const GLsizei&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		GLint, index of the first vertex in the client's region
+//
+//=============================================================================
+GLint CurveBufferPool::Reserve(const void* client, const GLsizei& count)
+{
+	auto it(mRegions.find(client));
+	if (it != mRegions.end() && it->second.capacity >= count)
+		return it->second.first;
+
+	const GLsizei capacity(count + count / 4);
+	if (mUsed + capacity > mCapacity)
+		Reallocate(std::max(2 * (mLive + capacity), mMinimumCapacity));
+
+	const Region region{ mUsed, capacity };
+	mUsed += capacity;
+	mLive += capacity;
+
+	// The iterator is still valid; re-allocation only modifies the regions
+	if (it != mRegions.end())
+	{
+		glBindBuffer(GL_COPY_READ_BUFFER, mBuffer);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, mBuffer);
+		CopyRegion(mBuffer, mCapacity, it->second.first, region.first,
+			it->second.capacity);
+		glBindBuffer(GL_COPY_READ_BUFFER, 0);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+		mLive -= it->second.capacity;
+		it->second = region;
+	}
+	else
+		mRegions[client] = region;
+
+	assert(!RenderWindow::GLHasError());
+	return region.first;
+}
+
+//=============================================================================
+// Class:			CurveBufferPool
+// Function:		Release
+//
+// Description:		Frees the region owned by the specified client.  The space
+//					is recovered the next time the buffer is re-allocated.
+//
+// Input Arguments:
+//		client	= const void*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void CurveBufferPool::Release(const void* client)
+{
+	const auto it(mRegions.find(client));
+	if (it == mRegions.end())
+		return;
+
+	mLive -= it->second.capacity;
+	mRegions.erase(it);
+
+	if (mRegions.empty())
+		mUsed = 0;
+}
+
+//=============================================================================
+// Class:			CurveBufferPool
+// Function:		Write
+//
+// Description:		Writes vertex data into the buffer.
+//
+// Input Arguments:
+//		first		= const GLint&
+//		count		= const GLsizei&
+//		positions	= const float*
+//		colors		= const float*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void CurveBufferPool::Write(const GLint& first, const GLsizei& count,
+	const float* positions, const float* colors) const
+{
+	assert(first >= 0 && first + count <= mCapacity);
+
+	glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+	glBufferSubData(GL_ARRAY_BUFFER, sizeof(GLfloat) * mDimension * first,
+		sizeof(GLfloat) * mDimension * count, positions);
+	glBufferSubData(GL_ARRAY_BUFFER,
+		sizeof(GLfloat) * (mDimension * mCapacity + 4 * first),
+		sizeof(GLfloat) * 4 * count, colors);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	RenderWindow::RecordUpload(count, sizeof(GLfloat) * count * (mDimension + 4));
+}
+
+//=============================================================================
+// Class:			CurveBufferPool
+// Function:		GetFirstVertex
+//
+// Description:		Returns the location of the specified client's region.
+//
+// Input Arguments:
+//		client	= const void*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		GLint, index of the first vertex, or -1 if the client has no region
+//
+//=============================================================================
+GLint CurveBufferPool::GetFirstVertex(const void* client) const
+{
+	const auto it(mRegions.find(client));
+	if (it == mRegions.end())
+		return -1;
+	return it->second.first;
+}
+
+//=============================================================================
+// Class:			CurveBufferPool
+// Function:		Reallocate
+//
+// Description:		Creates a new buffer of the specified size and copies the
+//					regions owned by clients into it (packed, so the space
+//					from released regions is recovered).
+//
+// Input Arguments:
+//		capacity	= const GLsizei& [vertices]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void CurveBufferPool::Reallocate(const GLsizei& capacity)
+{
+	const GLuint previousBuffer(mBuffer);
+	const GLsizei previousCapacity(mCapacity);
+
+	glGenBuffers(1, &mBuffer);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, mBuffer);
+	glBufferData(GL_COPY_WRITE_BUFFER,
+		sizeof(GLfloat) * capacity * (mDimension + 4), nullptr, GL_DYNAMIC_DRAW);
+	mCapacity = capacity;
+
+	mUsed = 0;
+	if (previousBuffer != 0)
+	{
+		glBindBuffer(GL_COPY_READ_BUFFER, previousBuffer);
+		for (auto& region : mRegions)
+		{
+			CopyRegion(previousBuffer, previousCapacity, region.second.first,
+				mUsed, region.second.capacity);
+			region.second.first = mUsed;
+			mUsed += region.second.capacity;
+		}
+
+		glBindBuffer(GL_COPY_READ_BUFFER, 0);
+		glDeleteBuffers(1, &previousBuffer);
+	}
+	else
+		glGenVertexArrays(1, &mVertexArray);
+
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	glBindVertexArray(mVertexArray);
+	glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+
+	glEnableVertexAttribArray(mPositionLocation);
+	glVertexAttribPointer(mPositionLocation, mDimension, GL_FLOAT, GL_FALSE,
+		0, 0);
+
+	glEnableVertexAttribArray(mColorLocation);
+	glVertexAttribPointer(mColorLocation, 4, GL_FLOAT, GL_FALSE, 0,
+		(void*)(sizeof(GLfloat) * mDimension * mCapacity));
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	assert(!RenderWindow::GLHasError());
+}
+
+//=============================================================================
+// Class:			CurveBufferPool
+// Function:		CopyRegion
+//
+// Description:		Copies the positions and colors of a region from the
+//					buffer bound to GL_COPY_READ_BUFFER into the current
+//					buffer (which must be bound to GL_COPY_WRITE_BUFFER).
+//
+// Input Arguments:
+//		sourceBuffer	= const GLuint&
+//		sourceCapacity	= const GLsizei& [vertices]
+//		sourceFirst		= const GLint&
+//		targetFirst		= const GLint&
+//		count			= const GLsizei& [vertices]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void CurveBufferPool::CopyRegion(const GLuint& sourceBuffer,
+	const GLsizei& sourceCapacity, const GLint& sourceFirst,
+	const GLint& targetFirst, const GLsizei& count) const
+{
+	assert(sourceBuffer != 0);
+	(void)sourceBuffer;
+
+	glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+		sizeof(GLfloat) * mDimension * sourceFirst,
+		sizeof(GLfloat) * mDimension * targetFirst,
+		sizeof(GLfloat) * mDimension * count);
+	glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+		sizeof(GLfloat) * (mDimension * sourceCapacity + 4 * sourceFirst),
+		sizeof(GLfloat) * (mDimension * mCapacity + 4 * targetFirst),
+		sizeof(GLfloat) * 4 * count);
+}
+
+}// namespace LibPlot2D
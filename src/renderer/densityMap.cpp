@@ -0,0 +1,519 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  densityMap.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Offscreen accumulation of per-pixel hit counts, displayed through a
+//        color map.
+
+// GLEW headers
+#include <GL/glew.h>
+
+// Local headers
+#include "lp2d/renderer/densityMap.h"
+#include "lp2d/renderer/renderWindow.h"
+
+// Standard C++ headers
+#include <cassert>
+#include <vector>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			DensityMap
+// Function:		mVertexShader
+//
+// Description:		Vertex shader for drawing a quad covering the viewport.
+//
+// Input Arguments:
+//		0	= position
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string DensityMap::mVertexShader(
+	"#version 400\n"
+	"\n"
+	"layout(location = 0) in vec2 position;\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"    gl_Position = vec4(position, 0.0, 1.0);\n"
+	"}\n"
+);
+
+//=============================================================================
+// Class:			DensityMap
+// Function:		mReductionVertexShader
+//
+// Description:		Vertex shader for finding the maximum count.  One point is
+//					drawn for each pixel in the density buffer, all at the
+//					center of a 1x1 target; the maximum is found by blending.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string DensityMap::mReductionVertexShader(
+	"#version 400\n"
+	"\n"
+	"uniform sampler2D density;\n"
+	"\n"
+	"out float count;\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"    ivec2 size = textureSize(density, 0);\n"
+	"    count = texelFetch(density, ivec2(gl_VertexID % size.x, gl_VertexID / size.x), 0).r;\n"
+	"    gl_Position = vec4(0.0, 0.0, 0.0, 1.0);\n"
+	"}\n"
+);
+
+//=============================================================================
+// Class:			DensityMap
+// Function:		mReductionFragmentShader
+//
+// Description:		Fragment shader for finding the maximum count.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string DensityMap::mReductionFragmentShader(
+	"#version 400\n"
+	"\n"
+	"in float count;\n"
+	"\n"
+	"out vec4 outputColor;\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"    outputColor = vec4(count);\n"
+	"}\n"
+);
+
+//=============================================================================
+// Class:			DensityMap
+// Function:		mDisplayFragmentShader
+//
+// Description:		Fragment shader for displaying the counts through the
+//					color map.  Counts are scaled logarithmically, so sparse
+//					regions remain visible next to dense regions.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string DensityMap::mDisplayFragmentShader(
+	"#version 400\n"
+	"\n"
+	"uniform sampler2D density;\n"
+	"uniform sampler2D maximum;\n"
+	"\n"
+	"out vec4 outputColor;\n"
+	"\n"
+	"const vec3 colors[5] = vec3[5](\n"
+	"    vec3(0.106, 0.047, 0.255),\n"
+	"    vec3(0.420, 0.094, 0.431),\n"
+	"    vec3(0.737, 0.216, 0.329),\n"
+	"    vec3(0.976, 0.557, 0.035),\n"
+	"    vec3(0.988, 0.998, 0.645));\n"
+	"\n"
+	"vec3 ColorMap(float t)\n"
+	"{\n"
+	"    float x = clamp(t, 0.0, 1.0) * 4.0;\n"
+	"    int i = min(int(x), 3);\n"
+	"    return mix(colors[i], colors[i + 1], x - float(i));\n"
+	"}\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"    float count = texelFetch(density, ivec2(gl_FragCoord.xy), 0).r;\n"
+	"    if (count <= 0.0)\n"
+	"        discard;\n"
+	"\n"
+	"    float maximumCount = max(texelFetch(maximum, ivec2(0, 0), 0).r, 1.0);\n"
+	"    outputColor = vec4(ColorMap(log(1.0 + count) / log(1.0 + maximumCount)), 1.0);\n"
+	"}\n"
+);
+
+//=============================================================================
+// Class:			DensityMap
+// Function:		~DensityMap
+//
+// Description:		Destructor for the DensityMap class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+DensityMap::~DensityMap()
+{
+	Free();
+}
+
+//=============================================================================
+// Class:			DensityMap
+// Function:		BeginAccumulation
+//
+// Description:		Binds and clears the accumulation buffer and enables
+//					additive blending.  Blending is enabled here rather than
+//					assuming it was left on by other primitives.
+//
+// Input Arguments:
+//		reuseMaximum	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if subsequent draws will be accumulated
+//
+//=============================================================================
+bool DensityMap::BeginAccumulation(const bool& reuseMaximum)
+{
+	// If the maximum could not be found (i.e. the first tile was too large
+	// for the buffer), all tiles must be drawn normally to avoid seams
+	if (reuseMaximum && !mMaximumValid)
+		return false;
+
+	mReuseMaximum = reuseMaximum;
+	if (!reuseMaximum)
+		mMaximumValid = false;
+
+	// The buffer covers everything up to the far corner of the viewport, so
+	// the viewport, scissor box and fragment coordinates need no adjustment
+	glGetIntegerv(GL_VIEWPORT, mPreviousViewport);
+	if (!Prepare(mPreviousViewport[0] + mPreviousViewport[2],
+		mPreviousViewport[1] + mPreviousViewport[3]))
+		return false;
+
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &mPreviousFramebuffer);
+	glGetIntegerv(GL_CURRENT_PROGRAM, &mPreviousProgram);
+	mScissorEnabled = glIsEnabled(GL_SCISSOR_TEST);
+	mBlendEnabled = glIsEnabled(GL_BLEND);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, mDensityFramebuffer);
+
+	// The scissor box applies to clears, too
+	glDisable(GL_SCISSOR_TEST);
+	glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+	glClear(GL_COLOR_BUFFER_BIT);
+	if (mScissorEnabled)
+		glEnable(GL_SCISSOR_TEST);
+
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_ONE, GL_ONE);
+
+	assert(!RenderWindow::GLHasError());
+	return true;
+}
+
+//=============================================================================
+// Class:			DensityMap
+// Function:		EndAccumulation
+//
+// Description:		Finds the maximum count (unless re-using the previous
+//					maximum), restores the previous state and draws the
+//					accumulated counts through the color map.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void DensityMap::EndAccumulation()
+{
+	glBindVertexArray(mVertexArray);
+
+	// Reduction pass
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, mDensityTexture);
+	if (!mReuseMaximum)
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, mMaximumFramebuffer);
+		glViewport(0, 0, 1, 1);
+		glDisable(GL_SCISSOR_TEST);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		glBlendEquation(GL_MAX);
+		glUseProgram(mReductionProgram);
+		glDrawArrays(GL_POINTS, 0, mWidth * mHeight);
+		glBlendEquation(GL_FUNC_ADD);
+		mMaximumValid = true;
+	}
+
+	// Display pass
+	glBindFramebuffer(GL_FRAMEBUFFER, mPreviousFramebuffer);
+	glViewport(mPreviousViewport[0], mPreviousViewport[1],
+		mPreviousViewport[2], mPreviousViewport[3]);
+	if (mScissorEnabled)
+		glEnable(GL_SCISSOR_TEST);
+
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	glUseProgram(mDisplayProgram);
+	glActiveTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, mMaximumTexture);
+	glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glBindVertexArray(0);
+	glUseProgram(mPreviousProgram);
+
+	if (mBlendEnabled == GL_FALSE)
+		glDisable(GL_BLEND);
+
+	assert(!RenderWindow::GLHasError());
+}
+
+//=============================================================================
+// Class:			DensityMap
+// Function:		Prepare
+//
+// Description:		Creates (or re-sizes) the offscreen buffers and builds the
+//					programs, if necessary.
+//
+// Input Arguments:
+//		width	= const GLint&
+//		height	= const GLint&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the buffers are available
+//
+//=============================================================================
+bool DensityMap::Prepare(const GLint& width, const GLint& height)
+{
+	if (mUnsupported || width <= 0 || height <= 0)
+		return false;
+
+	if (mReductionProgram == 0)
+		BuildPrograms();
+
+	if (mDensityFramebuffer != 0 && width == mWidth && height == mHeight)
+		return true;
+
+	// Images larger than the maximum texture size may still be drawn
+	// normally without giving up on later (smaller) buffers
+	GLint maximumSize;
+	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maximumSize);
+	if (width > maximumSize || height > maximumSize)
+		return false;
+
+	// The maximum is retained when the density buffer is re-sized, so it may
+	// be re-used (see BeginAccumulation())
+	if (!CreateTarget(width, height, mDensityFramebuffer, mDensityTexture) ||
+		(mMaximumFramebuffer == 0 &&
+		!CreateTarget(1, 1, mMaximumFramebuffer, mMaximumTexture)))
+	{
+		Free();
+		mUnsupported = true;// Don't try again
+		return false;
+	}
+
+	mWidth = width;
+	mHeight = height;
+
+	return true;
+}
+
+//=============================================================================
+// Class:			DensityMap
+// Function:		CreateTarget
+//
+// Description:		Creates (or re-sizes) a single-channel floating point
+//					texture and the framebuffer for rendering to it.
+//
+// Input Arguments:
+//		width	= const GLint&
+//		height	= const GLint&
+//
+// Output Arguments:
+//		framebuffer	= GLuint&
+//		texture		= GLuint&
+//
+// Return Value:
+//		bool, true if the framebuffer is complete
+//
+//=============================================================================
+bool DensityMap::CreateTarget(const GLint& width, const GLint& height,
+	GLuint& framebuffer, GLuint& texture) const
+{
+	if (framebuffer == 0)
+	{
+		glGenFramebuffers(1, &framebuffer);
+		glGenTextures(1, &texture);
+	}
+
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, width, height, 0, GL_RED,
+		GL_FLOAT, nullptr);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	GLint previousFramebuffer;
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+		GL_TEXTURE_2D, texture, 0);
+	const GLenum status(glCheckFramebufferStatus(GL_FRAMEBUFFER));
+	glBindFramebuffer(GL_FRAMEBUFFER, previousFramebuffer);
+
+	assert(!RenderWindow::GLHasError());
+
+	return status == GL_FRAMEBUFFER_COMPLETE;
+}
+
+//=============================================================================
+// Class:			DensityMap
+// Function:		BuildPrograms
+//
+// Description:		Builds the reduction and display programs and the quad
+//					covering the viewport.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void DensityMap::BuildPrograms()
+{
+	GLint previousProgram;
+	glGetIntegerv(GL_CURRENT_PROGRAM, &previousProgram);
+
+	std::vector<RenderWindow::ShaderSource> sources;
+	sources.push_back({ GL_VERTEX_SHADER, mReductionVertexShader });
+	sources.push_back({ GL_FRAGMENT_SHADER, mReductionFragmentShader });
+	mReductionProgram = RenderWindow::CreateCachedProgram(sources);
+
+	glUseProgram(mReductionProgram);
+	glUniform1i(glGetUniformLocation(mReductionProgram, "density"), 0);
+
+	sources.clear();
+	sources.push_back({ GL_VERTEX_SHADER, mVertexShader });
+	sources.push_back({ GL_FRAGMENT_SHADER, mDisplayFragmentShader });
+	mDisplayProgram = RenderWindow::CreateCachedProgram(sources);
+
+	glUseProgram(mDisplayProgram);
+	glUniform1i(glGetUniformLocation(mDisplayProgram, "density"), 0);
+	glUniform1i(glGetUniformLocation(mDisplayProgram, "maximum"), 1);
+	glUseProgram(previousProgram);
+
+	// Quad covering the entire viewport (in normalized device coordinates)
+	const GLfloat quad[] = { -1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f };
+
+	glGenVertexArrays(1, &mVertexArray);
+	glGenBuffers(1, &mVertexBuffer);
+	glBindVertexArray(mVertexArray);
+	glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+	glBindVertexArray(0);
+
+	assert(!RenderWindow::GLHasError());
+}
+
+//=============================================================================
+// Class:			DensityMap
+// Function:		Free
+//
+// Description:		Frees OpenGL resources.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void DensityMap::Free()
+{
+	if (mDensityFramebuffer != 0)
+	{
+		glDeleteFramebuffers(1, &mDensityFramebuffer);
+		glDeleteTextures(1, &mDensityTexture);
+		mDensityFramebuffer = 0;
+		mDensityTexture = 0;
+	}
+
+	if (mMaximumFramebuffer != 0)
+	{
+		glDeleteFramebuffers(1, &mMaximumFramebuffer);
+		glDeleteTextures(1, &mMaximumTexture);
+		mMaximumFramebuffer = 0;
+		mMaximumTexture = 0;
+	}
+
+	if (mReductionProgram != 0)
+	{
+		glDeleteProgram(mReductionProgram);
+		glDeleteProgram(mDisplayProgram);
+		glDeleteBuffers(1, &mVertexBuffer);
+		glDeleteVertexArrays(1, &mVertexArray);
+		mReductionProgram = 0;
+		mDisplayProgram = 0;
+		mVertexBuffer = 0;
+		mVertexArray = 0;
+	}
+
+	mWidth = 0;
+	mHeight = 0;
+}
+
+}// namespace LibPlot2D
@@ -0,0 +1,331 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  fontCache.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Process-wide cache of font faces and glyph atlas textures.
+
+// Standard C++ headers
+#include <cassert>
+#include <algorithm>
+#include <vector>
+#include <cstring>
+
+// GLEW headers
+#include <GL/glew.h>
+
+// Local headers
+#include "lp2d/renderer/fontCache.h"
+#include "lp2d/renderer/renderWindow.h"
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			FontCache
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for FontCache class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+FT_Library FontCache::mFt;
+std::map<std::string, FontCache::FaceEntry> FontCache::mFaces;
+std::map<FontCache::AtlasKey, FontCache::AtlasEntry> FontCache::mAtlases;
+
+//=============================================================================
+// Class:			FontCache
+// Function:		AcquireFace
+//
+// Description:		Loads the specified font file, or increments the reference
+//					count if it is already loaded.
+//
+// Input Arguments:
+//		fontFileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//=============================================================================
+bool FontCache::AcquireFace(const std::string& fontFileName)
+{
+	auto it(mFaces.find(fontFileName));
+	if (it != mFaces.end())
+	{
+		++it->second.referenceCount;
+		return true;
+	}
+
+	if (mFaces.empty())
+	{
+		if (FT_Init_FreeType(&mFt))
+			return false;
+	}
+
+	FaceEntry entry;
+	if (FT_New_Face(mFt, fontFileName.c_str(), 0, &entry.face))
+	{
+		if (mFaces.empty())
+			FT_Done_FreeType(mFt);
+		return false;
+	}
+
+	entry.referenceCount = 1;
+	mFaces.insert(std::make_pair(fontFileName, entry));
+	return true;
+}
+
+//=============================================================================
+// Class:			FontCache
+// Function:		ReleaseFace
+//
+// Description:		Decrements the reference count for the specified font
+//					file, and unloads the file if it is no longer used.
+//
+// Input Arguments:
+//		fontFileName	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FontCache::ReleaseFace(const std::string& fontFileName)
+{
+	auto it(mFaces.find(fontFileName));
+	assert(it != mFaces.end());
+	assert(it->second.referenceCount > 0);
+
+	if (--it->second.referenceCount > 0)
+		return;
+
+	FT_Done_Face(it->second.face);
+	mFaces.erase(it);
+
+	if (mFaces.empty())
+		FT_Done_FreeType(mFt);
+}
+
+//=============================================================================
+// Class:			FontCache
+// Function:		AcquireAtlas
+//
+// Description:		Returns the atlas for the specified font and size,
+//					generating it if it does not yet exist.
+//
+// Input Arguments:
+//		fontFileName	= const std::string&
+//		width			= const unsigned int&
+//		height			= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const Atlas*, nullptr on failure
+//
+//=============================================================================
+const FontCache::Atlas* FontCache::AcquireAtlas(
+	const std::string& fontFileName, const unsigned int& width,
+	const unsigned int& height)
+{
+	const AtlasKey key(fontFileName, width, height);
+	auto it(mAtlases.find(key));
+	if (it != mAtlases.end())
+	{
+		++it->second.referenceCount;
+		return &it->second.atlas;
+	}
+
+	const auto faceIt(mFaces.find(fontFileName));
+	assert(faceIt != mFaces.end());
+
+	AtlasEntry entry;
+	if (!GenerateAtlas(faceIt->second.face, width, height, entry.atlas))
+		return nullptr;
+
+	entry.referenceCount = 1;
+	it = mAtlases.insert(std::make_pair(key, std::move(entry))).first;
+	return &it->second.atlas;
+}
+
+//=============================================================================
+// Class:			FontCache
+// Function:		ReleaseAtlas
+//
+// Description:		Decrements the reference count for the specified atlas,
+//					and frees the texture if it is no longer used.
+//
+// Input Arguments:
+//		atlas	= const Atlas*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FontCache::ReleaseAtlas(const Atlas* atlas)
+{
+	auto it(std::find_if(mAtlases.begin(), mAtlases.end(),
+		[atlas](const std::pair<const AtlasKey, AtlasEntry>& entry)
+	{
+		return &entry.second.atlas == atlas;
+	}));
+	assert(it != mAtlases.end());
+	assert(it->second.referenceCount > 0);
+
+	if (--it->second.referenceCount > 0)
+		return;
+
+	if (glIsTexture(it->second.atlas.textureId))
+		glDeleteTextures(1, &it->second.atlas.textureId);
+
+	mAtlases.erase(it);
+}
+
+//=============================================================================
+// Class:			FontCache
+// Function:		GenerateAtlas
+//
+// Description:		Rasterizes the set of glyphs and packs them (in rows) into
+//					a single texture.
+//
+// Input Arguments:
+//		face	= FT_Face
+//		width	= const unsigned int&
+//		height	= const unsigned int&
+//
+// Output Arguments:
+//		atlas	= Atlas&
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//=============================================================================
+bool FontCache::GenerateAtlas(FT_Face face, const unsigned int& width,
+	const unsigned int& height, Atlas& atlas)
+{
+	assert(!RenderWindow::GLHasError());
+
+	// The face is shared by all sizes, so the size must be set every time
+	if (FT_Set_Pixel_Sizes(face, width, height))
+		return false;
+
+	if (FT_Select_Charmap(face, FT_ENCODING_UNICODE))
+		return false;
+
+	const unsigned int glyphCount(128);
+	const unsigned int padding(1);// Prevents bleeding with linear filtering
+	std::vector<std::vector<unsigned char>> bitmaps(glyphCount);
+	std::vector<Glyph> glyphs(glyphCount);
+	unsigned int area(0), maxXSize(0);
+
+	// First loop rasterizes the glyphs and determines the required image size
+	unsigned int c;
+	for (c = 0; c < glyphCount; ++c)
+	{
+		if (FT_Load_Char(face, c, FT_LOAD_RENDER))
+			return false;
+
+		const FT_Bitmap& bitmap(face->glyph->bitmap);
+		Glyph& g(glyphs[c]);
+		g.xSize = bitmap.width;
+		g.ySize = bitmap.rows;
+		g.xBearing = face->glyph->bitmap_left;
+		g.yBearing = face->glyph->bitmap_top;
+		g.advance = face->glyph->advance.x;
+
+		bitmaps[c].resize(bitmap.width * bitmap.rows);
+		unsigned int row;
+		for (row = 0; row < bitmap.rows; ++row)
+			memcpy(bitmaps[c].data() + row * bitmap.width,
+				bitmap.buffer + row * bitmap.pitch, bitmap.width);
+
+		area += (bitmap.width + padding) * (bitmap.rows + padding);
+		maxXSize = std::max(maxXSize, bitmap.width);
+	}
+
+	atlas.width = 1;
+	while (atlas.width * atlas.width < area)
+		atlas.width <<= 1;
+	atlas.width = std::max(atlas.width, maxXSize + 2 * padding);
+
+	// Second loop packs the glyphs into rows
+	std::vector<unsigned int> xPositions(glyphCount), yPositions(glyphCount);
+	unsigned int x(padding), y(padding), rowHeight(0);
+	for (c = 0; c < glyphCount; ++c)
+	{
+		if (x + glyphs[c].xSize + padding > atlas.width)
+		{
+			x = padding;
+			y += rowHeight + padding;
+			rowHeight = 0;
+		}
+
+		xPositions[c] = x;
+		yPositions[c] = y;
+		x += glyphs[c].xSize + padding;
+		rowHeight = std::max(rowHeight, static_cast<unsigned int>(glyphs[c].ySize));
+	}
+	atlas.height = y + rowHeight + padding;
+
+	// Third loop copies the glyphs into the image and stores the coordinates
+	std::vector<unsigned char> image(atlas.width * atlas.height, 0);
+	for (c = 0; c < glyphCount; ++c)
+	{
+		Glyph& g(glyphs[c]);
+		int row;
+		for (row = 0; row < g.ySize; ++row)
+			memcpy(image.data() + (yPositions[c] + row) * atlas.width + xPositions[c],
+				bitmaps[c].data() + row * g.xSize, g.xSize);
+
+		g.sLeft = static_cast<float>(xPositions[c]) / atlas.width;
+		g.sRight = static_cast<float>(xPositions[c] + g.xSize) / atlas.width;
+		g.tTop = static_cast<float>(yPositions[c]) / atlas.height;
+		g.tBottom = static_cast<float>(yPositions[c] + g.ySize) / atlas.height;
+
+		atlas.glyphs.insert(std::make_pair(static_cast<char>(c), g));
+	}
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glGenTextures(1, &atlas.textureId);
+	glBindTexture(GL_TEXTURE_2D, atlas.textureId);
+
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, atlas.width, atlas.height,
+		0, GL_RED, GL_UNSIGNED_BYTE, image.data());
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	assert(!RenderWindow::GLHasError());
+	return true;
+}
+
+}// namespace LibPlot2D
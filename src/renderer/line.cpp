@@ -120,10 +120,10 @@ void Line::Build(const double &x1, const double &y1,const double &x2,
 {
 	if (mPretty)
 	{
-		std::vector<std::pair<double, double>> v;
-		v.push_back(std::make_pair(x1, y1));
-		v.push_back(std::make_pair(x2, y2));
-		DoPrettyDraw(v, update, bufferInfo);
+		mPoints.resize(2);
+		mPoints[0] = std::make_pair(x1, y1);
+		mPoints[1] = std::make_pair(x2, y2);
+		DoPrettyDraw(mPoints, update, bufferInfo);
 	}
 	else
 		DoUglyDraw(x1, y1, x2, y2, update, bufferInfo);
@@ -150,15 +150,15 @@ void Line::Build(
 	const std::vector<std::pair<unsigned int, unsigned int>> &points,
 	Primitive::BufferInfo& bufferInfo, const UpdateMethod& update) const
 {
-	std::vector<std::pair<double, double>> dPoints(points.size());
+	mPoints.resize(points.size());
 	unsigned int i;
 	for (i = 0; i < points.size(); ++i)
 	{
-		dPoints[i].first = static_cast<double>(points[i].first);
-		dPoints[i].second = static_cast<double>(points[i].second);
+		mPoints[i].first = static_cast<double>(points[i].first);
+		mPoints[i].second = static_cast<double>(points[i].second);
 	}
 	
-	Build(dPoints, bufferInfo, update);
+	Build(mPoints, bufferInfo, update);
 }
 
 //=============================================================================
@@ -213,14 +213,14 @@ void Line::Build(const std::vector<double>& x, const std::vector<double>& y,
 {
 	assert(x.size() == y.size());
 
-	std::vector<std::pair<double, double>> dPoints(x.size());
+	mPoints.resize(x.size());
 	unsigned int i;
-	for (i = 0; i < dPoints.size(); ++i)
+	for (i = 0; i < mPoints.size(); ++i)
 	{
-		dPoints[i].first = x[i];
-		dPoints[i].second = y[i];
+		mPoints[i].first = x[i];
+		mPoints[i].second = y[i];
 	}
-	Build(dPoints, bufferInfo, update);
+	Build(mPoints, bufferInfo, update);
 }
 
 //=============================================================================
@@ -352,6 +352,7 @@ void Line::ComputeOffsets(const double &xPrior, const double &yPrior,
 // Input Arguments:
 //		vertexCount		= const unsigned int&
 //		triangleCount	= const unsigned int&
+//		update			= const UpdateMethod&
 //
 // Output Arguments:
 //		bufferInfo	= Primitive::BufferInfo&
@@ -361,9 +362,12 @@ void Line::ComputeOffsets(const double &xPrior, const double &yPrior,
 //
 //=============================================================================
 void Line::AllocateBuffer(const unsigned int& vertexCount,
-	const unsigned int& triangleCount, Primitive::BufferInfo& bufferInfo) const
+	const unsigned int& triangleCount, const UpdateMethod& update,
+	Primitive::BufferInfo& bufferInfo) const
 {
-	bufferInfo.GetOpenGLIndices(triangleCount > 0);
+	// Caller is responsible for OpenGL objects with manual updates
+	if (update == UpdateMethod::Immediate)
+		bufferInfo.GetOpenGLIndices(triangleCount > 0);
 
 	bufferInfo.vertexCount = vertexCount;
 	bufferInfo.vertexBuffer.resize(bufferInfo.vertexCount
@@ -400,7 +404,7 @@ void Line::DoUglyDraw(const double &x1, const double &y1,
 	const double &x2, const double &y2, const UpdateMethod& update,
 	Primitive::BufferInfo& bufferInfo) const
 {
-	AllocateBuffer(2, 0, bufferInfo);
+	AllocateBuffer(2, 0, update, bufferInfo);
 
 	bufferInfo.vertexBuffer[0] = static_cast<float>(x1);
 	bufferInfo.vertexBuffer[1] = static_cast<float>(y1);
@@ -425,6 +429,8 @@ void Line::DoUglyDraw(const double &x1, const double &y1,
 	glBindBuffer(GL_ARRAY_BUFFER, bufferInfo.GetVertexBufferIndex());
 	glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * bufferInfo.vertexBuffer.size(),
 		bufferInfo.vertexBuffer.data(), mHint);
+	RenderWindow::RecordUpload(bufferInfo.vertexCount,
+		sizeof(GLfloat) * bufferInfo.vertexBuffer.size());
 
 	glEnableVertexAttribArray(mRenderWindow.GetDefaultPositionLocation());
 	glVertexAttribPointer(mRenderWindow.GetDefaultPositionLocation(), 2, GL_FLOAT, GL_FALSE, 0, 0);
@@ -460,7 +466,7 @@ void Line::DoUglyDraw(const double &x1, const double &y1,
 void Line::DoUglyDraw(const std::vector<std::pair<double, double>> &points,
 	const UpdateMethod& update, Primitive::BufferInfo& bufferInfo) const
 {
-	AllocateBuffer(points.size(), 0, bufferInfo);
+	AllocateBuffer(points.size(), 0, update, bufferInfo);
 
 	const unsigned int dimension(mRenderWindow.GetVertexDimension());
 	const unsigned int start(points.size() * dimension);
@@ -484,6 +490,8 @@ void Line::DoUglyDraw(const std::vector<std::pair<double, double>> &points,
 	glBindBuffer(GL_ARRAY_BUFFER, bufferInfo.GetVertexBufferIndex());
 	glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * bufferInfo.vertexBuffer.size(),
 		bufferInfo.vertexBuffer.data(), mHint);
+	RenderWindow::RecordUpload(bufferInfo.vertexCount,
+		sizeof(GLfloat) * bufferInfo.vertexBuffer.size());
 
 	glEnableVertexAttribArray(mRenderWindow.GetDefaultPositionLocation());
 	glVertexAttribPointer(mRenderWindow.GetDefaultPositionLocation(), 2, GL_FLOAT, GL_FALSE, 0, 0);
@@ -519,8 +527,6 @@ void Line::DoUglyDraw(const std::vector<std::pair<double, double>> &points,
 void Line::DoPrettyDraw(const std::vector<std::pair<double, double>> &points,
 	const UpdateMethod& update, Primitive::BufferInfo& bufferInfo) const
 {
-	std::vector<Offsets> offsets(points.size());
-
 	/* Draw the line as follows:
 
 	3+----+7
@@ -541,7 +547,7 @@ void Line::DoPrettyDraw(const std::vector<std::pair<double, double>> &points,
 	0+----+4
 	*/
 
-	AllocateBuffer(points.size() * 4, 6 * (points.size() - 1), bufferInfo);
+	AllocateBuffer(points.size() * 4, 6 * (points.size() - 1), update, bufferInfo);
 	AssignVertexData(points, LineStyle::Continuous, bufferInfo);
 
 	unsigned int i;
@@ -580,6 +586,8 @@ void Line::DoPrettyDraw(const std::vector<std::pair<double, double>> &points,
 	glBindBuffer(GL_ARRAY_BUFFER, bufferInfo.GetVertexBufferIndex());
 	glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * bufferInfo.vertexBuffer.size(),
 		bufferInfo.vertexBuffer.data(), mHint);
+	RenderWindow::RecordUpload(bufferInfo.vertexCount,
+		sizeof(GLfloat) * bufferInfo.vertexBuffer.size());
 
 	glEnableVertexAttribArray(mRenderWindow.GetDefaultPositionLocation());
 	glVertexAttribPointer(mRenderWindow.GetDefaultPositionLocation(),
@@ -592,6 +600,7 @@ void Line::DoPrettyDraw(const std::vector<std::pair<double, double>> &points,
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferInfo.GetIndexBufferIndex());
 	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * bufferInfo.indexBuffer.size(),
 		bufferInfo.indexBuffer.data(), mHint);
+	RenderWindow::RecordUpload(0, sizeof(GLuint) * bufferInfo.indexBuffer.size());
 
 	glBindVertexArray(0);
 
@@ -640,7 +649,7 @@ void Line::DoPrettySegmentDraw(const std::vector<std::pair<double, double>> &poi
 	*/
 
 	assert(points.size() % 2 == 0);
-	AllocateBuffer(points.size() * 4, 6 * (points.size() / 2), bufferInfo);
+	AllocateBuffer(points.size() * 4, 6 * (points.size() / 2), update, bufferInfo);
 	AssignVertexData(points, LineStyle::Segments, bufferInfo);
 
 	unsigned int i;
@@ -679,6 +688,8 @@ void Line::DoPrettySegmentDraw(const std::vector<std::pair<double, double>> &poi
 	glBindBuffer(GL_ARRAY_BUFFER, bufferInfo.GetVertexBufferIndex());
 	glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * bufferInfo.vertexBuffer.size(),
 		bufferInfo.vertexBuffer.data(), mHint);
+	RenderWindow::RecordUpload(bufferInfo.vertexCount,
+		sizeof(GLfloat) * bufferInfo.vertexBuffer.size());
 
 	glEnableVertexAttribArray(mRenderWindow.GetDefaultPositionLocation());
 	glVertexAttribPointer(mRenderWindow.GetDefaultPositionLocation(),
@@ -691,6 +702,7 @@ void Line::DoPrettySegmentDraw(const std::vector<std::pair<double, double>> &poi
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferInfo.GetIndexBufferIndex());
 	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * bufferInfo.indexBuffer.size(),
 		bufferInfo.indexBuffer.data(), mHint);
+	RenderWindow::RecordUpload(0, sizeof(GLuint) * bufferInfo.indexBuffer.size());
 
 	glBindVertexArray(0);
 
@@ -717,7 +729,7 @@ void Line::DoPrettySegmentDraw(const std::vector<std::pair<double, double>> &poi
 void Line::AssignVertexData(const std::vector<std::pair<double, double>>& points,
 	const LineStyle& style, Primitive::BufferInfo& bufferInfo) const
 {
-	std::vector<Offsets> offsets(points.size());
+	mOffsets.resize(points.size());
 	const unsigned int dimension(mRenderWindow.GetVertexDimension());
 	const unsigned int colorStart(dimension * 4 * points.size());
 	unsigned int i;
@@ -725,31 +737,31 @@ void Line::AssignVertexData(const std::vector<std::pair<double, double>>& points
 	{
 		if (i == 0 || (style == LineStyle::Segments && i % 2 == 0))
 			ComputeOffsets(points[i].first, points[i].second, points[i + 1].first,
-				points[i + 1].second, offsets[i].dxLine, offsets[i].dyLine,
-				offsets[i].dxEdge, offsets[i].dyEdge);
+				points[i + 1].second, mOffsets[i].dxLine, mOffsets[i].dyLine,
+				mOffsets[i].dxEdge, mOffsets[i].dyEdge);
 		else if (style == LineStyle::Segments)
-			offsets[i] = offsets[i - 1];
+			mOffsets[i] = mOffsets[i - 1];
 		else if (i == points.size() - 1)
 			ComputeOffsets(points[i - 1].first, points[i - 1].second, points[i].first,
-				points[i].second, offsets[i].dxLine, offsets[i].dyLine,
-				offsets[i].dxEdge, offsets[i].dyEdge);
+				points[i].second, mOffsets[i].dxLine, mOffsets[i].dyLine,
+				mOffsets[i].dxEdge, mOffsets[i].dyEdge);
 		else
 			ComputeOffsets(points[i - 1].first, points[i - 1].second,
 				points[i].first, points[i].second, points[i + 1].first,
-				points[i + 1].second, offsets[i].dxLine, offsets[i].dyLine,
-				offsets[i].dxEdge, offsets[i].dyEdge);
+				points[i + 1].second, mOffsets[i].dxLine, mOffsets[i].dyLine,
+				mOffsets[i].dxEdge, mOffsets[i].dyEdge);
 
-		bufferInfo.vertexBuffer[i * dimension * 4] = static_cast<float>((points[i].first + offsets[i].dxEdge));
-		bufferInfo.vertexBuffer[i * dimension * 4 + 1] = static_cast<float>((points[i].second + offsets[i].dyEdge));
+		bufferInfo.vertexBuffer[i * dimension * 4] = static_cast<float>((points[i].first + mOffsets[i].dxEdge));
+		bufferInfo.vertexBuffer[i * dimension * 4 + 1] = static_cast<float>((points[i].second + mOffsets[i].dyEdge));
 
-		bufferInfo.vertexBuffer[i * dimension * 4 + dimension] = static_cast<float>((points[i].first + offsets[i].dxLine));
-		bufferInfo.vertexBuffer[i * dimension * 4 + dimension + 1] = static_cast<float>((points[i].second + offsets[i].dyLine));
+		bufferInfo.vertexBuffer[i * dimension * 4 + dimension] = static_cast<float>((points[i].first + mOffsets[i].dxLine));
+		bufferInfo.vertexBuffer[i * dimension * 4 + dimension + 1] = static_cast<float>((points[i].second + mOffsets[i].dyLine));
 
-		bufferInfo.vertexBuffer[i * dimension * 4 + 2 * dimension] = static_cast<float>((points[i].first - offsets[i].dxLine));
-		bufferInfo.vertexBuffer[i * dimension * 4 + 2 * dimension + 1] = static_cast<float>((points[i].second - offsets[i].dyLine));
+		bufferInfo.vertexBuffer[i * dimension * 4 + 2 * dimension] = static_cast<float>((points[i].first - mOffsets[i].dxLine));
+		bufferInfo.vertexBuffer[i * dimension * 4 + 2 * dimension + 1] = static_cast<float>((points[i].second - mOffsets[i].dyLine));
 
-		bufferInfo.vertexBuffer[i * dimension * 4 + 3 * dimension] = static_cast<float>((points[i].first - offsets[i].dxEdge));
-		bufferInfo.vertexBuffer[i * dimension * 4 + 3 * dimension + 1] = static_cast<float>((points[i].second - offsets[i].dyEdge));
+		bufferInfo.vertexBuffer[i * dimension * 4 + 3 * dimension] = static_cast<float>((points[i].first - mOffsets[i].dxEdge));
+		bufferInfo.vertexBuffer[i * dimension * 4 + 3 * dimension + 1] = static_cast<float>((points[i].second - mOffsets[i].dyEdge));
 
 		bufferInfo.vertexBuffer[colorStart + i * 16] = static_cast<float>(mBackgroundColor.GetRed());
 		bufferInfo.vertexBuffer[colorStart + i * 16 + 1] = static_cast<float>(mBackgroundColor.GetGreen());
@@ -793,6 +805,7 @@ void Line::DoUglyDraw(const unsigned int& vertexCount)
 {
 	assert(vertexCount > 0);
 	glDrawArrays(GL_LINE_STRIP, 0, vertexCount);// TODO:  Memory leak here
+	RenderWindow::RecordDrawCalls();
 	glLineWidth(1.0f);// TODO:  OGL4 Better way to do this? (prevent all lines after this from being drawn at this line's width)  Maybe include in vertex attrib array?
 	// Is it better to not even have ugly lines now?
 
@@ -819,6 +832,7 @@ void Line::DoUglySegmentDraw(const unsigned int& vertexCount)
 {
 	assert(vertexCount > 0);
 	glDrawArrays(GL_LINES, 0, vertexCount);
+	RenderWindow::RecordDrawCalls();
 	glLineWidth(1.0f);// TODO:  OGL4 Better way to do this? (prevent all lines after this from being drawn at this line's width)  Maybe include in vertex attrib array?
 	// Is it better to not even have ugly lines now?
 
@@ -845,6 +859,7 @@ void Line::DoPrettyDraw(const unsigned int& indexCount)
 {
 	assert(indexCount > 0);
 	glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, 0);
+	RenderWindow::RecordDrawCalls();
 
 	assert(!RenderWindow::GLHasError());
 }
@@ -39,6 +39,8 @@
 #include "lp2d/utilities/math/plotMath.h"
 #include "lp2d/utilities/guiUtilities.h"
 
+wxDEFINE_EVENT(X_LIMITS_CHANGED_EVENT, wxCommandEvent);
+
 namespace LibPlot2D
 {
 
@@ -60,12 +62,18 @@ namespace LibPlot2D
 //=============================================================================
 const unsigned int PlotRenderer::mMaxXTicks(7);
 const unsigned int PlotRenderer::mMaxYTicks(10);
+const unsigned int PlotRenderer::mMaxAdaptiveQualityLevel(7);
+const unsigned int PlotRenderer::mHoverRadius(20);
+const std::string PlotRenderer::mLogarithmicName("logarithmic");
 
 //=============================================================================
 // Class:			PlotRenderer
 // Function:		defaultVertexShader
 //
-// Description:		Default vertex shader.
+// Description:		Default vertex shader.  Positions are scaled
+//					logarithmically (per-component) according to the
+//					logarithmic uniform, so curve data can be buffered without
+//					modification.
 //
 // Input Arguments:
 //		0	= position
@@ -82,6 +90,7 @@ const std::string PlotRenderer::mDefaultVertexShader(
 	"\n"
 	"uniform mat4 modelviewMatrix;\n"
 	"uniform mat4 projectionMatrix;\n"
+	"uniform bvec2 logarithmic;\n"
 	"\n"
 	"layout(location = 0) in vec2 position;\n"
 	"layout(location = 1) in vec4 color;\n"
@@ -91,7 +100,8 @@ const std::string PlotRenderer::mDefaultVertexShader(
 	"void main()\n"
 	"{\n"
 	"    vertexColor = color;\n"
-	"    gl_Position = projectionMatrix * modelviewMatrix * vec4(position, 0.0, 1.0);\n"
+	"    vec2 scaledPosition = mix(position, log2(position) * 0.30102999566, logarithmic);\n"
+	"    gl_Position = projectionMatrix * modelviewMatrix * vec4(scaledPosition, 0.0, 1.0);\n"
 	"}\n"
 );
 
@@ -120,6 +130,7 @@ PlotRenderer::PlotRenderer(GuiInterface& guiInterface, wxWindow &parent,
 	wxDefaultPosition, wxDefaultSize), mGuiInterface(guiInterface)
 {
 	SetView3D(false);
+	SetCacheStaticLayer(true);
 	SetDropTarget(static_cast<wxDropTarget*>(new DropTarget(guiInterface)));
 	CreateActors();
 	guiInterface.SetRenderWindow(this);
@@ -220,6 +231,209 @@ END_EVENT_TABLE()
 //
 //=============================================================================
 void PlotRenderer::UpdateDisplay()
+{
+	UpdatePlot();
+	Refresh();
+	Update();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		RequestUpdateDisplay
+//
+// Description:		Requests an update of the displayed plots.  The update is
+//					performed at the next paint event, so any number of
+//					requests made between frames (i.e. while handling a burst
+//					of mouse events) results in a single update.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::RequestUpdateDisplay()
+{
+	mPlotUpdatePending = true;
+	Refresh();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		ProcessPendingUpdates
+//
+// Description:		Performs any updates requested since the last frame.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::ProcessPendingUpdates()
+{
+	if (mPlotUpdatePending)
+	{
+		if (mDragging && (mCurveQuality & CurveQuality::Adaptive) != 0)
+			UpdateAdaptiveCurveQuality();
+		UpdatePlot();
+	}
+	else if (mCursorValuesUpdatePending)
+	{
+		mGuiInterface.UpdateCursorValues(GetLeftCursorVisible(),
+			GetRightCursorVisible(), GetLeftCursorValue(), GetRightCursorValue());
+		mCursorValuesUpdatePending = false;
+	}
+
+	// Any number of mouse moves between frames results in a single search
+	if (mHoverUpdatePending)
+		UpdateHoverReadout();
+
+	if (mStatisticsOverlay)
+		UpdateStatisticsOverlay();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		UseStaticCurveQuality
+//
+// Description:		Configures the plot to render curves at the quality
+//					specified for static (not interacting) display.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::UseStaticCurveQuality()
+{
+	mDragging = false;
+	mPlot->SetPrettyCurves((mCurveQuality & CurveQuality::HighStatic) != 0);
+	mPlot->SetCurveDecimation(1);
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		UseDragCurveQuality
+//
+// Description:		Configures the plot to render curves at the quality
+//					specified for display while dragging.  For adaptive
+//					quality, the quality level is updated once per frame in
+//					ProcessPendingUpdates().
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::UseDragCurveQuality()
+{
+	if ((mCurveQuality & CurveQuality::Adaptive) != 0)
+	{
+		// Start from the level that was sufficient during the last drag
+		if (!mDragging)
+			ApplyAdaptiveCurveQuality();
+	}
+	else
+		mPlot->SetPrettyCurves((mCurveQuality & CurveQuality::HighDrag) != 0);
+
+	mDragging = true;
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		UpdateAdaptiveCurveQuality
+//
+// Description:		Selects the curve quality level according to the duration
+//					of the previous frame.  Level zero uses pretty lines,
+//					level one uses fast lines and each subsequent level
+//					doubles the decimation factor.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::UpdateAdaptiveCurveQuality()
+{
+	// Use hysteresis to avoid toggling between levels every frame
+	const double frameTime(GetLastFrameTime());
+	if (frameTime > GetFrameTimeBudget() &&
+		mAdaptiveQualityLevel < mMaxAdaptiveQualityLevel)
+		++mAdaptiveQualityLevel;
+	else if (frameTime < 0.5 * GetFrameTimeBudget() && mAdaptiveQualityLevel > 0)
+		--mAdaptiveQualityLevel;
+
+	ApplyAdaptiveCurveQuality();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		ApplyAdaptiveCurveQuality
+//
+// Description:		Configures the plot according to the current adaptive
+//					quality level.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::ApplyAdaptiveCurveQuality()
+{
+	mPlot->SetPrettyCurves(mAdaptiveQualityLevel == 0);
+	if (mAdaptiveQualityLevel < 2)
+		mPlot->SetCurveDecimation(1);
+	else
+		mPlot->SetCurveDecimation(1 << (mAdaptiveQualityLevel - 1));
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		UpdatePlot
+//
+// Description:		Updates the plot object to match the current data and
+//					settings (does not re-render).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::UpdatePlot()
 {
 	if (GetXLogarithmic())
 		mXScaleFunction = DoLogarithmicScale;
@@ -237,8 +451,48 @@ void PlotRenderer::UpdateDisplay()
 		mRightYScaleFunction = DoLineaerScale;
 
 	mPlot->Update();
+
+	// Cursor values are updated as part of the plot update
+	mPlotUpdatePending = false;
+	mCursorValuesUpdatePending = false;
+
+	// Queued (rather than processed immediately) so handlers can safely
+	// update other renderers
+	if (GetXMin() != mLastXMin || GetXMax() != mLastXMax)
+	{
+		mLastXMin = GetXMin();
+		mLastXMax = GetXMax();
+
+		wxCommandEvent event(X_LIMITS_CHANGED_EVENT, GetId());
+		event.SetEventObject(this);
+		wxQueueEvent(GetEventHandler(), event.Clone());
+	}
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		UpdateOverlays
+//
+// Description:		Requests an update of the displayed scene following
+//					changes to the overlay objects (cursors and zoom box) only.
+//					The rest of the plot is re-drawn from the cached static
+//					layer.  As with RequestUpdateDisplay(), the update is
+//					performed at the next paint event.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::UpdateOverlays()
+{
+	mCursorValuesUpdatePending = true;
 	Refresh();
-	Update();
 }
 
 //=============================================================================
@@ -278,6 +532,13 @@ void PlotRenderer::CreateActors()
 		mLegend->SetPosition(mPlot->GetRightYAxis()->GetOffsetFromWindowEdge() + offset,
 			mPlot->GetTopAxis()->GetOffsetFromWindowEdge() + offset);
 		mLegend->SetVisibility(false);
+
+		mHoverLegend = new Legend(*this);
+		mHoverLegend->SetFont(mPlot->GetAxisFont(), 12);
+		mHoverLegend->SetWindowReference(Legend::PositionReference::BottomLeft);
+		mHoverLegend->SetDrawOrder(3100);// On top of the legend
+		mHoverLegend->SetIsOverlay(true);
+		mHoverLegend->SetVisibility(false);
 	}
 }
 
@@ -302,6 +563,34 @@ void PlotRenderer::OnSize(wxSizeEvent &event)
 {
 	mIgnoreNextMouseMove = true;
 
+	OnRenderSizeChange();
+	Refresh();
+	Update();
+
+	// Skip this event so the base class OnSize event fires, too
+	event.Skip();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		OnRenderSizeChange
+//
+// Description:		Updates the plot layout to match the size returned by
+//					GetRenderSize().  Called when the window is resized and
+//					when rendering offscreen at a different size.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::OnRenderSizeChange()
+{
 	if (mLeftCursor->GetIsVisible())
 		mLeftCursor->SetVisibility(true);
 	if (mRightCursor->GetIsVisible())
@@ -311,10 +600,10 @@ void PlotRenderer::OnSize(wxSizeEvent &event)
 		mLegend->SetModified();
 
 	mPlot->UpdatePlotAreaSize();
-	UpdateDisplay();
+	UpdatePlot();
 
-	// Skip this event so the base class OnSize event fires, too
-	event.Skip();
+	if (mStatisticsOverlay)
+		UpdateStatisticsOverlay();
 }
 
 //=============================================================================
@@ -366,7 +655,7 @@ void PlotRenderer::OnMouseWheelEvent(wxMouseEvent &event)
 	mPlot->SetRightYMin(mPlot->GetRightYMin() + yRightDelta);
 	mPlot->SetRightYMax(mPlot->GetRightYMax() - yRightDelta);
 
-	UpdateDisplay();
+	RequestUpdateDisplay();
 }
 
 //=============================================================================
@@ -400,24 +689,50 @@ void PlotRenderer::OnMouseMoveEvent(wxMouseEvent &event)
 		(!mObservedRightButtonDown && event.RightIsDown()) ||
 		mIgnoreNextMouseMove)// mIgnoreNextMouseMove prevents panning on maximize by double clicking title bar or after creating a context menu
 	{
-		mPlot->SetPrettyCurves((mCurveQuality & CurveQuality::HighStatic) != 0);
+		UseStaticCurveQuality();
 		mIgnoreNextMouseMove = false;
 		StoreMousePosition(event);
+
+		if (mHoverReadout)
+		{
+			mHoverUpdatePending = true;
+			Refresh();
+		}
+		return;
+	}
+
+	HideHoverReadout();
+
+	// Cursors and the zoom box are overlays - moving them does not require
+	// the rest of the plot to be updated
+	if (!mDraggingLegend && (mDraggingLeftCursor || mDraggingRightCursor ||
+		(event.RightIsDown() && !event.ControlDown() && !event.ShiftDown())))
+	{
+		if (mDraggingLeftCursor)
+			mLeftCursor->SetLocation(event.GetX());
+		else if (mDraggingRightCursor)
+			mRightCursor->SetLocation(event.GetX());
+		// ZOOM WITH BOX: Right mouse button
+		else
+			ProcessZoomWithBox(event);
+
+		StoreMousePosition(event);
+		UpdateOverlays();
 		return;
 	}
 
+	// Moving the legend does not affect any other part of the plot
 	if (mDraggingLegend && mLegend)
+	{
 		mLegend->SetDeltaPosition(event.GetX() - mLastMousePosition[0], mLastMousePosition[1] - event.GetY());
-	else if (mDraggingLeftCursor)
-		mLeftCursor->SetLocation(event.GetX());
-	else if (mDraggingRightCursor)
-		mRightCursor->SetLocation(event.GetX());
+		StoreMousePosition(event);
+		Refresh();
+		return;
+	}
+
 	// ZOOM:  Left or Right mouse button + CTRL or SHIFT
-	else if ((event.ControlDown() || event.ShiftDown()) && (event.RightIsDown() || event.LeftIsDown()))
+	if ((event.ControlDown() || event.ShiftDown()) && (event.RightIsDown() || event.LeftIsDown()))
 		ProcessZoom(event);
-	// ZOOM WITH BOX: Right mouse button
-	else if (event.RightIsDown())
-		ProcessZoomWithBox(event);
 	// PAN:  Left mouse button (includes with any buttons not caught above)
 	else if (event.LeftIsDown())
 		ProcessPan(event);
@@ -427,9 +742,9 @@ void PlotRenderer::OnMouseMoveEvent(wxMouseEvent &event)
 		return;
 	}
 
-	mPlot->SetPrettyCurves((mCurveQuality & CurveQuality::HighDrag) != 0);
+	UseDragCurveQuality();
 	StoreMousePosition(event);
-	UpdateDisplay();
+	RequestUpdateDisplay();
 }
 
 //=============================================================================
@@ -455,10 +770,13 @@ void PlotRenderer::OnRightButtonUpEvent(wxMouseEvent &event)
 	if (!mObservedRightButtonDown)
 		return;
 
-	mPlot->SetPrettyCurves((mCurveQuality & CurveQuality::HighStatic) != 0);
+	UseStaticCurveQuality();
 
 	if (!mZoomBox->GetIsVisible())// TODO:  And if not zooming by dragging right mouse button
 	{
+		// Curves drawn at reduced quality while dragging (i.e. after a
+		// ctrl + right-drag zoom) must be re-drawn at full quality
+		RequestUpdateDisplay();
 		ProcessRightClick(event);
 		return;
 	}
@@ -771,7 +1089,214 @@ void PlotRenderer::SetMinorGridOff()
 void PlotRenderer::SetCurveQuality(const CurveQuality& curveQuality)
 {
 	mCurveQuality = curveQuality;
-	mPlot->SetPrettyCurves((mCurveQuality & CurveQuality::HighStatic) != 0);
+	UseStaticCurveQuality();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		SetDensityMode
+//
+// Description:		Enables or disables density rendering of the curves.
+//
+// Input Arguments:
+//		density	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::SetDensityMode(const bool& density)
+{
+	mPlot->SetDensityCurves(density);
+	UpdateDisplay();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		GetDensityMode
+//
+// Description:		Returns a boolean indicating whether or not the curves are
+//					rendered as a density image.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//=============================================================================
+bool PlotRenderer::GetDensityMode() const
+{
+	return mPlot->GetDensityCurves();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		SetHoverReadout
+//
+// Description:		Enables or disables the hover readout.
+//
+// Input Arguments:
+//		hover	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::SetHoverReadout(const bool& hover)
+{
+	mHoverReadout = hover;
+	if (!mHoverReadout)
+		HideHoverReadout();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		SetStatisticsOverlay
+//
+// Description:		Enables or disables the statistics overlay.
+//
+// Input Arguments:
+//		show	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::SetStatisticsOverlay(const bool& show)
+{
+	mStatisticsOverlay = show;
+	if (mStatisticsOverlay)
+		SetCollectStatistics(true);
+
+	UpdateStatisticsOverlay();
+	UpdateOverlays();
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		UpdateStatisticsOverlay
+//
+// Description:		Updates the statistics overlay with the statistics for the
+//					most recent frame.  The overlay is hidden while rendering
+//					offscreen.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::UpdateStatisticsOverlay()
+{
+	if (mStatisticsOverlay && GetCollectStatistics() && !IsRenderingOffscreen())
+		mPlot->SetStatisticsText(GetRenderStatistics().GetSummary());
+	else
+		mPlot->SetStatisticsText(wxEmptyString);
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		UpdateHoverReadout
+//
+// Description:		Finds the data point closest to the last known mouse
+//					position and displays its value next to the point.  The
+//					readout is placed on the side of the point facing the
+//					center of the window, so it stays on-screen.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::UpdateHoverReadout()
+{
+	mHoverUpdatePending = false;
+	if (!mHoverLegend || !mHoverReadout)
+		return;
+
+	// Remember: OpenGL uses Bottom Left as origin, normal windows use Top Left as origin
+	const int x(mLastMousePosition[0]);
+	const int y(GetSize().GetHeight() - mLastMousePosition[1]);
+	const bool inPlotArea(
+		x >= static_cast<int>(mPlot->GetLeftYAxis()->GetOffsetFromWindowEdge()) &&
+		x <= GetSize().GetWidth() - static_cast<int>(mPlot->GetRightYAxis()->GetOffsetFromWindowEdge()) &&
+		y >= static_cast<int>(mPlot->GetBottomAxis()->GetOffsetFromWindowEdge()) &&
+		y <= GetSize().GetHeight() - static_cast<int>(mPlot->GetTopAxis()->GetOffsetFromWindowEdge()));
+
+	PlotObject::Sample sample;
+	Legend::LegendEntryInfo info;
+	if (!inPlotArea || !mPlot->FindNearestSample(x, y, mHoverRadius, sample) ||
+		!mGuiInterface.GetLegendEntry(sample.curve, info))
+	{
+		HideHoverReadout();
+		return;
+	}
+
+	info.text = wxString::Format("%s (%g, %g)", info.text, sample.x, sample.y);
+	info.markerSize = std::max(info.markerSize, 1);
+	mHoverLegend->SetContents(std::vector<Legend::LegendEntryInfo>(1, info));
+
+	const double offset(8.0);// [pixels]
+	const bool right(sample.xPixel > 0.5 * GetSize().GetWidth());
+	const bool top(sample.yPixel > 0.5 * GetSize().GetHeight());
+	if (top)
+		mHoverLegend->SetLegendReference(right ?
+			Legend::PositionReference::TopRight : Legend::PositionReference::TopLeft);
+	else
+		mHoverLegend->SetLegendReference(right ?
+			Legend::PositionReference::BottomRight : Legend::PositionReference::BottomLeft);
+
+	mHoverLegend->SetPosition(sample.xPixel + (right ? -offset : offset),
+		sample.yPixel + (top ? -offset : offset));
+	mHoverLegend->SetVisibility(true);
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		HideHoverReadout
+//
+// Description:		Hides the hover readout, if it is visible.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::HideHoverReadout()
+{
+	mHoverUpdatePending = false;
+	if (!mHoverLegend || !mHoverLegend->GetIsVisible())
+		return;
+
+	mHoverLegend->SetVisibility(false);
+	Refresh();
 }
 
 //=============================================================================
@@ -1406,6 +1931,50 @@ void PlotRenderer::AddCurve(const Dataset2D &data)
 	mPlot->AddCurve(data);
 }
 
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		SetCurveDataModified
+//
+// Description:		Flags the data for the specified curve as modified.
+//
+// Input Arguments:
+//		index	= const unsigned int& specifying the modified curve
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::SetCurveDataModified(const unsigned int &index)
+{
+	mPlot->SetCurveDataModified(index);
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		SetCurveDataAppended
+//
+// Description:		Flags the data for the specified curve as extended.
+//
+// Input Arguments:
+//		index	= const unsigned int& specifying the modified curve
+//		count	= const unsigned int& number of points appended
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::SetCurveDataAppended(const unsigned int &index,
+	const unsigned int &count)
+{
+	mPlot->SetCurveDataAppended(index, count);
+}
+
 //=============================================================================
 // Class:			PlotRenderer
 // Function:		RemoveAllCurves
@@ -1722,6 +2291,8 @@ void PlotRenderer::OnMouseLeaveWindowEvent(wxMouseEvent& WXUNUSED(event))
 	if (mZoomBox->GetIsVisible())
 		mZoomBox->SetVisibility(false);
 
+	HideHoverReadout();
+
 	// TODO:  Why were these lines added?  Removed them due to bug:
 	// Drag mLegend, move cursor off of screen (holding left button down), move
 	// cursor back onto screen, now we're dragging plot (expected to still drag
@@ -1819,7 +2390,10 @@ void PlotRenderer::OnLeftButtonUpEvent(wxMouseEvent& event)
 	if (!mObservedLeftButtonDown)
 		return;
 
-	mPlot->SetPrettyCurves((mCurveQuality & CurveQuality::HighStatic) != 0);
+	UseStaticCurveQuality();
+
+	if (mDraggingLeftCursor || mDraggingRightCursor)
+		mPlot->Invalidate(PlotObject::Dirty::Cursors);
 
 	if (mDraggingLegend)
 	{
@@ -2003,8 +2577,40 @@ void PlotRenderer::UpdateCursors()
 	// Calculations are performed on Draw
 	mLeftCursor->Recalculate();
 	mRightCursor->Recalculate();
+}
 
-	Refresh();
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		UpdateFonts
+//
+// Description:		Applies the plot's axis font to the legends.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::UpdateFonts()
+{
+	// Must match CreateActors()
+	if (mLegend)
+	{
+		mLegend->SetFont(mPlot->GetAxisFont(), 12);
+		mLegend->SetModified();
+	}
+
+	if (mHoverLegend)
+	{
+		mHoverLegend->SetFont(mPlot->GetAxisFont(), 12);
+		mHoverLegend->SetModified();
+	}
+
+	RequestUpdateDisplay();
 }
 
 //=============================================================================
@@ -2175,6 +2781,30 @@ void PlotRenderer::SetGridColor(const Color &color)
 	mPlot->SetGridColor(color);
 }
 
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		SetBackgroundColor
+//
+// Description:		Sets the background color for this plot.  Lines are faded
+//					into the background color, so the plot must be rebuilt.
+//
+// Input Arguments:
+//		backgroundColor	= const Color&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::SetBackgroundColor(const Color& backgroundColor)
+{
+	RenderWindow::SetBackgroundColor(backgroundColor);
+	if (mPlot)
+		mPlot->Invalidate(PlotObject::Dirty::Style | PlotObject::Dirty::Layout);
+}
+
 //=============================================================================
 // Class:			PlotRenderer
 // Function:		SetAxesVisibility
@@ -2522,14 +3152,10 @@ void PlotRenderer::PanBottomXAxis(wxMouseEvent &event)
 
 	if (mPlot->GetBottomAxis()->IsLogarithmic())
 	{
-		const int pixelDelta(event.GetX() - mLastMousePosition[0]);
-		mPlot->SetXMin(mPlot->GetBottomAxis()->PixelToValue(
-			static_cast<int>(mPlot->GetLeftYAxis()->GetOffsetFromWindowEdge())
-			- pixelDelta));
-		mPlot->SetXMax(mPlot->GetBottomAxis()->PixelToValue(
-			GetSize().GetWidth()
-			- static_cast<int>(mPlot->GetRightYAxis()->GetOffsetFromWindowEdge())
-			- pixelDelta));
+		double min(mPlot->GetXMin()), max(mPlot->GetXMax());
+		ShiftLogarithmicLimits(min, max, event.GetX() - mLastMousePosition[0], width);
+		mPlot->SetXMin(min);
+		mPlot->SetXMax(max);
 	}
 	else
 	{
@@ -2540,6 +3166,41 @@ void PlotRenderer::PanBottomXAxis(wxMouseEvent &event)
 	}
 }
 
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		ShiftLogarithmicLimits
+//
+// Description:		Shifts the limits of a logarithmic axis by the specified
+//					number of pixels.  Computed from the limits only (and not
+//					from the axis object) so that successive pans accumulate
+//					correctly even if the plot has not been updated in
+//					between.
+//
+// Input Arguments:
+//		min			= double&
+//		max			= double&
+//		pixelDelta	= const int&, positive moves the limits towards smaller
+//					  values
+//		pixels		= const int&, length of the axis in pixels
+//
+// Output Arguments:
+//		min	= double&
+//		max	= double&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::ShiftLogarithmicLimits(double& min, double& max,
+	const int& pixelDelta, const int& pixels)
+{
+	const double logMin(log10(min));
+	const double logMax(log10(max));
+	const double delta((logMax - logMin) * pixelDelta / pixels);
+	min = pow(10.0, logMin - delta);
+	max = pow(10.0, logMax - delta);
+}
+
 //=============================================================================
 // Class:			PlotRenderer
 // Function:		PanLeftYAxis
@@ -2564,14 +3225,10 @@ void PlotRenderer::PanLeftYAxis(wxMouseEvent &event)
 
 	if (mPlot->GetLeftYAxis()->IsLogarithmic())
 	{
-		const int pixelDelta(event.GetY() - mLastMousePosition[1]);
-		mPlot->SetLeftYMin(mPlot->GetLeftYAxis()->PixelToValue(
-			static_cast<int>(mPlot->GetBottomAxis()->GetOffsetFromWindowEdge())
-			+ pixelDelta));
-		mPlot->SetLeftYMax(mPlot->GetLeftYAxis()->PixelToValue(
-			GetSize().GetHeight()
-			- static_cast<int>(mPlot->GetTopAxis()->GetOffsetFromWindowEdge())
-			+ pixelDelta));
+		double min(mPlot->GetLeftYMin()), max(mPlot->GetLeftYMax());
+		ShiftLogarithmicLimits(min, max, mLastMousePosition[1] - event.GetY(), height);
+		mPlot->SetLeftYMin(min);
+		mPlot->SetLeftYMax(max);
 	}
 	else
 	{
@@ -2606,14 +3263,10 @@ void PlotRenderer::PanRightYAxis(wxMouseEvent &event)
 
 	if (mPlot->GetRightYAxis()->IsLogarithmic())
 	{
-		const int pixelDelta(event.GetY() - mLastMousePosition[1]);
-		mPlot->SetRightYMin(mPlot->GetRightYAxis()->PixelToValue(
-			static_cast<int>(mPlot->GetBottomAxis()->GetOffsetFromWindowEdge())
-			+ pixelDelta));
-		mPlot->SetRightYMax(mPlot->GetRightYAxis()->PixelToValue(
-			GetSize().GetHeight()
-			- static_cast<int>(mPlot->GetTopAxis()->GetOffsetFromWindowEdge())
-			+ pixelDelta));
+		double min(mPlot->GetRightYMin()), max(mPlot->GetRightYMax());
+		ShiftLogarithmicLimits(min, max, mLastMousePosition[1] - event.GetY(), height);
+		mPlot->SetRightYMin(min);
+		mPlot->SetRightYMax(max);
 	}
 	else
 	{
@@ -2664,6 +3317,8 @@ void PlotRenderer::ProcessPlotAreaDoubleClick(const unsigned int &x)
 		else
 			mRightCursor->SetLocation(x);
 	}
+
+	mPlot->Invalidate(PlotObject::Dirty::Cursors);
 }
 
 //=============================================================================
@@ -3083,15 +3738,20 @@ unsigned long long PlotRenderer::GetTotalPointCount() const
 void PlotRenderer::LoadModelviewUniform(const Modelview& mv)
 {
 	float glModelviewMatrix[16];
+	bool xLogarithmic(false), yLogarithmic(false);
 
 	switch(mv)
 	{
 	case Modelview::Left:
 		ConvertMatrixToGL(mLeftModelview, glModelviewMatrix);
+		xLogarithmic = GetXLogarithmic();
+		yLogarithmic = GetLeftLogarithmic();
 		break;
 
 	case Modelview::Right:
 		ConvertMatrixToGL(mRightModelview, glModelviewMatrix);
+		xLogarithmic = GetXLogarithmic();
+		yLogarithmic = GetRightLogarithmic();
 		break;
 
 	default:
@@ -3099,7 +3759,38 @@ void PlotRenderer::LoadModelviewUniform(const Modelview& mv)
 		ConvertMatrixToGL(mModelviewMatrix, glModelviewMatrix);
 	}
 
-	glUniformMatrix4fv(mShaders[0].uniformLocations[mModelviewName], 1, GL_FALSE, glModelviewMatrix);
+	const ShaderInfo& shader(GetActiveProgramInfo());
+	glUniformMatrix4fv(shader.uniformLocations.find(mModelviewName)->second,
+		1, GL_FALSE, glModelviewMatrix);
+
+	const auto logarithmic(shader.uniformLocations.find(mLogarithmicName));
+	if (logarithmic != shader.uniformLocations.end())
+		glUniform2i(logarithmic->second, xLogarithmic, yLogarithmic);
+}
+
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		AssignDefaultLocations
+//
+// Description:		Assigns uniform locations and/or values for default program.
+//
+// Input Arguments:
+//		shader	= ShaderInfo&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotRenderer::AssignDefaultLocations(ShaderInfo& shader)
+{
+	RenderWindow::AssignDefaultLocations(shader);
+	shader.uniformLocations[mLogarithmicName] = glGetUniformLocation(
+		shader.programId, mLogarithmicName.c_str());
+
+	assert(!RenderWindow::GLHasError());
 }
 
 //=============================================================================
@@ -3128,7 +3819,7 @@ void PlotRenderer::ContextWriteImageFile(wxCommandEvent& WXUNUSED(event))
 	if (pathAndFileName.IsEmpty())
 		return;
 
-	WriteImageToFile(pathAndFileName[0]);
+	WriteImageToFileAsync(pathAndFileName[0]);
 }
 
 //=============================================================================
@@ -4087,12 +4778,20 @@ void PlotRenderer::ContextEditRightLabel(wxCommandEvent& WXUNUSED(event))
 //=============================================================================
 void PlotRenderer::DoCopy()
 {
-	wxInitAllImageHandlers();
-	if (wxTheClipboard->Open())
+	// The clipboard is updated once the pixels have been read back
+	RequestCapture([](unsigned char* pixels, const int& width,
+		const int& height)
 	{
-		wxTheClipboard->SetData(new wxBitmapDataObject(GetImage()));
-		wxTheClipboard->Close();
-	}
+		if (!pixels)
+			return;
+
+		wxImage image(width, height, pixels);// Takes ownership of pixels
+		if (wxTheClipboard->Open())
+		{
+			wxTheClipboard->SetData(new wxBitmapDataObject(image));
+			wxTheClipboard->Close();
+		}
+	});
 }
 
 //=============================================================================
@@ -4146,4 +4845,25 @@ bool PlotRenderer::CurveMarkersVisible(const unsigned int& i) const
 	return mPlot->CurveMarkersVisible(i);
 }
 
+//=============================================================================
+// Class:			PlotRenderer
+// Function:		CurveHasSortedX
+//
+// Description:		Checks to see if the specified curve has sorted x-values.
+//
+// Input Arguments:
+//		i	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//=============================================================================
+bool PlotRenderer::CurveHasSortedX(const unsigned int& i) const
+{
+	return mPlot->CurveHasSortedX(i);
+}
+
 }// namespace LibPlot2D
@@ -92,12 +92,12 @@ void Axis::Update(const unsigned int& i)
 	else if (i == 2 && mValueText.IsOK())// Values
 	{
 		DrawTickLabels();
-		mBufferInfo[i] = mValueText.BuildText();
+		mValueText.BuildText(mBufferInfo[i]);
 	}
 	else if (i == 3 && mLabelText.IsOK())// Label
 	{
 		DrawAxisLabel();
-		mBufferInfo[i] = mLabelText.BuildText();
+		mLabelText.BuildText(mBufferInfo[i]);
 	}
 }
 
@@ -136,13 +136,11 @@ void Axis::GenerateGeometry()
 
 	if (mValueText.IsOK() && mBufferInfo[2].vertexCount > 0 && mTickStyle != TickStyle::NoTicks)
 	{
-		glBindVertexArray(mBufferInfo[2].GetVertexArrayIndex());
 		mValueText.RenderBufferedGlyph(mBufferInfo[2].vertexCount);
 	}
 
 	if (!mLabel.IsEmpty() && mLabelText.IsOK() && mBufferInfo[3].vertexCount > 0 && mTickStyle != TickStyle::NoTicks)
 	{
-		glBindVertexArray(mBufferInfo[3].GetVertexArrayIndex());
 		mLabelText.RenderBufferedGlyph(mBufferInfo[3].vertexCount);
 	}
 
@@ -214,10 +212,10 @@ int Axis::ComputeMainAxisLocation() const
 	if (mOrientation == Orientation::Bottom || mOrientation == Orientation::Left)
 		return mOffsetFromWindowEdge;
 	else if (mOrientation == Orientation::Right)
-		return mRenderWindow.GetSize().GetWidth() - mOffsetFromWindowEdge;
+		return mRenderWindow.GetRenderSize().GetWidth() - mOffsetFromWindowEdge;
 
 	//else// OrientationTop
-	return mRenderWindow.GetSize().GetHeight() - mOffsetFromWindowEdge;
+	return mRenderWindow.GetRenderSize().GetHeight() - mOffsetFromWindowEdge;
 }
 
 //=============================================================================
@@ -287,13 +285,13 @@ void Axis::DrawMainAxis(const int &mainAxisLocation)
 	if (IsHorizontal())
 	{
 		mAxisPoints.push_back(std::make_pair(mMinAxis->GetOffsetFromWindowEdge(), mainAxisLocation));
-		mAxisPoints.push_back(std::make_pair(mRenderWindow.GetSize().GetWidth()
+		mAxisPoints.push_back(std::make_pair(mRenderWindow.GetRenderSize().GetWidth()
 			- mMaxAxis->GetOffsetFromWindowEdge(), mainAxisLocation));
 	}
 	else
 	{
 		mAxisPoints.push_back(std::make_pair(mainAxisLocation, mMinAxis->GetOffsetFromWindowEdge()));
-		mAxisPoints.push_back(std::make_pair(mainAxisLocation, mRenderWindow.GetSize().GetHeight() -
+		mAxisPoints.push_back(std::make_pair(mainAxisLocation, mRenderWindow.GetRenderSize().GetHeight() -
 			mMaxAxis->GetOffsetFromWindowEdge()));
 	}
 }
@@ -364,12 +362,12 @@ void Axis::DrawHorizontalGrid(const unsigned int &count)
 			location = ValueToPixel(GetNextTickValue(false, false, grid + 1));
 
 		if (location <= mMinAxis->GetOffsetFromWindowEdge() ||
-			location >= mRenderWindow.GetSize().GetWidth() - mMaxAxis->GetOffsetFromWindowEdge())
+			location >= mRenderWindow.GetRenderSize().GetWidth() - mMaxAxis->GetOffsetFromWindowEdge())
 			continue;
 
 		mGridPoints.push_back(std::make_pair(location, static_cast<double>(mOffsetFromWindowEdge)));
 		mGridPoints.push_back(std::make_pair(location,
-			static_cast<double>(mRenderWindow.GetSize().GetHeight() - mOppositeAxis->GetOffsetFromWindowEdge())));
+			static_cast<double>(mRenderWindow.GetRenderSize().GetHeight() - mOppositeAxis->GetOffsetFromWindowEdge())));
 	}
 }
 
@@ -400,7 +398,7 @@ void Axis::DrawHorizontalTicks(const unsigned int &count, const int &mainAxisLoc
 	{
 		double location(ValueToPixel(GetNextTickValue(false, false, tick + 1)));
 		if (location <= mMinAxis->GetOffsetFromWindowEdge() ||
-			location >= mRenderWindow.GetSize().GetWidth() - mMaxAxis->GetOffsetFromWindowEdge())
+			location >= mRenderWindow.GetRenderSize().GetWidth() - mMaxAxis->GetOffsetFromWindowEdge())
 			continue;
 
 		mAxisPoints.push_back(std::make_pair(location, static_cast<double>(mainAxisLocation - mTickSize * outsideTick * sign)));
@@ -436,11 +434,11 @@ void Axis::DrawVerticalGrid(const unsigned int &count)
 			location = ValueToPixel(GetNextTickValue(false, false, grid + 1));
 
 		if (location <= mMinAxis->GetOffsetFromWindowEdge() ||
-			location >= mRenderWindow.GetSize().GetHeight() - mMaxAxis->GetOffsetFromWindowEdge())
+			location >= mRenderWindow.GetRenderSize().GetHeight() - mMaxAxis->GetOffsetFromWindowEdge())
 			continue;
 
 		mGridPoints.push_back(std::make_pair(static_cast<double>(mOffsetFromWindowEdge), location));
-		mGridPoints.push_back(std::make_pair(static_cast<double>(mRenderWindow.GetSize().GetWidth()
+		mGridPoints.push_back(std::make_pair(static_cast<double>(mRenderWindow.GetRenderSize().GetWidth()
 			- mOppositeAxis->GetOffsetFromWindowEdge()), location));
 	}
 }
@@ -472,7 +470,7 @@ void Axis::DrawVerticalTicks(const unsigned int &count, const int &mainAxisLocat
 	{
 		double location(ValueToPixel(GetNextTickValue(false, false, tick + 1)));
 		if (location <= mMinAxis->GetOffsetFromWindowEdge() ||
-			location >= mRenderWindow.GetSize().GetHeight() - mMaxAxis->GetOffsetFromWindowEdge())
+			location >= mRenderWindow.GetRenderSize().GetHeight() - mMaxAxis->GetOffsetFromWindowEdge())
 			continue;
 
 		mAxisPoints.push_back(std::make_pair(static_cast<double>(mainAxisLocation - mTickSize * outsideTick * sign), location));
@@ -555,12 +553,12 @@ void Axis::DrawAxisLabel()
 		- static_cast<double>(mMaxAxis->GetOffsetFromWindowEdge());
 
 	if (IsHorizontal())
-		mLabelText.SetPosition(0.5 * (mRenderWindow.GetSize().GetWidth()
+		mLabelText.SetPosition(0.5 * (mRenderWindow.GetRenderSize().GetWidth()
 			- textWidth + plotOffset), edgeOffset);
 	else
 	{
 		mLabelText.SetOrientation(M_PI * 0.5);
-		mLabelText.SetPosition(0.5 * (mRenderWindow.GetSize().GetHeight()
+		mLabelText.SetPosition(0.5 * (mRenderWindow.GetRenderSize().GetHeight()
 			- textWidth + plotOffset), -edgeOffset);
 	}
 
@@ -596,10 +594,10 @@ double Axis::GetAxisLabelTranslation(const double &offset,
 		return offset + fontHeight;
 
 	case Orientation::Top:
-		return mRenderWindow.GetSize().GetHeight() - offset - fontHeight;
+		return mRenderWindow.GetRenderSize().GetHeight() - offset - fontHeight;
 
 	case Orientation::Right:
-		return mRenderWindow.GetSize().GetWidth() - offset;
+		return mRenderWindow.GetRenderSize().GetWidth() - offset;
 
 	default:
 		assert(false);
@@ -803,7 +801,7 @@ void Axis::ComputeTranslations(const double &value, float &xTranslation,
 		if (mOrientation == Orientation::Bottom)
 			yTranslation = offset - boundingBox.yUp;
 		else
-			yTranslation = mRenderWindow.GetSize().GetHeight() - offset;
+			yTranslation = mRenderWindow.GetRenderSize().GetHeight() - offset;
 
 		xTranslation = ValueToPixel(value) -
 			(boundingBox.xRight - boundingBox.xLeft) / 2.0;
@@ -813,7 +811,7 @@ void Axis::ComputeTranslations(const double &value, float &xTranslation,
 		if (mOrientation == Orientation::Left)
 			xTranslation = offset - boundingBox.xRight;
 		else
-			xTranslation = mRenderWindow.GetSize().GetWidth() - offset;
+			xTranslation = mRenderWindow.GetRenderSize().GetWidth() - offset;
 
 		yTranslation = ValueToPixel(value) -
 			(boundingBox.yUp - boundingBox.yDown) / 2.0;
@@ -898,11 +896,11 @@ double Axis::ValueToPixel(const double &value) const
 	// Get the plot size
 	int plotDimension;
 	if (IsHorizontal())
-		plotDimension = mRenderWindow.GetSize().GetWidth()
+		plotDimension = mRenderWindow.GetRenderSize().GetWidth()
 				- mMinAxis->GetOffsetFromWindowEdge()
 				- mMaxAxis->GetOffsetFromWindowEdge();
 	else
-		plotDimension = mRenderWindow.GetSize().GetHeight()
+		plotDimension = mRenderWindow.GetRenderSize().GetHeight()
 				- mMinAxis->GetOffsetFromWindowEdge()
 				- mMaxAxis->GetOffsetFromWindowEdge();
 
@@ -946,13 +944,13 @@ double Axis::PixelToValue(const int &pixel) const
 	if (IsHorizontal())
 		fraction = (static_cast<double>(pixel)
 			- mMinAxis->GetOffsetFromWindowEdge())
-			/ (static_cast<double>(mRenderWindow.GetSize().GetWidth())
+			/ (static_cast<double>(mRenderWindow.GetRenderSize().GetWidth())
 			- mMinAxis->GetOffsetFromWindowEdge()
 			- mMaxAxis->GetOffsetFromWindowEdge());
 	else
 		fraction = (static_cast<double>(pixel)
 			- mMinAxis->GetOffsetFromWindowEdge())
-			/ (static_cast<double>(mRenderWindow.GetSize().GetHeight())
+			/ (static_cast<double>(mRenderWindow.GetRenderSize().GetHeight())
 			- mMinAxis->GetOffsetFromWindowEdge()
 			- mMaxAxis->GetOffsetFromWindowEdge());
 
@@ -1009,13 +1007,13 @@ unsigned int Axis::GetAxisLength() const
 {
 	if (mOrientation == Orientation::Top || mOrientation == Orientation::Bottom)
 	{
-		return mRenderWindow.GetSize().GetWidth()
+		return mRenderWindow.GetRenderSize().GetWidth()
 			- mMinAxis->GetOffsetFromWindowEdge()
 			- mMaxAxis->GetOffsetFromWindowEdge();
 	}
 	else
 	{
-		return mRenderWindow.GetSize().GetHeight()
+		return mRenderWindow.GetRenderSize().GetHeight()
 			- mMinAxis->GetOffsetFromWindowEdge()
 			- mMaxAxis->GetOffsetFromWindowEdge();
 	}
@@ -92,25 +92,24 @@ void Legend::Update(const unsigned int& i)
 
 		UpdateBoundingBox();
 
-		mBufferVector.push_back(BuildBackground());
+		BuildBackground(GetNextBuffer());
 
 		mLines.SetWidth(mBorderSize);
 		mLines.SetLineColor(mBorderColor);
 		mLines.SetBackgroundColorForAlphaFade();
-		mBufferVector.push_back(BufferInfo());
-		mLines.Build(BuildBorderPoints(), mBufferVector.back(),
-			Line::UpdateMethod::Manual);
+		BuildBorderPoints(mCornerPoints);
+		mLines.Build(mCornerPoints, GetNextBuffer(), Line::UpdateMethod::Manual);
 
 		BuildSampleLines();
 		BuildMarkers();
 
-		mBufferInfo[i] = AssembleBuffers();
+		AssembleBuffers(mBufferInfo[i]);
 	}
 	else if (i == 1)// Text
 	{
 		mText.SetColor(mFontColor);
 		BuildLabelStrings();
-		mBufferInfo[i] = mText.BuildText();
+		mText.BuildText(mBufferInfo[i]);
 	}
 
 	mBufferInfo[i].vertexCountModified = false;
@@ -149,7 +148,6 @@ void Legend::GenerateGeometry()
 	// Text last
 	if (mText.IsOK() && mBufferInfo[1].vertexCount > 0)
 	{
-		glBindVertexArray(mBufferInfo[1].GetVertexArrayIndex());
 		mText.RenderBufferedGlyph(mBufferInfo[1].vertexCount);
 	}
 }
@@ -189,25 +187,24 @@ bool Legend::HasValidParameters()
 //		None
 //
 // Output Arguments:
-//		None
+//		points	= std::vector<std::pair<double, double>>&
 //
 // Return Value:
-//		std::vector<std::pair<double, double>>
+//		None
 //
 //=============================================================================
-std::vector<std::pair<double, double>> Legend::GetCornerVertices() const
+void Legend::GetCornerVertices(
+	std::vector<std::pair<double, double>>& points) const
 {
 	double x, y;
 	GetAdjustedPosition(x, y);
 
-	std::vector<std::pair<double, double>> points;
+	points.clear();
 	points.push_back(std::make_pair(x, y));
 	points.push_back(std::make_pair(x + mWidth, y));
 	points.push_back(std::make_pair(x + mWidth, y + mHeight));
 	points.push_back(std::make_pair(x, y + mHeight));
 	points.push_back(std::make_pair(x, y));
-
-	return points;
 }
 
 //=============================================================================
@@ -341,13 +338,13 @@ void Legend::GetAdjustedPosition(double &x, double &y) const
 	case PositionReference::BottomCenter:
 	case PositionReference::Center:
 	case PositionReference::TopCenter:
-		x = mRenderWindow.GetSize().GetWidth() * 0.5 + mX;
+		x = mRenderWindow.GetRenderSize().GetWidth() * 0.5 + mX;
 		break;
 
 	case PositionReference::BottomRight:
 	case PositionReference::MiddleRight:
 	case PositionReference::TopRight:
-		x = mRenderWindow.GetSize().GetWidth() - mX;
+		x = mRenderWindow.GetRenderSize().GetWidth() - mX;
 		break;
 	}
 
@@ -363,13 +360,13 @@ void Legend::GetAdjustedPosition(double &x, double &y) const
 	case PositionReference::MiddleLeft:
 	case PositionReference::Center:
 	case PositionReference::MiddleRight:
-		y = mRenderWindow.GetSize().GetHeight() * 0.5 + mY;
+		y = mRenderWindow.GetRenderSize().GetHeight() * 0.5 + mY;
 		break;
 
 	case PositionReference::TopLeft:
 	case PositionReference::TopCenter:
 	case PositionReference::TopRight:
-		y = mRenderWindow.GetSize().GetHeight() - mY;
+		y = mRenderWindow.GetRenderSize().GetHeight() - mY;
 		break;
 	}
 
@@ -565,13 +562,13 @@ void Legend::GetPosition(const PositionReference& legendRef,
 	case PositionReference::BottomCenter:
 	case PositionReference::Center:
 	case PositionReference::TopCenter:
-		x = mRenderWindow.GetSize().GetWidth() * 0.5 + mX;
+		x = mRenderWindow.GetRenderSize().GetWidth() * 0.5 + mX;
 		break;
 
 	case PositionReference::BottomRight:
 	case PositionReference::MiddleRight:
 	case PositionReference::TopRight:
-		x = mRenderWindow.GetSize().GetWidth() - mX;
+		x = mRenderWindow.GetRenderSize().GetWidth() - mX;
 		break;
 	}
 
@@ -587,13 +584,13 @@ void Legend::GetPosition(const PositionReference& legendRef,
 	case PositionReference::MiddleLeft:
 	case PositionReference::Center:
 	case PositionReference::MiddleRight:
-		y = mRenderWindow.GetSize().GetHeight() * 0.5 + mY;
+		y = mRenderWindow.GetRenderSize().GetHeight() * 0.5 + mY;
 		break;
 
 	case PositionReference::TopLeft:
 	case PositionReference::TopCenter:
 	case PositionReference::TopRight:
-		y = mRenderWindow.GetSize().GetHeight() - mY;
+		y = mRenderWindow.GetRenderSize().GetHeight() - mY;
 		break;
 	}
 
@@ -656,13 +653,13 @@ void Legend::GetPosition(const PositionReference& legendRef,
 	case PositionReference::BottomCenter:
 	case PositionReference::Center:
 	case PositionReference::TopCenter:
-		x -= mRenderWindow.GetSize().GetWidth() * 0.5;
+		x -= mRenderWindow.GetRenderSize().GetWidth() * 0.5;
 		break;
 
 	case PositionReference::BottomRight:
 	case PositionReference::MiddleRight:
 	case PositionReference::TopRight:
-		x = mRenderWindow.GetSize().GetWidth() - x;
+		x = mRenderWindow.GetRenderSize().GetWidth() - x;
 		break;
 	}
 
@@ -677,13 +674,13 @@ void Legend::GetPosition(const PositionReference& legendRef,
 	case PositionReference::MiddleLeft:
 	case PositionReference::Center:
 	case PositionReference::MiddleRight:
-		y -= mRenderWindow.GetSize().GetHeight() * 0.5;
+		y -= mRenderWindow.GetRenderSize().GetHeight() * 0.5;
 		break;
 
 	case PositionReference::TopLeft:
 	case PositionReference::TopCenter:
 	case PositionReference::TopRight:
-		y = mRenderWindow.GetSize().GetHeight() - y;
+		y = mRenderWindow.GetRenderSize().GetHeight() - y;
 		break;
 	}
 
@@ -753,18 +750,17 @@ void Legend::GetPosition(const PositionReference& legendRef,
 //		None
 //
 // Output Arguments:
-//		None
+//		points	= std::vector<std::pair<double, double>>&
 //
 // Return Value:
-//		std::vector<std::pair<double, double>>
+//		None
 //
 //=============================================================================
-std::vector<std::pair<double, double>> Legend::BuildBorderPoints() const
+void Legend::BuildBorderPoints(
+	std::vector<std::pair<double, double>>& points) const
 {
-	std::vector<std::pair<double, double>> corners(GetCornerVertices());
-	corners.push_back(corners[0]);
-
-	return corners;
+	GetCornerVertices(points);
+	points.push_back(points[0]);
 }
 
 //=============================================================================
@@ -777,23 +773,22 @@ std::vector<std::pair<double, double>> Legend::BuildBorderPoints() const
 //		None
 //
 // Output Arguments:
-//		None
+//		buffer	= Primitive::BufferInfo&
 //
 // Return Value:
-//		Primitive::BufferInfo
+//		None
 //
 //=============================================================================
-Primitive::BufferInfo Legend::BuildBackground() const
+void Legend::BuildBackground(Primitive::BufferInfo& buffer)
 {
-	Primitive::BufferInfo buffer;
-
 	buffer.vertexCount = 4;
 	buffer.vertexBuffer.resize(buffer.vertexCount * (4 + mRenderWindow.GetVertexDimension()));
 	assert(mRenderWindow.GetVertexDimension() == 2);
 
 	buffer.indexBuffer.resize(6);
 
-	std::vector<std::pair<double, double>> corners(GetCornerVertices());
+	GetCornerVertices(mCornerPoints);
+	const std::vector<std::pair<double, double>>& corners(mCornerPoints);
 	buffer.vertexBuffer[0] = static_cast<float>(corners[0].first);
 	buffer.vertexBuffer[1] = static_cast<float>(corners[0].second);
 
@@ -833,8 +828,6 @@ Primitive::BufferInfo Legend::BuildBackground() const
 	buffer.indexBuffer[3] = 2;
 	buffer.indexBuffer[4] = 3;
 	buffer.indexBuffer[5] = 0;
-
-	return buffer;
 }
 
 //=============================================================================
@@ -857,8 +850,6 @@ void Legend::BuildMarkers()
 {
 	const unsigned int lineYOffset(mEntrySpacing);
 
-	Primitive::BufferInfo buffer;
-
 	double x, y;
 	GetAdjustedPosition(x, y);
 
@@ -873,6 +864,7 @@ void Legend::BuildMarkers()
 		if (halfSize <= 0.0)
 			continue;
 
+		Primitive::BufferInfo& buffer(GetNextBuffer());
 		buffer.vertexCount = 4;
 		buffer.vertexBuffer.resize(buffer.vertexCount * (mRenderWindow.GetVertexDimension() + 4));
 		assert(mRenderWindow.GetVertexDimension() == 2);
@@ -918,8 +910,6 @@ void Legend::BuildMarkers()
 		buffer.indexBuffer[3] = 2;
 		buffer.indexBuffer[4] = 3;
 		buffer.indexBuffer[5] = 0;
-
-		mBufferVector.push_back(std::move(buffer));
 	}
 }
 
@@ -928,39 +918,40 @@ void Legend::BuildMarkers()
 // Function:		AssembleBuffers
 //
 // Description:		Combines the triangle buffers into a single BufferInfo
-//					object.
+//					object.  The existing storage and OpenGL objects of the
+//					destination buffer are re-used.
 //
 // Input Arguments:
 //		None
 //
 // Output Arguments:
-//		None
+//		buffer	= Primitive::BufferInfo&
 //
 // Return Value:
-//		Primitive::BufferInfo
+//		None
 //
 //=============================================================================
-Primitive::BufferInfo Legend::AssembleBuffers()
+void Legend::AssembleBuffers(Primitive::BufferInfo& buffer)
 {
-	Primitive::BufferInfo buffer;
-
-	for (const auto& b : mBufferVector)
+	unsigned int i, indexCount(0);
+	buffer.vertexCount = 0;
+	for (i = 0; i < mBufferCount; ++i)
 	{
-		buffer.indexBuffer.insert(buffer.indexBuffer.end(),
-			b.indexBuffer.begin(), b.indexBuffer.end());
-		buffer.vertexBuffer.insert(buffer.vertexBuffer.end(),
-			b.vertexBuffer.begin(), b.vertexBuffer.end());
-		buffer.vertexCount += b.vertexCount;
+		buffer.vertexCount += mBufferVector[i].vertexCount;
+		indexCount += mBufferVector[i].indexBuffer.size();
 	}
 
-	const unsigned int colorStart(
-		buffer.vertexCount * mRenderWindow.GetVertexDimension());
+	const unsigned int dimension(mRenderWindow.GetVertexDimension());
+	buffer.vertexBuffer.resize(buffer.vertexCount * (dimension + 4));
+	buffer.indexBuffer.resize(indexCount);
+
+	const unsigned int colorStart(buffer.vertexCount * dimension);
 
 	unsigned int j, k(0), m(0), indexShift(0);
-	for (auto& b : mBufferVector)
+	for (i = 0; i < mBufferCount; ++i)
 	{
-		unsigned int bufferColorStart(
-			b.vertexCount * mRenderWindow.GetVertexDimension());
+		const Primitive::BufferInfo& b(mBufferVector[i]);
+		unsigned int bufferColorStart(b.vertexCount * dimension);
 
 		for (j = 0; j < b.vertexCount; ++j)
 		{
@@ -978,12 +969,40 @@ Primitive::BufferInfo Legend::AssembleBuffers()
 			buffer.indexBuffer[m++] = ib + indexShift;
 
 		indexShift += b.vertexCount;
-
-		b.FreeOpenGLObjects();
 	}
 
 	ConfigureVertexArray(buffer);
-	mBufferVector.clear();
+	mBufferCount = 0;
+}
+
+//=============================================================================
+// Class:			Legend
+// Function:		GetNextBuffer
+//
+// Description:		Returns the next unused (and empty) buffer from the buffer
+//					vector.  Buffers are re-used between updates, so their
+//					storage is only allocated when the legend grows.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Primitive::BufferInfo&
+//
+//=============================================================================
+Primitive::BufferInfo& Legend::GetNextBuffer()
+{
+	if (mBufferCount == mBufferVector.size())
+		mBufferVector.push_back(Primitive::BufferInfo());
+
+	Primitive::BufferInfo& buffer(mBufferVector[mBufferCount++]);
+	buffer.vertexCount = 0;
+	buffer.vertexBuffer.clear();
+	buffer.indexBuffer.clear();
+	buffer.vertexCountModified = true;
 
 	return buffer;
 }
@@ -1022,9 +1041,8 @@ void Legend::BuildSampleLines()
 
 		y -= mEntrySpacing + mTextHeight;
 
-		mBufferVector.push_back(BufferInfo());
 		mLines.Build(x + mEntrySpacing, y, x + mEntrySpacing + mSampleLength,
-			y, mBufferVector.back(), Line::UpdateMethod::Manual);
+			y, GetNextBuffer(), Line::UpdateMethod::Manual);
 	}
 }
 
@@ -1052,6 +1070,8 @@ void Legend::ConfigureVertexArray(Primitive::BufferInfo& bufferInfo) const
 	glBindBuffer(GL_ARRAY_BUFFER, bufferInfo.GetVertexBufferIndex());
 	glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * bufferInfo.vertexBuffer.size(),
 		bufferInfo.vertexBuffer.data(), GL_DYNAMIC_DRAW);
+	RenderWindow::RecordUpload(bufferInfo.vertexCount,
+		sizeof(GLfloat) * bufferInfo.vertexBuffer.size());
 
 	glEnableVertexAttribArray(mRenderWindow.GetDefaultPositionLocation());
 	glVertexAttribPointer(mRenderWindow.GetDefaultPositionLocation(),
@@ -1064,6 +1084,7 @@ void Legend::ConfigureVertexArray(Primitive::BufferInfo& bufferInfo) const
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferInfo.GetIndexBufferIndex());
 	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * bufferInfo.indexBuffer.size(),
 		bufferInfo.indexBuffer.data(), GL_DYNAMIC_DRAW);
+	RenderWindow::RecordUpload(0, sizeof(GLuint) * bufferInfo.indexBuffer.size());
 
 	glBindVertexArray(0);
 }
@@ -47,6 +47,7 @@ PlotCursor::PlotCursor(RenderWindow &mRenderWindow, const Axis &axis)
 	mLine.SetLineColor(mColor);
 
 	SetDrawOrder(2800);
+	SetIsOverlay(true);
 }
 
 //=============================================================================
@@ -70,13 +71,13 @@ void PlotCursor::Update(const unsigned int& /*i*/)
 	if (mAxis.IsHorizontal())
 	{
 		mLine.Build(mLocationAlongAxis, mAxis.GetOffsetFromWindowEdge(),
-			mLocationAlongAxis, mRenderWindow.GetSize().GetHeight()
+			mLocationAlongAxis, mRenderWindow.GetRenderSize().GetHeight()
 			- mAxis.GetOppositeAxis()->GetOffsetFromWindowEdge(), mBufferInfo[0]);
 	}
 	else
 	{
 		mLine.Build(mAxis.GetOffsetFromWindowEdge(), mLocationAlongAxis,
-			mRenderWindow.GetSize().GetWidth()
+			mRenderWindow.GetRenderSize().GetWidth()
 			- mAxis.GetOppositeAxis()->GetOffsetFromWindowEdge(),
 			mLocationAlongAxis, mBufferInfo[0]);
 	}
@@ -16,15 +16,39 @@
 
 // Local headers
 #include "lp2d/renderer/primitives/plotCurve.h"
+#include "lp2d/renderer/primitives/plotCurveBatch.h"
 #include "lp2d/renderer/renderWindow.h"
 #include "lp2d/renderer/plotRenderer.h"
 #include "lp2d/renderer/primitives/axis.h"
 #include "lp2d/utilities/dataset2D.h"
 #include "lp2d/utilities/math/plotMath.h"
 
+// Standard C++ headers
+#include <algorithm>
+#include <cmath>
+
 namespace LibPlot2D
 {
 
+//=============================================================================
+// Class:			PlotCurve
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for PlotCurve class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const double PlotCurve::mLineSizeScale(1.2);
+const unsigned int PlotCurve::mMaximumSearchCount(65536);
+
 //=============================================================================
 // Class:			PlotCurve
 // Function:		PlotCurve
@@ -43,10 +67,8 @@ namespace LibPlot2D
 //
 //=============================================================================
 PlotCurve::PlotCurve(RenderWindow &renderWindow, const Dataset2D& data)
-	: Primitive(renderWindow), mData(data), mLine(renderWindow)
+	: Primitive(renderWindow), mData(data), mSpatialIndex(data)
 {
-	mLine.SetBufferHint(GL_STATIC_DRAW);
-	mBufferInfo.resize(2);// First one for lines, second one for the markers
 }
 
 //=============================================================================
@@ -66,19 +88,21 @@ PlotCurve::PlotCurve(RenderWindow &renderWindow, const Dataset2D& data)
 //
 //=============================================================================
 PlotCurve::PlotCurve(const PlotCurve &plotCurve) : Primitive(plotCurve),
-	mData(plotCurve.mData), mLine(mRenderWindow)
+	mData(plotCurve.mData), mSpatialIndex(plotCurve.mData)
 {
 	*this = plotCurve;
 }
 
 //=============================================================================
 // Class:			PlotCurve
-// Function:		InitializeMarkerVertexBuffer
+// Function:		SetDataAppended
 //
-// Description:		Initializes the vertex buffer for storing the marker information.
+// Description:		Flags the data as extended.  If the new points change the
+//					classification of the data (i.e. the x-values are no
+//					longer sorted), the data is flagged as modified instead.
 //
 // Input Arguments:
-//		i	= const unsigned int&
+//		count	= const unsigned int&
 //
 // Output Arguments:
 //		None
@@ -87,26 +111,41 @@ PlotCurve::PlotCurve(const PlotCurve &plotCurve) : Primitive(plotCurve),
 //		None
 //
 //=============================================================================
-void PlotCurve::InitializeMarkerVertexBuffer()
+void PlotCurve::SetDataAppended(const unsigned int& count)
 {
-	mBufferInfo[1].GetOpenGLIndices();
-
-	mBufferInfo[1].vertexCount = mData.GetNumberOfPoints() * 6;
-	mBufferInfo[1].vertexBuffer.resize(mBufferInfo[1].vertexCount
-		* (mRenderWindow.GetVertexDimension() + 4));
-	assert(mRenderWindow.GetVertexDimension() == 2);
+	mModified = true;
+	mReceivesAppends = true;
+	if (mDataModified || count == 0)
+		return;
+
+	// Only the new points (and the last old point) need to be checked
+	const std::vector<double>& x(mData.GetX());
+	assert(count <= x.size());
+	const auto firstNew(x.end() - count);
+	if (mIsXY || !std::is_sorted(
+		firstNew == x.begin() ? firstNew : firstNew - 1, x.end()))
+	{
+		SetDataModified();
+		return;
+	}
 
-	mBufferInfo[1].vertexCountModified = false;
+	mAppendedCount += count;
 }
 
 //=============================================================================
 // Class:			PlotCurve
-// Function:		Update
+// Function:		BuildVertices
 //
-// Description:		Updates the GL buffers associated with this object.
+// Description:		Fills the vertex buffer with the specified points.  The
+//					first and last points are repeated so the buffer can be
+//					drawn as a line strip with adjacency (the repeated points
+//					indicate the ends of the curve).  If there are no points,
+//					the buffer is emptied.  The vertex buffer holds only the
+//					positions; colors are stored in mVertexColors.
 //
 // Input Arguments:
-//		i	= const unsigned int&
+//		x	= const std::vector<double>&
+//		y	= const std::vector<double>&
 //
 // Output Arguments:
 //		None
@@ -115,106 +154,150 @@ void PlotCurve::InitializeMarkerVertexBuffer()
 //		None
 //
 //=============================================================================
-void PlotCurve::Update(const unsigned int& i)
+void PlotCurve::BuildVertices(const std::vector<double>& x,
+	const std::vector<double>& y)
 {
-	if (i == 0)
-	{
-		int width, height;
-		mRenderWindow.GetSize(&width, &height);
-		width -= mYAxis->GetOffsetFromWindowEdge()
-			+ mYAxis->GetOppositeAxis()->GetOffsetFromWindowEdge();
-		height -= mXAxis->GetOffsetFromWindowEdge()
-			+ mXAxis->GetOppositeAxis()->GetOffsetFromWindowEdge();
-
-		if (mXAxis->IsLogarithmic())
-			mXScale = (log10(mXAxis->GetMaximum()) - log10(mXAxis->GetMinimum())) / width;
-		else
-			mXScale = (mXAxis->GetMaximum() - mXAxis->GetMinimum()) / width;
+	assert(x.size() == y.size());
 
-		if (mYAxis->IsLogarithmic())
-			mYScale = (log10(mYAxis->GetMaximum()) - log10(mYAxis->GetMinimum())) / height;
-		else
-			mYScale = (mYAxis->GetMaximum() - mYAxis->GetMinimum()) / height;
+	const unsigned int dimension(mRenderWindow.GetVertexDimension());
+	assert(dimension == 2);
 
-		if (mLineSize > 0.0)
-		{
-			const double lineSizeScale(1.2);
-
-			mLine.SetLineColor(mColor);
-			mLine.SetBackgroundColorForAlphaFade();
-			mLine.SetWidth(mLineSize * lineSizeScale);
-			mLine.SetXScale(mXScale);
-			mLine.SetYScale(mYScale);
-
-			std::vector<double> xLogData;
-			std::vector<double> yLogData;
-			const std::vector<double>& xRef([this, &xLogData]()
-			{
-				if (mXAxis->IsLogarithmic())
-				{
-					xLogData = std::move(DoLogarithmicScale(mData.GetX()));
-					return xLogData;
-				}
-				else
-					return mData.GetX();
-			}());
-
-			const std::vector<double>& yRef([this, &yLogData]()
-			{
-				if (mYAxis->IsLogarithmic())
-				{
-					yLogData = std::move(DoLogarithmicScale(mData.GetY()));
-					return yLogData;
-				}
-				else
-					return mData.GetY();
-			}());
-
-			mLine.Build(xRef, yRef, mBufferInfo[i]);
-		}
-		else
-			mLine.SetWidth(0.0);
-	}
-	else
+	BufferInfo& bufferInfo(mBufferInfo[0]);
+	bufferInfo.vertexCountModified = false;
+	mBatchedVertexCount = 0;
+	if (x.empty())
 	{
-		if (mBufferInfo[i].vertexCountModified)
-			InitializeMarkerVertexBuffer();
+		bufferInfo.vertexCount = 0;
+		bufferInfo.vertexBuffer.clear();
+		mVertexColors.clear();
+		return;
+	}
 
-		BuildMarkers();
+	bufferInfo.vertexCount = x.size() + 2;
+	bufferInfo.vertexBuffer.resize(bufferInfo.vertexCount * dimension);
+	mVertexColors.resize(bufferInfo.vertexCount * 4);
+	SetVertices(0, x, y);
+}
 
-		glBindVertexArray(mBufferInfo[i].GetVertexArrayIndex());
+//=============================================================================
+// Class:			PlotCurve
+// Function:		CanAppendVertices
+//
+// Description:		Checks to see if the vertex data can be updated by adding
+//					vertices for the appended points (i.e. the existing
+//					vertices were built from all of the other points, with
+//					the current color).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//=============================================================================
+bool PlotCurve::CanAppendVertices() const
+{
+	if (mAppendedCount == 0 || mBufferInfo[0].vertexCount + mAppendedCount !=
+		mData.GetNumberOfPoints() + 2)
+		return false;
 
-		glBindBuffer(GL_ARRAY_BUFFER, mBufferInfo[i].GetVertexBufferIndex());
-		glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * mBufferInfo[i].vertexBuffer.size(),
-			mBufferInfo[i].vertexBuffer.data(), GL_DYNAMIC_DRAW);
+	return mVertexColors[0] == static_cast<float>(mColor.GetRed()) &&
+		mVertexColors[1] == static_cast<float>(mColor.GetGreen()) &&
+		mVertexColors[2] == static_cast<float>(mColor.GetBlue()) &&
+		mVertexColors[3] == static_cast<float>(mColor.GetAlpha());
+}
 
-		glEnableVertexAttribArray(mRenderWindow.GetDefaultPositionLocation());
-		glVertexAttribPointer(mRenderWindow.GetDefaultPositionLocation(), 2, GL_FLOAT, GL_FALSE, 0, 0);
+//=============================================================================
+// Class:			PlotCurve
+// Function:		AppendVertices
+//
+// Description:		Adds vertices for the points appended since the vertex
+//					data was built.  The repeated last point is replaced by
+//					the first new point.
+//
+// Input Arguments:
+//		x	= const std::vector<double>&
+//		y	= const std::vector<double>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurve::AppendVertices(const std::vector<double>& x,
+	const std::vector<double>& y)
+{
+	assert(x.size() == y.size());
 
-		glEnableVertexAttribArray(mRenderWindow.GetDefaultColorLocation());
-		glVertexAttribPointer(mRenderWindow.GetDefaultColorLocation(), 4, GL_FLOAT, GL_FALSE, 0,
-			(void*)(sizeof(GLfloat) * mRenderWindow.GetVertexDimension() * mBufferInfo[i].vertexCount));
+	BufferInfo& bufferInfo(mBufferInfo[0]);
+	const unsigned int firstVertex(bufferInfo.vertexCount - 1);
+	bufferInfo.vertexCount = x.size() + 2;
+	bufferInfo.vertexBuffer.resize(bufferInfo.vertexCount *
+		mRenderWindow.GetVertexDimension());
+	mVertexColors.resize(bufferInfo.vertexCount * 4);
+	SetVertices(firstVertex, x, y);
 
-		/*glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mBufferInfo[i].indexBufferIndex);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * mBufferInfo[i].indexBuffer.size(),
-			mBufferInfo[i].indexBuffer.data(), GL_DYNAMIC_DRAW);*/
-		// TODO:  Why doesn't this work?  Similar code worked just fine before switching to std::vector
+	mBatchedVertexCount = std::min(mBatchedVertexCount, firstVertex);
+}
 
-		glBindVertexArray(0);
+//=============================================================================
+// Class:			PlotCurve
+// Function:		SetVertices
+//
+// Description:		Fills the vertex data beginning with the specified vertex.
+//					Vertex i corresponds to point i - 1 (with the end points
+//					repeated).
+//
+// Input Arguments:
+//		first	= const unsigned int&
+//		x		= const std::vector<double>&
+//		y		= const std::vector<double>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurve::SetVertices(const unsigned int& first,
+	const std::vector<double>& x, const std::vector<double>& y)
+{
+	const unsigned int dimension(mRenderWindow.GetVertexDimension());
+	BufferInfo& bufferInfo(mBufferInfo[0]);
+	unsigned int i;
+	for (i = first; i < bufferInfo.vertexCount; ++i)
+	{
+		const unsigned int j(std::min<unsigned int>(
+			std::max(i, 1U) - 1, x.size() - 1));
+		bufferInfo.vertexBuffer[i * dimension] = static_cast<float>(x[j]);
+		bufferInfo.vertexBuffer[i * dimension + 1] = static_cast<float>(y[j]);
+
+		mVertexColors[i * 4] = static_cast<float>(mColor.GetRed());
+		mVertexColors[i * 4 + 1] = static_cast<float>(mColor.GetGreen());
+		mVertexColors[i * 4 + 2] = static_cast<float>(mColor.GetBlue());
+		mVertexColors[i * 4 + 3] = static_cast<float>(mColor.GetAlpha());
 	}
-
-	assert(!RenderWindow::GLHasError());
 }
 
 //=============================================================================
 // Class:			PlotCurve
-// Function:		GenerateGeometry
+// Function:		Update
 //
-// Description:		Creates the OpenGL instructions to create this object in
-//					the scene.
+// Description:		Updates the vertex data associated with this object.  The
+//					data is not scaled (scaling is done by the shaders), so
+//					this is only required when the data, decimation or color
+//					changes (or when the limits change, for curves that only
+//					buffer the visible points).  When points were only
+//					appended, only vertices for the new points are added.
 //
 // Input Arguments:
-//		None
+//		i	= const unsigned int&
 //
 // Output Arguments:
 //		None
@@ -223,37 +306,71 @@ void PlotCurve::Update(const unsigned int& i)
 //		None
 //
 //=============================================================================
-void PlotCurve::GenerateGeometry()
+void PlotCurve::Update(const unsigned int& i)
 {
-	if (mYAxis->GetOrientation() == Axis::Orientation::Left)
-		dynamic_cast<PlotRenderer&>(mRenderWindow).LoadModelviewUniform(PlotRenderer::Modelview::Left);
-	else
-		dynamic_cast<PlotRenderer&>(mRenderWindow).LoadModelviewUniform(PlotRenderer::Modelview::Right);
-
-	glEnable(GL_SCISSOR_TEST);
+	assert(i == 0);
 
-	if (mLineSize > 0.0)
+	if (mDataModified)
 	{
-		glBindVertexArray(mBufferInfo[0].GetVertexArrayIndex());
-
-		if (mPretty)
-			Line::DoPrettyDraw(mBufferInfo[0].indexBuffer.size());
+		mIsXY = !std::is_sorted(mData.GetX().begin(), mData.GetX().end());
+		if (mIsXY)
+			mSpatialIndex.Rebuild();
 		else
-			Line::DoUglyDraw(mBufferInfo[0].vertexCount);
+			mSpatialIndex.Clear();
+		mDataModified = false;
+		mAppendedCount = 0;
 	}
 
-	if (NeedsMarkersDrawn())
+	if (UsesScreenSpaceDecimation())
+	{
+		std::vector<double> xVisible, yVisible;
+		DecimateToPixels(xVisible, yVisible);
+		BuildVertices(xVisible, yVisible);
+	}
+	else if (mDecimation > 1)
 	{
-		glBindVertexArray(mBufferInfo[1].GetVertexArrayIndex());
-		glDrawArrays(GL_TRIANGLES, 0, mBufferInfo[1].vertexCount);
+		std::vector<double> xDecimated, yDecimated;
+		Decimate(mData.GetX(), mData.GetY(), mDecimation, xDecimated, yDecimated);
+		BuildVertices(xDecimated, yDecimated);
 	}
+	else if (CanAppendVertices())
+	{
+		AppendVertices(mData.GetX(), mData.GetY());
+		mAppendedCount = 0;
 
-	glBindVertexArray(0);
-	glDisable(GL_SCISSOR_TEST);
+		// The batch only copies the new vertices
+		if (mBatch)
+			mBatch->SetModified();
+		return;
+	}
+	else
+		BuildVertices(mData.GetX(), mData.GetY());
 
-	assert(!RenderWindow::GLHasError());
+	mAppendedCount = 0;
+	if (mBatch)
+		mBatch->SetGeometryModified();
+}
 
-	dynamic_cast<PlotRenderer&>(mRenderWindow).LoadModelviewUniform(PlotRenderer::Modelview::Fixed);
+//=============================================================================
+// Class:			PlotCurve
+// Function:		GenerateGeometry
+//
+// Description:		Creates the OpenGL instructions to create this object in
+//					the scene.  Curves are drawn by their PlotCurveBatch, so
+//					there is nothing to do here.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurve::GenerateGeometry()
+{
 }
 
 //=============================================================================
@@ -280,6 +397,191 @@ bool PlotCurve::PointIsValid(const unsigned int &i) const
 		PlotMath::IsValid<double>(mData.GetY()[i]);
 }
 
+//=============================================================================
+// Class:			PlotCurve
+// Function:		FindNearestPoint
+//
+// Description:		Finds the point closest to the specified location.  Data
+//					with sorted x-values is searched outward from the location
+//					(found by binary search), stopping once the x-distance
+//					alone exceeds the closest distance found so far.  For very
+//					dense data, the number of points examined on each side is
+//					limited, so the time is bounded.  Otherwise, the spatial
+//					index is used.
+//
+// Input Arguments:
+//		x		= const double&
+//		y		= const double&
+//		xRange	= const double&
+//		yRange	= const double&
+//
+// Output Arguments:
+//		index	= unsigned int&
+//
+// Return Value:
+//		bool, true if a point was found
+//
+//=============================================================================
+bool PlotCurve::FindNearestPoint(const double& x, const double& y,
+	const double& xRange, const double& yRange, unsigned int& index) const
+{
+	assert(xRange > 0.0 && yRange > 0.0);
+
+	if (mIsXY)
+		return mSpatialIndex.FindNearest(x, y, xRange, yRange, index);
+
+	const std::vector<double>& xData(mData.GetX());
+	const std::vector<double>& yData(mData.GetY());
+	const unsigned int center(static_cast<unsigned int>(
+		std::lower_bound(xData.begin(), xData.end(), x) - xData.begin()));
+
+	double closest(2.0);// Corner of the search rectangle
+	bool found(false);
+	auto test([&xData, &yData, &x, &y, &xRange, &yRange, &closest, &index,
+		&found](const unsigned int& i)
+	{
+		const double dx((xData[i] - x) / xRange);
+		if (fabs(dx) > 1.0 || dx * dx > closest)
+			return false;
+
+		const double dy((yData[i] - y) / yRange);
+		const double distance(dx * dx + dy * dy);
+		if (fabs(dy) <= 1.0 && distance < closest)
+		{
+			closest = distance;
+			index = i;
+			found = true;
+		}
+
+		return true;
+	});
+
+	unsigned int i;
+	for (i = center; i < xData.size() && i - center < mMaximumSearchCount; ++i)
+	{
+		if (!test(i))
+			break;
+	}
+
+	for (i = center; i > 0 && center - i < mMaximumSearchCount; --i)
+	{
+		if (!test(i - 1))
+			break;
+	}
+
+	return found;
+}
+
+//=============================================================================
+// Class:			PlotCurve
+// Function:		GetPlotAreaSize
+//
+// Description:		Returns the size of the area between the axes.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		width	= int& [pixels]
+//		height	= int& [pixels]
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurve::GetPlotAreaSize(int& width, int& height) const
+{
+	width = mRenderWindow.GetRenderSize().GetWidth()
+		- static_cast<int>(mXAxis->GetAxisAtMaxEnd()->GetOffsetFromWindowEdge())
+		- static_cast<int>(mXAxis->GetAxisAtMinEnd()->GetOffsetFromWindowEdge());
+	height = mRenderWindow.GetRenderSize().GetHeight()
+		- static_cast<int>(mYAxis->GetAxisAtMaxEnd()->GetOffsetFromWindowEdge())
+		- static_cast<int>(mYAxis->GetAxisAtMinEnd()->GetOffsetFromWindowEdge());
+}
+
+//=============================================================================
+// Class:			PlotCurve
+// Function:		DecimateToPixels
+//
+// Description:		Selects the points to buffer for curves drawn with markers
+//					only.  Points outside of the visible area are skipped, and
+//					only the first point within each pixel is kept, so the
+//					number of points is limited by the size of the plot area.
+//					The visible area is expanded by the marker size, so markers
+//					straddling the edges are not lost.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		xOut	= std::vector<double>&
+//		yOut	= std::vector<double>&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurve::DecimateToPixels(std::vector<double>& xOut,
+	std::vector<double>& yOut) const
+{
+	xOut.clear();
+	yOut.clear();
+
+	int width, height;
+	GetPlotAreaSize(width, height);
+	if (width <= 0 || height <= 0)
+		return;
+
+	const bool xLog(mXAxis->IsLogarithmic());
+	const bool yLog(mYAxis->IsLogarithmic());
+	auto scale([](const double& value, const bool& logarithmic)
+	{
+		return logarithmic ? log10(value) : value;
+	});
+	auto unscale([](const double& value, const bool& logarithmic)
+	{
+		return logarithmic ? pow(10.0, value) : value;
+	});
+
+	const double xMin(scale(mXAxis->GetMinimum(), xLog));
+	const double yMin(scale(mYAxis->GetMinimum(), yLog));
+	const double xPixelScale(width / (scale(mXAxis->GetMaximum(), xLog) - xMin));
+	const double yPixelScale(height / (scale(mYAxis->GetMaximum(), yLog) - yMin));
+	if (!PlotMath::IsValid(xPixelScale) || !PlotMath::IsValid(yPixelScale) ||
+		xPixelScale <= 0.0 || yPixelScale <= 0.0)
+		return;
+
+	const int margin(static_cast<int>(ceil(2.0 * fabs(mMarkerSize))) + 1);
+	std::vector<unsigned int> indices;
+	mSpatialIndex.FindInRectangle(
+		unscale(xMin - margin / xPixelScale, xLog),
+		unscale(xMin + (width + margin) / xPixelScale, xLog),
+		unscale(yMin - margin / yPixelScale, yLog),
+		unscale(yMin + (height + margin) / yPixelScale, yLog), indices);
+
+	const int columns(width + 2 * margin);
+	const int rows(height + 2 * margin);
+	std::vector<bool> occupied(columns * rows, false);
+	xOut.reserve(std::min<size_t>(indices.size(), occupied.size()));
+	yOut.reserve(xOut.capacity());
+
+	const std::vector<double>& x(mData.GetX());
+	const std::vector<double>& y(mData.GetY());
+	for (const auto& i : indices)
+	{
+		const int column(std::min(std::max(static_cast<int>(floor(
+			(scale(x[i], xLog) - xMin) * xPixelScale)) + margin, 0), columns - 1));
+		const int row(std::min(std::max(static_cast<int>(floor(
+			(scale(y[i], yLog) - yMin) * yPixelScale)) + margin, 0), rows - 1));
+		if (occupied[row * columns + column])
+			continue;
+
+		occupied[row * columns + column] = true;
+		xOut.push_back(x[i]);
+		yOut.push_back(y[i]);
+	}
+}
+
 //=============================================================================
 // Class:			PlotCurve
 // Function:		HasValidParameters
@@ -336,117 +638,78 @@ PlotCurve& PlotCurve::operator=(const PlotCurve &plotCurve)
 
 //=============================================================================
 // Class:			PlotCurve
-// Function:		BuildMarkers
+// Function:		Decimate
 //
-// Description:		Plots markers at all un-interpolated points.
+// Description:		Reduces the number of points in the curve by the specified
+//					factor.  The data is divided into buckets of 2 * factor
+//					points, and only the minimum and maximum y-values within
+//					each bucket are kept (in their original order), so that
+//					peaks are preserved.
 //
 // Input Arguments:
-//		None
+//		x		= const std::vector<double>&
+//		y		= const std::vector<double>&
+//		factor	= const unsigned int&
 //
 // Output Arguments:
-//		None
+//		xOut	= std::vector<double>&
+//		yOut	= std::vector<double>&
 //
 // Return Value:
 //		None
 //
 //=============================================================================
-void PlotCurve::BuildMarkers()
+void PlotCurve::Decimate(const std::vector<double>& x,
+	const std::vector<double>& y, const unsigned int& factor,
+	std::vector<double>& xOut, std::vector<double>& yOut)
 {
-	float halfMarkerYSize = 2 * mMarkerSize * mYScale;
-	float halfMarkerXSize = 2 * mMarkerSize * mXScale;
-	const unsigned int dimension(mRenderWindow.GetVertexDimension());
-	const unsigned int colorStart(mData.GetNumberOfPoints() * dimension * 6);
-
-	// Use function pointers to save a few checks in the loop
-	PlotRenderer::ScalingFunction xScaleFunction(
-		dynamic_cast<PlotRenderer&>(mRenderWindow).GetXScaleFunction());
-	PlotRenderer::ScalingFunction yScaleFunction;
-
-	if (mYAxis->GetOrientation() == Axis::Orientation::Left)
-		yScaleFunction = dynamic_cast<PlotRenderer&>(mRenderWindow).GetLeftYScaleFunction();
-	else
-		yScaleFunction = dynamic_cast<PlotRenderer&>(mRenderWindow).GetRightYScaleFunction();
-
-	unsigned int i;
-	for (i = 0; i < mData.GetNumberOfPoints(); ++i)
+	assert(x.size() == y.size());
+	const unsigned int bucketSize(2 * factor);
+	xOut.clear();
+	yOut.clear();
+	xOut.reserve(x.size() / factor + 2);
+	yOut.reserve(y.size() / factor + 2);
+
+	// Always keep the end points so the curve doesn't appear to be truncated
+	if (!x.empty())
 	{
-		float x(static_cast<float>(xScaleFunction(mData.GetX()[i])));
-		float y(static_cast<float>(yScaleFunction(mData.GetY()[i])));
-
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension] = x + halfMarkerXSize;
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 1] = y + halfMarkerYSize;
-
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + dimension] = x - halfMarkerXSize;
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + dimension + 1] = y + halfMarkerYSize;
-
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 2 * dimension] = x - halfMarkerXSize;
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 2 * dimension + 1] = y - halfMarkerYSize;
-
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 3 * dimension] = x + halfMarkerXSize;
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 3 * dimension + 1] = y + halfMarkerYSize;
-
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 4 * dimension] = x - halfMarkerXSize;
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 4 * dimension + 1] = y - halfMarkerYSize;
-
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 5 * dimension] = x + halfMarkerXSize;
-		mBufferInfo[1].vertexBuffer[i * 6 * dimension + 5 * dimension + 1] = y - halfMarkerYSize;
-
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24] = static_cast<float>(mColor.GetRed());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 1] = static_cast<float>(mColor.GetGreen());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 2] = static_cast<float>(mColor.GetBlue());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 3] = static_cast<float>(mColor.GetAlpha());
-
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 4] = static_cast<float>(mColor.GetRed());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 5] = static_cast<float>(mColor.GetGreen());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 6] = static_cast<float>(mColor.GetBlue());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 7] = static_cast<float>(mColor.GetAlpha());
-
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 8] = static_cast<float>(mColor.GetRed());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 9] = static_cast<float>(mColor.GetGreen());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 10] = static_cast<float>(mColor.GetBlue());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 11] = static_cast<float>(mColor.GetAlpha());
+		xOut.push_back(x.front());
+		yOut.push_back(y.front());
+	}
 
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 12] = static_cast<float>(mColor.GetRed());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 13] = static_cast<float>(mColor.GetGreen());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 14] = static_cast<float>(mColor.GetBlue());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 15] = static_cast<float>(mColor.GetAlpha());
+	unsigned int start;
+	for (start = 0; start < x.size(); start += bucketSize)
+	{
+		const unsigned int end(std::min<unsigned int>(start + bucketSize, x.size()));
+		unsigned int minIndex(start), maxIndex(start), i;
+		for (i = start + 1; i < end; ++i)
+		{
+			if (y[i] < y[minIndex])
+				minIndex = i;
+			else if (y[i] > y[maxIndex])
+				maxIndex = i;
+		}
 
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 16] = static_cast<float>(mColor.GetRed());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 17] = static_cast<float>(mColor.GetGreen());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 18] = static_cast<float>(mColor.GetBlue());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 19] = static_cast<float>(mColor.GetAlpha());
+		const unsigned int first(std::min(minIndex, maxIndex));
+		const unsigned int second(std::max(minIndex, maxIndex));
+		if (first > 0)
+		{
+			xOut.push_back(x[first]);
+			yOut.push_back(y[first]);
+		}
 
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 20] = static_cast<float>(mColor.GetRed());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 21] = static_cast<float>(mColor.GetGreen());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 22] = static_cast<float>(mColor.GetBlue());
-		mBufferInfo[1].vertexBuffer[colorStart + i * 24 + 23] = static_cast<float>(mColor.GetAlpha());
+		if (second != first)
+		{
+			xOut.push_back(x[second]);
+			yOut.push_back(y[second]);
+		}
 	}
-}
 
-//=============================================================================
-// Class:			PlotCurve
-// Function:		DoLogarithmicScale
-//
-// Description:		Handles scaling for arrays of logarithmic data.
-//
-// Input Arguments:
-//		value	= const std::vector<double>&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		std::vector<double>
-//
-//=============================================================================
-std::vector<double> PlotCurve::DoLogarithmicScale(
-	const std::vector<double>& values)
-{
-	std::vector<double> scaledValues(values);
-	for (auto& v : scaledValues)
-		v = PlotRenderer::DoLogarithmicScale(v);
-
-	return scaledValues;
+	if (x.size() > 1 && xOut.back() != x.back())
+	{
+		xOut.push_back(x.back());
+		yOut.push_back(y.back());
+	}
 }
 
 //=============================================================================
@@ -471,6 +734,9 @@ bool PlotCurve::RangeIsSmall() const
 	if (mData.GetNumberOfPoints() < 2)
 		return false;
 
+	if (mIsXY)
+		return XYRangeIsSmall();
+
 	switch (XRangeIsSmall())
 	{
 	case RangeSize::Small:
@@ -517,7 +783,7 @@ PlotCurve::RangeSize PlotCurve::XRangeIsSmall() const
 	if (points == 0)
 		return RangeSize::Small;
 
-	const unsigned int spacing((mRenderWindow.GetSize().GetWidth()
+	const unsigned int spacing((mRenderWindow.GetRenderSize().GetWidth()
 		- mXAxis->GetAxisAtMaxEnd()->GetOffsetFromWindowEdge()
 		- mXAxis->GetAxisAtMinEnd()->GetOffsetFromWindowEdge()) / points);
 
@@ -557,7 +823,7 @@ PlotCurve::RangeSize PlotCurve::YRangeIsSmall() const
 	if (points == 0)
 		return RangeSize::Small;
 
-	const unsigned int spacing((mRenderWindow.GetSize().GetHeight()
+	const unsigned int spacing((mRenderWindow.GetRenderSize().GetHeight()
 		- mYAxis->GetAxisAtMaxEnd()->GetOffsetFromWindowEdge()
 		- mYAxis->GetAxisAtMinEnd()->GetOffsetFromWindowEdge()) / points);
 
@@ -567,6 +833,63 @@ PlotCurve::RangeSize PlotCurve::YRangeIsSmall() const
 	return RangeSize::Large;
 }
 
+//=============================================================================
+// Class:			PlotCurve
+// Function:		XYRangeIsSmall
+//
+// Description:		Determines if the range is small enough to warrant
+//					drawing the point markers for data with unsorted x-values.
+//					Uses the same criteria as XRangeIsSmall() and
+//					YRangeIsSmall(), but applied to the number of points within
+//					the visible area.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//=============================================================================
+bool PlotCurve::XYRangeIsSmall() const
+{
+	int width, height;
+	GetPlotAreaSize(width, height);
+	if (width <= 0 || height <= 0)
+		return false;
+
+	const unsigned int limit(static_cast<unsigned int>(width * height / 49) + 1);
+	return mSpatialIndex.CountInRectangle(mXAxis->GetMinimum(),
+		mXAxis->GetMaximum(), mYAxis->GetMinimum(), mYAxis->GetMaximum(),
+		limit) < limit;
+}
+
+//=============================================================================
+// Class:			PlotCurve
+// Function:		HasSortedX
+//
+// Description:		Checks to see if the x-values are sorted.  Uses the result
+//					from the last update unless the data has since changed.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//=============================================================================
+bool PlotCurve::HasSortedX() const
+{
+	if (mDataModified)
+		return std::is_sorted(mData.GetX().begin(), mData.GetX().end());
+	return !mIsXY;
+}
+
 //=============================================================================
 // Class:			PlotCurve
 // Function:		NeedsMarkersDrawn
@@ -0,0 +1,813 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  plotCurveBatch.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Derived from Primitive for rendering many plot curves with a small
+//        number of draw calls.
+
+// GLEW headers
+#include <GL/glew.h>
+
+// Local headers
+#include "lp2d/renderer/primitives/plotCurveBatch.h"
+#include "lp2d/renderer/primitives/plotCurve.h"
+#include "lp2d/renderer/curveBufferPool.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for PlotCurveBatch class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string PlotCurveBatch::mModeName("mode");
+const std::string PlotCurveBatch::mSizeName("size");
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		mVertexShader
+//
+// Description:		Curve vertex shader.  Applies the logarithmic scaling and
+//					the modelview matrix, so the output is in pixels.
+//
+// Input Arguments:
+//		0	= position
+//		1	= color
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string PlotCurveBatch::mVertexShader(
+	"#version 400\n"
+	"\n"
+	"uniform mat4 modelviewMatrix;\n"
+	"uniform bvec2 logarithmic;\n"
+	"\n"
+	"layout(location = 0) in vec2 position;\n"
+	"layout(location = 1) in vec4 color;\n"
+	"\n"
+	"out vec4 vertexColor;\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"    vertexColor = color;\n"
+	"    vec2 scaledPosition = mix(position, log2(position) * 0.30102999566, logarithmic);\n"
+	"    gl_Position = modelviewMatrix * vec4(scaledPosition, 0.0, 1.0);\n"
+	"}\n"
+);
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		mGeometryShader
+//
+// Description:		Curve geometry shader.  Input is a line strip with
+//					adjacency where the end points are repeated.  In line mode,
+//					each segment is expanded into a band of triangles mitered
+//					to meet the adjacent segments, with the outer edges faded
+//					for anti-aliasing.  In marker mode, a square is emitted at
+//					each point.  In density mode, only the central band is
+//					emitted, with a value of one for accumulating hit counts.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string PlotCurveBatch::mGeometryShader(
+	"#version 400\n"
+	"\n"
+	"layout(lines_adjacency) in;\n"
+	"layout(triangle_strip, max_vertices = 8) out;\n"
+	"\n"
+	"uniform mat4 projectionMatrix;\n"
+	"uniform int mode;// 0 for lines, 1 for markers, 2 for density\n"
+	"uniform float size;// Line width or marker half-size [pixels]\n"
+	"\n"
+	"in vec4 vertexColor[];\n"
+	"\n"
+	"out vec4 fragmentColor;\n"
+	"\n"
+	"const float fadeDistance = 0.05;\n"
+	"const float minimumMiterCosine = 0.25;\n"
+	"\n"
+	"bool IsValid(vec2 p)\n"
+	"{\n"
+	"    return !any(isnan(p)) && !any(isinf(p));\n"
+	"}\n"
+	"\n"
+	"void Emit(vec2 p, vec4 color)\n"
+	"{\n"
+	"    gl_Position = projectionMatrix * vec4(p, 0.0, 1.0);\n"
+	"    fragmentColor = color;\n"
+	"    EmitVertex();\n"
+	"}\n"
+	"\n"
+	"void EmitMarker(vec2 p, vec4 color)\n"
+	"{\n"
+	"    Emit(p + vec2(-size, -size), color);\n"
+	"    Emit(p + vec2(size, -size), color);\n"
+	"    Emit(p + vec2(-size, size), color);\n"
+	"    Emit(p + vec2(size, size), color);\n"
+	"    EndPrimitive();\n"
+	"}\n"
+	"\n"
+	"vec2 GetMiter(vec2 adjacentDirection, vec2 direction, vec2 normal)\n"
+	"{\n"
+	"    vec2 tangent = adjacentDirection + direction;\n"
+	"    if (dot(tangent, tangent) < 1.0e-6)\n"
+	"        return normal;\n"
+	"\n"
+	"    tangent = normalize(tangent);\n"
+	"    vec2 miter = vec2(-tangent.y, tangent.x);\n"
+	"    return miter / max(dot(miter, normal), minimumMiterCosine);\n"
+	"}\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"    vec2 p0 = gl_in[0].gl_Position.xy;\n"
+	"    vec2 p1 = gl_in[1].gl_Position.xy;\n"
+	"    vec2 p2 = gl_in[2].gl_Position.xy;\n"
+	"    vec2 p3 = gl_in[3].gl_Position.xy;\n"
+	"\n"
+	"    if (mode == 1)\n"
+	"    {\n"
+	"        if (IsValid(p1))\n"
+	"            EmitMarker(p1, vertexColor[1]);\n"
+	"        if (p3 == p2 && IsValid(p2))// Last segment\n"
+	"            EmitMarker(p2, vertexColor[2]);\n"
+	"        return;\n"
+	"    }\n"
+	"\n"
+	"    if (!IsValid(p1) || !IsValid(p2) || p1 == p2)\n"
+	"        return;\n"
+	"\n"
+	"    vec2 direction = normalize(p2 - p1);\n"
+	"    vec2 normal = vec2(-direction.y, direction.x);\n"
+	"    vec2 offset1 = normal;\n"
+	"    vec2 offset2 = normal;\n"
+	"    if (IsValid(p0) && p0 != p1)\n"
+	"        offset1 = GetMiter(normalize(p1 - p0), direction, normal);\n"
+	"    if (IsValid(p3) && p3 != p2)\n"
+	"        offset2 = GetMiter(normalize(p3 - p2), direction, normal);\n"
+	"\n"
+	"    float halfWidth = 0.5 * size;\n"
+	"    if (mode == 2)\n"
+	"    {\n"
+	"        Emit(p1 + halfWidth * offset1, vec4(1.0));\n"
+	"        Emit(p2 + halfWidth * offset2, vec4(1.0));\n"
+	"        Emit(p1 - halfWidth * offset1, vec4(1.0));\n"
+	"        Emit(p2 - halfWidth * offset2, vec4(1.0));\n"
+	"        EndPrimitive();\n"
+	"        return;\n"
+	"    }\n"
+	"\n"
+	"    float edge = halfWidth + fadeDistance;\n"
+	"    vec4 fade1 = vec4(vertexColor[1].rgb, 0.0);\n"
+	"    vec4 fade2 = vec4(vertexColor[2].rgb, 0.0);\n"
+	"\n"
+	"    Emit(p1 + edge * offset1, fade1);\n"
+	"    Emit(p2 + edge * offset2, fade2);\n"
+	"    Emit(p1 + halfWidth * offset1, vertexColor[1]);\n"
+	"    Emit(p2 + halfWidth * offset2, vertexColor[2]);\n"
+	"    Emit(p1 - halfWidth * offset1, vertexColor[1]);\n"
+	"    Emit(p2 - halfWidth * offset2, vertexColor[2]);\n"
+	"    Emit(p1 - edge * offset1, fade1);\n"
+	"    Emit(p2 - edge * offset2, fade2);\n"
+	"    EndPrimitive();\n"
+	"}\n"
+);
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		mFragmentShader
+//
+// Description:		Curve fragment shader.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string PlotCurveBatch::mFragmentShader(
+	"#version 400\n"
+	"\n"
+	"in vec4 fragmentColor;\n"
+	"\n"
+	"out vec4 outputColor;\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"    outputColor = fragmentColor;\n"
+	"}\n"
+);
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		PlotCurveBatch
+//
+// Description:		Constructor for the PlotCurveBatch class.
+//
+// Input Arguments:
+//		renderer	= PlotRenderer&
+//		modelview	= const PlotRenderer::Modelview&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+PlotCurveBatch::PlotCurveBatch(PlotRenderer& renderer,
+	const PlotRenderer::Modelview& modelview) : Primitive(renderer),
+	mRenderer(renderer), mModelview(modelview)
+{
+	// Curves must update their vertex data before it is collected here
+	SetDrawOrder(1001);
+}
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		~PlotCurveBatch
+//
+// Description:		Destructor for the PlotCurveBatch class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+PlotCurveBatch::~PlotCurveBatch()
+{
+	CurveBufferPool* pool(mRenderer.GetCurveBufferPool());
+	if (pool)
+		pool->Release(this);
+}
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		SetCurves
+//
+// Description:		Sets the list of curves to be rendered by this object.
+//
+// Input Arguments:
+//		curves	= const std::vector<PlotCurve*>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurveBatch::SetCurves(const std::vector<PlotCurve*>& curves)
+{
+	// Curves which are shown or hidden are handled in Update()
+	if (curves == mCurves)
+	{
+		mModified = true;
+		return;
+	}
+
+	mCurves = curves;
+	for (auto& curve : mCurves)
+		curve->SetBatch(this);
+
+	SetGeometryModified();
+}
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		RemoveCurve
+//
+// Description:		Removes the specified curve from the list of curves to be
+//					rendered by this object.
+//
+// Input Arguments:
+//		curve	= PlotCurve*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurveBatch::RemoveCurve(PlotCurve* curve)
+{
+	const auto it(std::find(mCurves.begin(), mCurves.end(), curve));
+	if (it == mCurves.end())
+		return;
+
+	mCurves.erase(it);
+	SetGeometryModified();
+}
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		HasValidParameters
+//
+// Description:		Checks to see if the information about this object is
+//					valid and complete (gives permission to create the object).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for OK to draw, false otherwise
+//
+//=============================================================================
+bool PlotCurveBatch::HasValidParameters()
+{
+	return !mCurves.empty();
+}
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		Update
+//
+// Description:		Updates the GL buffers associated with this object.  The
+//					buffer is only re-filled if the curve data changed (if
+//					points were only appended, only the new vertices are
+//					uploaded); the draw lists are always rebuilt, since they
+//					depend on the curve settings and the axis limits.
+//
+// Input Arguments:
+//		i	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurveBatch::Update(const unsigned int& i)
+{
+	assert(i == 0);
+	mRenderer.InitializePrimitiveType(*this);
+
+	if (mGeometryModified || !UploadAppendedVertices())
+	{
+		BuildVertexBuffer();
+		mGeometryModified = false;
+	}
+
+	BuildDrawLists();
+
+	assert(!RenderWindow::GLHasError());
+}
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		GenerateGeometry
+//
+// Description:		Creates the OpenGL instructions to create this object in
+//					the scene.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurveBatch::GenerateGeometry()
+{
+	if (mBufferInfo[0].vertexCount == 0)
+		return;
+
+	// Our region moves when the buffer grows for another batch
+	const CurveBufferPool& pool(*mRenderer.GetCurveBufferPool());
+	if (pool.GetFirstVertex(this) != mRegionFirst)
+	{
+		mRegionFirst = pool.GetFirstVertex(this);
+		BuildDrawLists();
+	}
+
+	glEnable(GL_SCISSOR_TEST);
+	glBindVertexArray(pool.GetVertexArray());
+
+	// Tiles of offscreen renderings must share a single color scale
+	if (mDensityMode && !mDensityLines.counts.empty() &&
+		mDensityMap.BeginAccumulation(!mRenderer.IsRenderingFirstTile()))
+	{
+		mRenderer.UseProgram(mRenderer.GetPrimitiveTypeProgram<PlotCurveBatch>());
+		mRenderer.LoadModelviewUniform(mModelview);
+
+		const RenderWindow::ShaderInfo& shaderInfo(mRenderer.GetActiveProgramInfo());
+		glUniform1i(shaderInfo.uniformLocations.find(mModeName)->second, 2);
+		DrawGroups(GL_LINE_STRIP_ADJACENCY, mDensityLines,
+			shaderInfo.uniformLocations.find(mSizeName)->second);
+
+		mDensityMap.EndAccumulation();
+		glBindVertexArray(0);
+		mRenderer.UseDefaultProgram();
+		glDisable(GL_SCISSOR_TEST);
+
+		assert(!RenderWindow::GLHasError());
+		return;
+	}
+
+	if (!mUglyLines.counts.empty())
+	{
+		mRenderer.LoadModelviewUniform(mModelview);
+		DrawGroups(GL_LINE_STRIP, mUglyLines, -1);
+		glLineWidth(1.0f);
+		mRenderer.LoadModelviewUniform(PlotRenderer::Modelview::Fixed);
+	}
+
+	if (!mPrettyLines.counts.empty() || !mMarkers.counts.empty())
+	{
+		mRenderer.UseProgram(mRenderer.GetPrimitiveTypeProgram<PlotCurveBatch>());
+		mRenderer.LoadModelviewUniform(mModelview);
+
+		const RenderWindow::ShaderInfo& shaderInfo(mRenderer.GetActiveProgramInfo());
+		const GLint modeLocation(shaderInfo.uniformLocations.find(mModeName)->second);
+		const GLint sizeLocation(shaderInfo.uniformLocations.find(mSizeName)->second);
+
+		glUniform1i(modeLocation, 0);
+		DrawGroups(GL_LINE_STRIP_ADJACENCY, mPrettyLines, sizeLocation);
+
+		glUniform1i(modeLocation, 1);
+		DrawGroups(GL_LINE_STRIP_ADJACENCY, mMarkers, sizeLocation);
+
+		mRenderer.UseDefaultProgram();
+	}
+
+	glBindVertexArray(0);
+	glDisable(GL_SCISSOR_TEST);
+
+	assert(!RenderWindow::GLHasError());
+}
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		DoGLInitialization
+//
+// Description:		Performs necessary context-state initialization.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		GLuint
+//
+//=============================================================================
+GLuint PlotCurveBatch::DoGLInitialization()
+{
+	std::vector<RenderWindow::ShaderSource> sources;
+	sources.push_back({ GL_VERTEX_SHADER, mVertexShader });
+	sources.push_back({ GL_GEOMETRY_SHADER, mGeometryShader });
+	sources.push_back({ GL_FRAGMENT_SHADER, mFragmentShader });
+
+	RenderWindow::ShaderInfo s;
+	s.programId = RenderWindow::CreateCachedProgram(sources);
+	s.needsModelview = false;
+	s.needsProjection = true;
+	s.uniformLocations[RenderWindow::mProjectionName] = glGetUniformLocation(s.programId, RenderWindow::mProjectionName.c_str());
+	s.uniformLocations[RenderWindow::mModelviewName] = glGetUniformLocation(s.programId, RenderWindow::mModelviewName.c_str());
+	s.uniformLocations[PlotRenderer::mLogarithmicName] = glGetUniformLocation(s.programId, PlotRenderer::mLogarithmicName.c_str());
+	s.uniformLocations[mModeName] = glGetUniformLocation(s.programId, mModeName.c_str());
+	s.uniformLocations[mSizeName] = glGetUniformLocation(s.programId, mSizeName.c_str());
+
+	assert(!RenderWindow::GLHasError());
+
+	return mRenderer.AddShader(s);
+}
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		BuildVertexBuffer
+//
+// Description:		Packs the vertex data for all visible curves into our
+//					region of the context's curve buffer.  Cells of a small
+//					multiples panel share the buffer (and the vertex array),
+//					so each dataset is uploaded once no matter how many
+//					windows share the context.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurveBatch::BuildVertexBuffer()
+{
+	const unsigned int dimension(mRenderer.GetVertexDimension());
+
+	mFirstVertices.assign(mCurves.size(), -1);
+	mCurveCapacities.assign(mCurves.size(), 0);
+	unsigned int vertexCount(0), capacity(0), i;
+	for (i = 0; i < mCurves.size(); ++i)
+	{
+		const PlotCurve& curve(*mCurves[i]);
+		const GLsizei count(curve.mBufferInfo[0].vertexCount);
+		if (!mCurves[i]->IsDrawable() || count == 0)
+			continue;
+
+		mFirstVertices[i] = capacity;
+		mCurveCapacities[i] = count + (curve.mReceivesAppends ? count / 4 : 0);
+		vertexCount += count;
+		capacity += mCurveCapacities[i];
+	}
+
+	BufferInfo& bufferInfo(mBufferInfo[0]);
+	bufferInfo.vertexCount = vertexCount;
+	bufferInfo.vertexCountModified = false;
+
+	CurveBufferPool& pool(*mRenderer.GetCurveBufferPool());
+	if (vertexCount == 0)
+	{
+		pool.Release(this);
+		mRegionFirst = -1;
+		return;
+	}
+
+	mRegionFirst = pool.Reserve(this, capacity);
+	for (i = 0; i < mCurves.size(); ++i)
+	{
+		if (mFirstVertices[i] < 0)
+			continue;
+
+		PlotCurve& curve(*mCurves[i]);
+		const BufferInfo& source(curve.mBufferInfo[0]);
+		assert(source.vertexBuffer.size() == source.vertexCount * dimension);
+		assert(curve.mVertexColors.size() == source.vertexCount * 4);
+
+		pool.Write(mRegionFirst + mFirstVertices[i], source.vertexCount,
+			source.vertexBuffer.data(), curve.mVertexColors.data());
+		curve.mBatchedVertexCount = source.vertexCount;
+	}
+}
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		UploadAppendedVertices
+//
+// Description:		Uploads the vertices which changed at the end of each
+//					curve's data (i.e. for appended points).  This is only
+//					possible if the same curves are buffered and each still
+//					fits within the space reserved for it.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, false if the buffer must be re-filled
+//
+//=============================================================================
+bool PlotCurveBatch::UploadAppendedVertices()
+{
+	if (mFirstVertices.size() != mCurves.size())
+		return false;
+
+	unsigned int vertexCount(0), i;
+	for (i = 0; i < mCurves.size(); ++i)
+	{
+		const GLsizei count(mCurves[i]->mBufferInfo[0].vertexCount);
+		const bool buffered(mCurves[i]->IsDrawable() && count > 0);
+		if (buffered != (mFirstVertices[i] >= 0) ||
+			(buffered && count > mCurveCapacities[i]))
+			return false;
+
+		if (buffered)
+			vertexCount += count;
+	}
+
+	mBufferInfo[0].vertexCount = vertexCount;
+	if (vertexCount == 0)
+		return true;
+
+	CurveBufferPool& pool(*mRenderer.GetCurveBufferPool());
+	mRegionFirst = pool.GetFirstVertex(this);
+	assert(mRegionFirst >= 0);
+
+	const unsigned int dimension(mRenderer.GetVertexDimension());
+	for (i = 0; i < mCurves.size(); ++i)
+	{
+		PlotCurve& curve(*mCurves[i]);
+		const BufferInfo& source(curve.mBufferInfo[0]);
+		if (mFirstVertices[i] < 0 ||
+			curve.mBatchedVertexCount >= source.vertexCount)
+			continue;
+
+		const unsigned int first(curve.mBatchedVertexCount);
+		pool.Write(mRegionFirst + mFirstVertices[i] + first,
+			source.vertexCount - first,
+			source.vertexBuffer.data() + dimension * first,
+			curve.mVertexColors.data() + 4 * first);
+		curve.mBatchedVertexCount = source.vertexCount;
+	}
+
+	return true;
+}
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		BuildDrawLists
+//
+// Description:		Assembles the draw parameters for the buffered curves.
+//					Each curve's data includes repeated end points (for
+//					adjacency), which are skipped when drawing OpenGL lines.
+//					The density list is always built, so the normal lists are
+//					available if the density buffer can't be created.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurveBatch::BuildDrawLists()
+{
+	mPrettyLines.Clear();
+	mUglyLines.Clear();
+	mMarkers.Clear();
+	mDensityLines.Clear();
+
+	unsigned int i;
+	for (i = 0; i < mFirstVertices.size(); ++i)
+	{
+		if (mFirstVertices[i] < 0)
+			continue;
+
+		const PlotCurve& curve(*mCurves[i]);
+		const GLint first(mRegionFirst + mFirstVertices[i]);
+		const GLsizei count(curve.mBufferInfo[0].vertexCount);
+		if (curve.mLineSize > 0.0)
+		{
+			if (mDensityMode)
+				mDensityLines.Add(first, count, 1.0f);
+
+			const float width(static_cast<float>(
+				curve.mLineSize * PlotCurve::mLineSizeScale));
+			if (curve.mPretty)
+				mPrettyLines.Add(first, count, width);
+			else
+				mUglyLines.Add(first + 1, count - 2, width);
+		}
+
+		if (curve.NeedsMarkersDrawn())
+			mMarkers.Add(first, count,
+				static_cast<float>(2.0 * fabs(curve.mMarkerSize)));
+	}
+}
+
+//=============================================================================
+// Class:			PlotCurveBatch
+// Function:		DrawGroups
+//
+// Description:		Draws the curves in the specified list.  The size can't
+//					change within a draw call, so curves are drawn in groups
+//					having the same size.
+//
+// Input Arguments:
+//		mode			= const GLenum&
+//		list			= const DrawList&
+//		sizeLocation	= const GLint& location of the size uniform, or
+//						  negative to draw with OpenGL lines of the specified
+//						  width
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurveBatch::DrawGroups(const GLenum& mode, const DrawList& list,
+	const GLint& sizeLocation)
+{
+	unsigned int start(0);
+	while (start < list.counts.size())
+	{
+		unsigned int end(start + 1);
+		while (end < list.counts.size() && list.sizes[end] == list.sizes[start])
+			++end;
+
+		if (sizeLocation < 0)
+			glLineWidth(list.sizes[start]);
+		else
+			glUniform1f(sizeLocation, list.sizes[start]);
+
+		glMultiDrawArrays(mode, &list.firsts[start], &list.counts[start],
+			end - start);
+		RenderWindow::RecordDrawCalls();
+		start = end;
+	}
+}
+
+//=============================================================================
+// Class:			PlotCurveBatch::DrawList
+// Function:		Clear
+//
+// Description:		Removes all entries from the list.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurveBatch::DrawList::Clear()
+{
+	firsts.clear();
+	counts.clear();
+	sizes.clear();
+}
+
+//=============================================================================
+// Class:			PlotCurveBatch::DrawList
+// Function:		Add
+//
+// Description:		Adds an entry to the list.
+//
+// Input Arguments:
+//		first	= const GLint&
+//		count	= const GLsizei&
+//		size	= const float&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void PlotCurveBatch::DrawList::Add(const GLint& first, const GLsizei& count,
+	const float& size)
+{
+	firsts.push_back(first);
+	counts.push_back(count);
+	sizes.push_back(size);
+}
+
+}// namespace LibPlot2D
@@ -18,6 +18,9 @@
 #include "lp2d/renderer/primitives/primitive.h"
 #include "lp2d/renderer/renderWindow.h"
 
+// Standard C++ headers
+#include <chrono>
+
 namespace LibPlot2D
 {
 
@@ -131,23 +134,85 @@ Primitive::~Primitive()
 //=============================================================================
 void Primitive::Draw()
 {
+	mWasDrawn = false;
 	if (!HasValidParameters() || !mIsVisible)
 		return;
 
-	unsigned int i;
+	RenderStatistics* statistics(RenderWindow::GetActiveStatistics());
+	std::chrono::steady_clock::time_point startTime;
+	if (statistics)
+		startTime = std::chrono::steady_clock::now();
+
+	const RenderStatistics::RebuildReason reason(mModified ?
+		RenderStatistics::RebuildReason::Modified :
+		RenderStatistics::RebuildReason::VertexCountChanged);
+	unsigned int i, updateCount(0);
 	for (i = 0; i < mBufferInfo.size(); ++i)
 	{
 		if (mBufferInfo[i].vertexCountModified || mModified)
+		{
 			Update(i);
+			++updateCount;
+		}
 		assert(!RenderWindow::GLHasError());
 	}
 
+	std::chrono::steady_clock::time_point updateEndTime;
+	if (statistics)
+		updateEndTime = std::chrono::steady_clock::now();
+
 	mModified = false;
 	GenerateGeometry();
+	mWasDrawn = true;
+
+	if (statistics)
+		statistics->AddPrimitive(GetTypeName(), updateCount, reason,
+			std::chrono::duration<double>(updateEndTime - startTime).count(),
+			std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - updateEndTime).count());
 
 	assert(!RenderWindow::GLHasError());
 }
 
+//=============================================================================
+// Class:			Primitive
+// Function:		NeedsRedraw
+//
+// Description:		Checks to see if this object has changed since it was last
+//					drawn.  Objects that were not drawn last time and still
+//					would not be drawn (hidden or invalid) do not need to be
+//					re-drawn, even if they were modified.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the appearance of this object may have changed
+//
+//=============================================================================
+bool Primitive::NeedsRedraw()
+{
+	const bool willDraw(mIsVisible && HasValidParameters());
+	if (willDraw != mWasDrawn)
+		return true;
+	else if (!willDraw)
+		return false;
+
+	if (mModified)
+		return true;
+
+	for (const auto& b : mBufferInfo)
+	{
+		if (b.vertexCountModified)
+			return true;
+	}
+
+	return false;
+}
+
 //=============================================================================
 // Class:			Primitive
 // Function:		SetVisibility
@@ -215,6 +280,29 @@ void Primitive::SetDrawOrder(const unsigned int& drawOrder)
 	mRenderWindow.SetNeedOrderSort();
 }
 
+//=============================================================================
+// Class:			Primitive
+// Function:		SetIsOverlay
+//
+// Description:		Sets the flag indicating whether or not this object is
+//					drawn on top of the cached static layer.
+//
+// Input Arguments:
+//		isOverlay	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Primitive::SetIsOverlay(const bool& isOverlay)
+{
+	mIsOverlay = isOverlay;
+	mRenderWindow.InvalidateStaticLayer();
+}
+
 //=============================================================================
 // Class:			Primitive
 // Function:		operator=
@@ -242,6 +330,7 @@ Primitive& Primitive::operator=(const Primitive &primitive)
 	mColor		= primitive.mColor;
 	mModified	= true;
 	mDrawOrder	= primitive.mDrawOrder;
+	mIsOverlay	= primitive.mIsOverlay;
 
 	mRenderWindow.SetNeedAlphaSort();
 	mRenderWindow.SetNeedOrderSort();
@@ -276,6 +365,7 @@ Primitive& Primitive::operator=(Primitive &&primitive)
 	mColor		= std::move(primitive.mColor);
 	mModified	= true;
 	mDrawOrder	= std::move(primitive.mDrawOrder);
+	mIsOverlay	= std::move(primitive.mIsOverlay);
 	mBufferInfo	= std::move(primitive.mBufferInfo);
 
 	mRenderWindow.SetNeedAlphaSort();
@@ -78,7 +78,7 @@ void TextRendering::Update(const unsigned int& /*i*/)
 	else
 		mFont.SetPosition(mX, mY);
 
-	mBufferInfo[0] = mFont.BuildText();
+	mFont.BuildText(mBufferInfo[0]);
 }
 
 //=============================================================================
@@ -101,10 +101,7 @@ void TextRendering::Update(const unsigned int& /*i*/)
 void TextRendering::GenerateGeometry()
 {
 	if (mFont.IsOK() && mBufferInfo[0].vertexCount > 0)
-	{
-		glBindVertexArray(mBufferInfo[0].GetVertexArrayIndex());
 		mFont.RenderBufferedGlyph(mBufferInfo[0].vertexCount);
-	}
 }
 
 //=============================================================================
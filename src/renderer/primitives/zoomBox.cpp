@@ -43,6 +43,8 @@ ZoomBox::ZoomBox(RenderWindow &renderWindow) : Primitive(renderWindow),
 	// Initially, we don't want to draw this
 	mIsVisible = false;
 	mColor = Color::ColorBlack;
+
+	SetIsOverlay(true);
 }
 
 //=============================================================================
@@ -63,13 +65,13 @@ ZoomBox::ZoomBox(RenderWindow &renderWindow) : Primitive(renderWindow),
 //=============================================================================
 void ZoomBox::Update(const unsigned int& /*i*/)
 {
-	std::vector<std::pair<double, double>> points;
-	points.push_back(std::make_pair(mXAnchor, mYAnchor));
-	points.push_back(std::make_pair(mXFloat, mYAnchor));
-	points.push_back(std::make_pair(mXFloat, mYFloat));
-	points.push_back(std::make_pair(mXAnchor, mYFloat));
-	points.push_back(std::make_pair(mXAnchor, mYAnchor));
-	box.Build(points, mBufferInfo[0]);
+	mPoints.clear();
+	mPoints.push_back(std::make_pair(mXAnchor, mYAnchor));
+	mPoints.push_back(std::make_pair(mXFloat, mYAnchor));
+	mPoints.push_back(std::make_pair(mXFloat, mYFloat));
+	mPoints.push_back(std::make_pair(mXAnchor, mYFloat));
+	mPoints.push_back(std::make_pair(mXAnchor, mYAnchor));
+	box.Build(mPoints, mBufferInfo[0]);
 }
 
 //=============================================================================
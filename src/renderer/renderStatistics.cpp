@@ -0,0 +1,223 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  renderStatistics.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Performance counters collected while rendering a frame.
+
+// Local headers
+#include "lp2d/renderer/renderStatistics.h"
+
+// Standard C++ headers
+#include <cassert>
+#include <iomanip>
+#include <sstream>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			RenderStatistics
+// Function:		Reset
+//
+// Description:		Clears all counters (except the frame number).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderStatistics::Reset()
+{
+	frameTime = 0.0;
+	drawTime = 0.0;
+	overBudget = false;
+	drawCalls = 0;
+	uploadedVertices = 0;
+	uploadedBytes = 0;
+	primitiveTypes.clear();
+	rebuilds.clear();
+}
+
+//=============================================================================
+// Class:			RenderStatistics
+// Function:		AddPrimitive
+//
+// Description:		Adds the timing and rebuild information for one primitive.
+//
+// Input Arguments:
+//		type			= const std::string&
+//		bufferCount		= const unsigned int&
+//		reason			= const RebuildReason&
+//		updateTime		= const double& [sec]
+//		generateTime	= const double& [sec]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderStatistics::AddPrimitive(const std::string& type,
+	const unsigned int& bufferCount, const RebuildReason& reason,
+	const double& updateTime, const double& generateTime)
+{
+	PrimitiveTypeStatistics& typeStatistics(primitiveTypes[type]);
+	++typeStatistics.drawCount;
+	typeStatistics.updateTime += updateTime;
+	typeStatistics.generateTime += generateTime;
+
+	if (bufferCount > 0)
+	{
+		++typeStatistics.rebuildCount;
+
+		Rebuild rebuild;
+		rebuild.primitiveType = type;
+		rebuild.reason = reason;
+		rebuild.bufferCount = bufferCount;
+		rebuilds.push_back(rebuild);
+	}
+}
+
+//=============================================================================
+// Class:			RenderStatistics
+// Function:		GetSummary
+//
+// Description:		Creates a short, single-line description of the frame.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//=============================================================================
+std::string RenderStatistics::GetSummary() const
+{
+	std::ostringstream ss;
+	ss << std::fixed << std::setprecision(1) << frameTime * 1000.0 << " ms ("
+		<< drawTime * 1000.0 << " ms draw), " << drawCalls << " draw calls, "
+		<< uploadedBytes / 1024 << " kB uploaded, " << rebuilds.size()
+		<< " rebuilt";
+
+	if (overBudget)
+		ss << " [over budget]";
+
+	return ss.str();
+}
+
+//=============================================================================
+// Class:			RenderStatistics
+// Function:		WriteTraceHeader
+//
+// Description:		Writes the column headings for a CSV trace.
+//
+// Input Arguments:
+//		stream	= std::ostream&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderStatistics::WriteTraceHeader(std::ostream& stream)
+{
+	stream << "Frame,Frame Time [msec],Draw Time [msec],Over Budget,"
+		"Draw Calls,Uploaded Vertices,Uploaded Bytes,Primitive Type,"
+		"Drawn,Rebuilt,Update Time [msec],Generate Time [msec],"
+		"Rebuild Reasons\n";
+}
+
+//=============================================================================
+// Class:			RenderStatistics
+// Function:		WriteTrace
+//
+// Description:		Writes one CSV row for each type of primitive drawn during
+//					the frame.
+//
+// Input Arguments:
+//		stream	= std::ostream&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderStatistics::WriteTrace(std::ostream& stream) const
+{
+	std::ostringstream frameColumns;
+	frameColumns << frameNumber << ',' << frameTime * 1000.0 << ','
+		<< drawTime * 1000.0 << ',' << (overBudget ? 1 : 0) << ','
+		<< drawCalls << ',' << uploadedVertices << ',' << uploadedBytes;
+
+	for (const auto& type : primitiveTypes)
+	{
+		// Reasons are listed once per rebuilt object, separated by spaces
+		std::string reasons;
+		for (const auto& rebuild : rebuilds)
+		{
+			if (rebuild.primitiveType != type.first)
+				continue;
+
+			if (!reasons.empty())
+				reasons.append(" ");
+			reasons.append(GetReasonName(rebuild.reason));
+		}
+
+		stream << frameColumns.str() << ',' << type.first << ','
+			<< type.second.drawCount << ',' << type.second.rebuildCount << ','
+			<< type.second.updateTime * 1000.0 << ','
+			<< type.second.generateTime * 1000.0 << ',' << reasons << '\n';
+	}
+
+	if (primitiveTypes.empty())
+		stream << frameColumns.str() << ",,,,,,\n";
+}
+
+//=============================================================================
+// Class:			RenderStatistics
+// Function:		GetReasonName
+//
+// Description:		Returns a name for the specified rebuild reason.
+//
+// Input Arguments:
+//		reason	= const RebuildReason&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//=============================================================================
+std::string RenderStatistics::GetReasonName(const RebuildReason& reason)
+{
+	if (reason == RebuildReason::Modified)
+		return "modified";
+	else if (reason == RebuildReason::VertexCountChanged)
+		return "vertex-count";
+
+	assert(false);
+	return std::string();
+}
+
+}// namespace LibPlot2D
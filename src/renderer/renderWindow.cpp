@@ -28,12 +28,20 @@
 // wxWidgets headers
 #include <wx/dcclient.h>
 #include <wx/image.h>
+#include <wx/filename.h>
+#include <wx/stdpaths.h>
 
 // Standard C++ headers
 #include <vector>
 #include <algorithm>
 #include <iostream>
 #include <typeinfo>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iterator>
+#include <cstring>
+#include <thread>
 
 wxDEFINE_EVENT(RENDERED_EVENT, wxCommandEvent);
 
@@ -63,6 +71,39 @@ const std::string RenderWindow::mColorName("color");
 
 const double RenderWindow::mExactPixelShift(0.375);
 std::mutex RenderWindow::renderMutex;
+std::vector<const wxGLContext*> RenderWindow::mContextList;
+wxString RenderWindow::mProgramCacheDirectory;
+const RenderWindow* RenderWindow::mLastDrawnWindow(nullptr);
+RenderStatistics* RenderWindow::mActiveStatistics(nullptr);
+const unsigned int RenderWindow::mMaximumPendingCaptures(4);
+const int RenderWindow::mMaximumTileSize(4096);
+const int RenderWindow::mOffscreenSamples(4);
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		PendingCapture
+//
+// Description:		Structure describing a readback into a pixel buffer object
+//					that has not yet completed.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+struct RenderWindow::PendingCapture
+{
+	GLuint buffer = 0;
+	GLsync fence = nullptr;
+	int width = 0;
+	int height = 0;
+	CaptureCallback callback;
+};
 
 //=============================================================================
 // Class:			RenderWindow
@@ -127,6 +168,67 @@ const std::string RenderWindow::mDefaultFragmentShader(
 	"}\n"
 );
 
+//=============================================================================
+// Class:			RenderWindow
+// Function:		mStaticLayerVertexShader
+//
+// Description:		Vertex shader for compositing the cached static layer.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string RenderWindow::mStaticLayerVertexShader(
+	"#version 400\n"
+	"\n"
+	"layout(location = 0) in vec2 position;\n"
+	"\n"
+	"out vec2 textureCoordinate;\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"    textureCoordinate = 0.5 * (position + 1.0);\n"
+	"    gl_Position = vec4(position, 0.0, 1.0);\n"
+	"}\n"
+);
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		mStaticLayerFragmentShader
+//
+// Description:		Fragment shader for compositing the cached static layer.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const std::string RenderWindow::mStaticLayerFragmentShader(
+	"#version 400\n"
+	"\n"
+	"uniform sampler2D layerTexture;\n"
+	"\n"
+	"in vec2 textureCoordinate;\n"
+	"\n"
+	"out vec4 outputColor;\n"
+	"\n"
+	"void main()\n"
+	"{\n"
+	"    outputColor = texture(layerTexture, textureCoordinate);\n"
+	"}\n"
+);
+
 //=============================================================================
 // Class:			RenderWindow
 // Function:		RenderWindow
@@ -152,7 +254,8 @@ const std::string RenderWindow::mDefaultFragmentShader(
 RenderWindow::RenderWindow(wxWindow &parent, wxWindowID id,
 	const wxGLAttributes& attr, const wxPoint& position, const wxSize& size,
 	long style) : wxGLCanvas(&parent, attr, id, position, size,
-		style | wxFULL_REPAINT_ON_RESIZE)
+		style | wxFULL_REPAINT_ON_RESIZE),
+	mContextResources(std::make_shared<ContextResources>())
 {
 	AutoSetFrustum();
 
@@ -181,7 +284,16 @@ RenderWindow::RenderWindow(wxWindow &parent, wxWindowID id,
 //=============================================================================
 RenderWindow::~RenderWindow()
 {
+	FinishImageWrites();
 	FreeOpenGLObjects();
+
+	// Shared contexts are only removed from the list by their last user
+	if (mContext && mContext.use_count() == 1)
+		mContextList.erase(std::find(mContextList.begin(),
+			mContextList.end(), mContext.get()));
+
+	if (mLastDrawnWindow == this)
+		mLastDrawnWindow = nullptr;
 }
 
 //=============================================================================
@@ -202,14 +314,28 @@ RenderWindow::~RenderWindow()
 //=============================================================================
 void RenderWindow::FreeOpenGLObjects()
 {
-	for (auto& s : mShaders)
-		glDeleteProgram(s.programId);
-	mShaders.clear();
-
 	// Need to ensure the proper context is active when OpenGL objects are freed
 	std::lock_guard<std::mutex> lock(renderMutex);
 	MakeCurrent();
+	FreeStaticLayer();
 	mPrimitiveList.Clear();
+
+	// Objects belonging to a shared context are freed by its last user
+	if (mContextResources.use_count() == 1)
+	{
+		for (auto& s : mContextResources->shaders)
+			glDeleteProgram(s.programId);
+		mContextResources->shaders.clear();
+		mContextResources->typeInitializedMap.clear();
+		mContextResources->typeProgramMap.clear();
+		mContextResources->curveBufferPool.reset();
+	}
+
+	if (mTimerQueries[0] != 0)
+	{
+		glDeleteQueries(mTimerQueryCount, mTimerQueries);
+		std::fill(mTimerQueries, mTimerQueries + mTimerQueryCount, 0);
+	}
 }
 
 //=============================================================================
@@ -233,6 +359,7 @@ BEGIN_EVENT_TABLE(RenderWindow, wxGLCanvas)
 	EVT_SIZE(				RenderWindow::OnSize)
 	EVT_PAINT(				RenderWindow::OnPaint)
 	EVT_ENTER_WINDOW(		RenderWindow::OnEnterWindow)
+	EVT_IDLE(				RenderWindow::OnIdle)
 
 	// Interaction events
 	EVT_MOUSEWHEEL(			RenderWindow::OnMouseWheelEvent)
@@ -249,6 +376,8 @@ END_EVENT_TABLE()
 // Function:		GetContext
 //
 // Description:		Gets (or creates, if it doesn't yet exist) the GL context.
+//					New contexts share objects with existing contexts, so
+//					resources like font textures are only created once.
 //
 // Input Arguments:
 //		None
@@ -266,8 +395,10 @@ wxGLContext* RenderWindow::GetContext()
 	{
 		wxGLContextAttrs attributes;
 		attributes.PlatformDefaults().OGLVersion(4, 0).EndList();
-		mContext = std::make_unique<wxGLContext>(this, nullptr, &attributes);
+		const wxGLContext* shareContext(mContextList.empty() ? nullptr : mContextList.front());
+		mContext = std::make_shared<wxGLContext>(this, shareContext, &attributes);
 		assert(mContext->IsOK() && "Minimum OpenGL verison not met (requires 4.0)");
+		mContextList.push_back(mContext.get());
 	}
 
 	return mContext.get();
@@ -317,7 +448,13 @@ void RenderWindow::Render()
 	if (!GetContext() || !IsShownOnScreen())
 		return;
 
-	const unsigned int shaderCount(mShaders.size());
+	const unsigned int shaderCount(mContextResources->shaders.size());
+
+	// Must be checked before the flags are reset in the viewport loop below
+	const bool cacheStaticLayer(mCacheStaticLayer && !mView3D && viewportCount == 1);
+	const bool staticLayerDirty(!mStaticLayerValid || mModified ||
+		mModelviewModified || mSizeUpdateRequired || mNeedAlphaSort ||
+		mNeedOrderSort);
 
 	{
 		std::lock_guard<std::mutex> lock(renderMutex);
@@ -327,99 +464,50 @@ void RenderWindow::Render()
 
 		assert(!GLHasError());
 
-		if (!mGlewInitialized)
-		{
-			glewExperimental = GL_TRUE;
-			if (glewInit() != GLEW_OK)
-				return;
-
-			// According to https://www.khronos.org/opengl/wiki/OpenGL_Loading_Library, glewInit() may cause
-			// OpenGL error GL_INVALID_ENUM (which we observe) even if everything is actually OK.
-			// So check for errors to clear the error flag.
-#ifdef _DEBUG
-			int e =
-#endif// _DEBUG
-				glGetError();
+		if (!InitializeOpenGL())
+			return;
 
-#ifdef _DEBUG
-			assert(e == GL_NO_ERROR || e == GL_INVALID_ENUM);
-			GetGLInfo();
-#endif// _DEBUG
-			BuildShaders();
-			mGlewInitialized = true;
+		// The viewport, scissor box, etc. are context state, so they must be
+		// restored if another window has used the context since our last draw
+		if (mContextShared && mLastDrawnWindow != this)
+		{
+			mSizeUpdateRequired = true;
+			ApplyScissorBox();
 		}
+		mLastDrawnWindow = this;
 
-		for (unsigned int viewport = 0; viewport < viewportCount; ++viewport)
+		const std::chrono::steady_clock::time_point drawStartTime(
+			std::chrono::steady_clock::now());
+		if (mCollectStatistics)
 		{
-			if (mSizeUpdateRequired || viewport != lastViewportConfigured)
-				DoResize(viewport);
-
-			if (mModified || viewport != lastViewportConfigured)
-				Initialize(viewport);
-			else if (mModelviewModified)
-				UpdateModelviewMatrix();
-
-			if (viewport == 0)
-			{
-				glClearColor(static_cast<float>(mBackgroundColor.GetRed()),
-					static_cast<float>(mBackgroundColor.GetGreen()),
-					static_cast<float>(mBackgroundColor.GetBlue()),
-					static_cast<float>(mBackgroundColor.GetAlpha()));
-
-				if (mView3D)
-					glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-				else
-					glClear(GL_COLOR_BUFFER_BIT);
-			}
-
-			// Sort the primitives by Color.GetAlpha to ensure that transparent objects are rendered last
-			Primitive* firstTransparentPrimitive(nullptr);
-			if (mNeedAlphaSort)
-			{
-				std::sort(mPrimitiveList.begin(), mPrimitiveList.end(), AlphaSortPredicate);
-				mNeedAlphaSort = false;
-
-				if (mView3D)
-				{
-					for (const auto& p : mPrimitiveList)
-					{
-						if (p->GetColor().GetAlpha() < 1.0)
-						{
-							firstTransparentPrimitive = p.get();
-							break;
-						}
-					}
-				}
-			}
-
-			// Generally, all objects will have the same draw order and this won't do anything,
-			// but for some cases we do want to override the draw order just before rendering
-			if (mNeedOrderSort)
-			{
-				std::stable_sort(mPrimitiveList.begin(), mPrimitiveList.end(), OrderSortPredicate);
-				mNeedOrderSort = false;
-			}
+			mStatistics.Reset();
+			++mStatistics.frameNumber;
+			mActiveStatistics = &mStatistics;
+		}
 
-			// NOTE:  Any primitive that uses it's own program should re-load the default program
-			// by calling RenderWindow::UseDefaultProgram() at the end of GenerateGeometry()
-			for (auto& p : mPrimitiveList)
-			{
-				if (firstTransparentPrimitive && p.get() == firstTransparentPrimitive)
-					glDepthMask(GL_FALSE);
-				p->Draw();
-			}
+		if (mTimerQueries[0] == 0)
+			glGenQueries(mTimerQueryCount, mTimerQueries);
+		ReadTimerQueries();
 
-			if (firstTransparentPrimitive)
-				glDepthMask(GL_TRUE);
+		glBeginQuery(GL_TIME_ELAPSED, mTimerQueries[mNextTimerQuery]);
+		DrawScene(cacheStaticLayer, staticLayerDirty);
+		glEndQuery(GL_TIME_ELAPSED);
+		mTimerQueryPending[mNextTimerQuery] = true;
+		mNextTimerQuery = (mNextTimerQuery + 1) % mTimerQueryCount;
 
-			lastViewportConfigured = viewport;
-		}
+		// Most of the cost of drawing curves is on the GPU, so CPU time alone
+		// would never exceed the budget
+		mLastFrameTime = std::max(mLastGPUFrameTime,
+			std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - mFrameStartTime).count());
+		if (mCollectStatistics)
+			FinishStatistics(drawStartTime);
 
 		SwapBuffers();// TODO:  Memory leak here?
 	}
 
 	// If shaders are added mid-render, we need to re-render to ensure everything gets displayed
-	if (mShaders.size() != shaderCount)
+	if (mContextResources->shaders.size() != shaderCount)
 		Render();
 
 	if (mRenderedEvent)
@@ -434,9 +522,12 @@ void RenderWindow::Render()
 
 //=============================================================================
 // Class:			RenderWindow
-// Function:		GetGLInfo
+// Function:		ReadTimerQueries
 //
-// Description:		Gets useful GL version info and puts it in a string (for debugging).
+// Description:		Reads the results of completed GPU timer queries (oldest
+//					first) without waiting for queries which are still in
+//					progress.  The most recent result becomes the GPU frame
+//					time.
 //
 // Input Arguments:
 //		None
@@ -448,46 +539,94 @@ void RenderWindow::Render()
 //		None
 //
 //=============================================================================
-void RenderWindow::GetGLInfo()
+void RenderWindow::ReadTimerQueries()
 {
-	std::string info;
-	info.append("Vendor:          " + std::string(reinterpret_cast<const char*>(glGetString(GL_VENDOR))) + '\n');
-	info.append("Renderer:        " + std::string(reinterpret_cast<const char*>(glGetString(GL_RENDERER))) + '\n');
-	info.append("OpenGL version:  " + std::string(reinterpret_cast<const char*>(glGetString(GL_VERSION))) + '\n');
-	info.append("GLSL version:    " + std::string(reinterpret_cast<const char*>(glGetString(GL_SHADING_LANGUAGE_VERSION))) + '\n');
-	std::cerr << info;
+	unsigned int i;
+	for (i = 0; i < mTimerQueryCount; ++i)
+	{
+		const unsigned int query((mNextTimerQuery + i) % mTimerQueryCount);
+		if (!mTimerQueryPending[query])
+			continue;
+
+		GLint available;
+		glGetQueryObjectiv(mTimerQueries[query], GL_QUERY_RESULT_AVAILABLE,
+			&available);
+		if (available == GL_FALSE)
+			break;// Later queries can't be complete either
+
+		GLuint64 elapsed;// [nsec]
+		glGetQueryObjectui64v(mTimerQueries[query], GL_QUERY_RESULT, &elapsed);
+		mLastGPUFrameTime = elapsed * 1.0e-9;
+		mTimerQueryPending[query] = false;
+	}
 }
 
 //=============================================================================
 // Class:			RenderWindow
-// Function:		OnPaint
+// Function:		InitializeOpenGL
 //
-// Description:		Event handler for the paint event.  Obtains the device
-//					context and re-renders the scene.
+// Description:		Initializes GLEW and builds the default shaders, if this
+//					has not already been done.  Must be called with the render
+//					mutex locked and this object's context current.
 //
 // Input Arguments:
-//		event	= wxPaintEvent& (UNUSED)
+//		None
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		None
+//		bool, true if OpenGL is ready for use
 //
 //=============================================================================
-void RenderWindow::OnPaint(wxPaintEvent& WXUNUSED(event))
+bool RenderWindow::InitializeOpenGL()
 {
-    Render();
+	if (mGlewInitialized)
+		return true;
+
+	glewExperimental = GL_TRUE;
+	if (glewInit() != GLEW_OK)
+		return false;
+
+	// According to https://www.khronos.org/opengl/wiki/OpenGL_Loading_Library, glewInit() may cause
+	// OpenGL error GL_INVALID_ENUM (which we observe) even if everything is actually OK.
+	// So check for errors to clear the error flag.
+#ifdef _DEBUG
+	int e =
+#endif// _DEBUG
+		glGetError();
+
+#ifdef _DEBUG
+	assert(e == GL_NO_ERROR || e == GL_INVALID_ENUM);
+	GetGLInfo();
+#endif// _DEBUG
+
+	// Windows sharing a context also share its programs
+	if (mContextResources->shaders.empty())
+	{
+		BuildShaders();
+		mContextResources->curveBufferPool = std::make_unique<CurveBufferPool>(
+			GetDefaultPositionLocation(), GetDefaultColorLocation(),
+			GetVertexDimension());
+	}
+	mGlewInitialized = true;
+
+	return true;
 }
 
 //=============================================================================
 // Class:			RenderWindow
-// Function:		OnSize
+// Function:		DrawScene
 //
-// Description:		Event handler for the window re-size event.
+// Description:		Draws all primitives into the currently bound framebuffer.
+//					Must be called with the render mutex locked and this
+//					object's context current.
 //
 // Input Arguments:
-//		event	= wxSizeEvent& (unused)
+//		cacheStaticLayer	= const bool&, indicating whether or not the
+//							  static layer cache should be used
+//		staticLayerDirty	= const bool&, indicating whether or not the
+//							  static layer must be re-drawn
 //
 // Output Arguments:
 //		None
@@ -496,20 +635,92 @@ void RenderWindow::OnPaint(wxPaintEvent& WXUNUSED(event))
 //		None
 //
 //=============================================================================
-void RenderWindow::OnSize(wxSizeEvent& WXUNUSED(event))
+void RenderWindow::DrawScene(const bool& cacheStaticLayer,
+	const bool& staticLayerDirty)
 {
-    mSizeUpdateRequired = true;
-	Refresh();
+	for (unsigned int viewport = 0; viewport < viewportCount; ++viewport)
+	{
+		if (mSizeUpdateRequired || viewport != lastViewportConfigured)
+			DoResize(viewport);
+
+		if (mModified || viewport != lastViewportConfigured)
+			Initialize(viewport);
+		else if (mModelviewModified)
+			UpdateModelviewMatrix();
+
+		if (viewport == 0)
+		{
+			glClearColor(static_cast<float>(mBackgroundColor.GetRed()),
+				static_cast<float>(mBackgroundColor.GetGreen()),
+				static_cast<float>(mBackgroundColor.GetBlue()),
+				static_cast<float>(mBackgroundColor.GetAlpha()));
+
+			if (mView3D)
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+			else
+				glClear(GL_COLOR_BUFFER_BIT);
+		}
+
+		// Sort the primitives by Color.GetAlpha to ensure that transparent objects are rendered last
+		Primitive* firstTransparentPrimitive(nullptr);
+		if (mNeedAlphaSort)
+		{
+			std::sort(mPrimitiveList.begin(), mPrimitiveList.end(), AlphaSortPredicate);
+			mNeedAlphaSort = false;
+
+			if (mView3D)
+			{
+				for (const auto& p : mPrimitiveList)
+				{
+					if (p->GetColor().GetAlpha() < 1.0)
+					{
+						firstTransparentPrimitive = p.get();
+						break;
+					}
+				}
+			}
+		}
+
+		// Generally, all objects will have the same draw order and this won't do anything,
+		// but for some cases we do want to override the draw order just before rendering
+		if (mNeedOrderSort)
+		{
+			std::stable_sort(mPrimitiveList.begin(), mPrimitiveList.end(), OrderSortPredicate);
+			mNeedOrderSort = false;
+		}
+
+		// NOTE:  Any primitive that uses it's own program should re-load the default program
+		// by calling RenderWindow::UseDefaultProgram() at the end of GenerateGeometry()
+		if (cacheStaticLayer)
+			DrawWithStaticLayer(staticLayerDirty);
+		else
+		{
+			for (auto& p : mPrimitiveList)
+			{
+				if (firstTransparentPrimitive && p.get() == firstTransparentPrimitive)
+					glDepthMask(GL_FALSE);
+				p->Draw();
+			}
+		}
+
+		if (firstTransparentPrimitive)
+			glDepthMask(GL_TRUE);
+
+		lastViewportConfigured = viewport;
+	}
 }
 
 //=============================================================================
 // Class:			RenderWindow
-// Function:		DoResize
+// Function:		DrawWithStaticLayer
 //
-// Description:		Handles actions required to update the screen after resizing.
+// Description:		Draws the scene using the cached static layer.  The static
+//					layer is only re-rendered if it is out of date (or if any
+//					non-overlay primitive has changed).  Overlay primitives are
+//					always drawn on top of the cached image.
 //
 // Input Arguments:
-//		viewportId	= const unsigned int&
+//		updateStaticLayer	= bool, true to force the static layer to update
 //
 // Output Arguments:
 //		None
@@ -518,80 +729,431 @@ void RenderWindow::OnSize(wxSizeEvent& WXUNUSED(event))
 //		None
 //
 //=============================================================================
-void RenderWindow::DoResize(const unsigned int& /*viewportId*/)
+void RenderWindow::DrawWithStaticLayer(bool updateStaticLayer)
 {
-	assert(viewportCount == 1);
+	if (!updateStaticLayer)
+	{
+		for (auto& p : mPrimitiveList)
+		{
+			if (!p->GetIsOverlay() && p->NeedsRedraw())
+			{
+				updateStaticLayer = true;
+				break;
+			}
+		}
+	}
 
-	// set GL viewport (not called by wxGLCanvas::OnSize on all platforms...)
-	int w, h;
-	GetClientSize(&w, &h);
-	glViewport(0, 0, w, h);
+	if (updateStaticLayer)
+	{
+		if (!PrepareStaticLayer())
+		{
+			// Fall back to drawing everything directly
+			mStaticLayerValid = false;
+			for (auto& p : mPrimitiveList)
+				p->Draw();
+			return;
+		}
 
-	AutoSetFrustum();// This takes care of any change in aspect ratio
+		GLint defaultFramebuffer;
+		glGetIntegerv(GL_FRAMEBUFFER_BINDING, &defaultFramebuffer);
+		glBindFramebuffer(GL_FRAMEBUFFER, mStaticLayerFramebuffer);
 
-	mSizeUpdateRequired = false;
-	mModelviewModified = true;
-	mModified = true;
+		glClear(GL_COLOR_BUFFER_BIT);// Clear color was set in Render()
+		for (auto& p : mPrimitiveList)
+		{
+			if (!p->GetIsOverlay())
+				p->Draw();
+		}
+
+		glBindFramebuffer(GL_FRAMEBUFFER, defaultFramebuffer);
+		mStaticLayerValid = true;
+	}
+
+	CompositeStaticLayer();
+
+	for (auto& p : mPrimitiveList)
+	{
+		if (p->GetIsOverlay())
+			p->Draw();
+	}
+
+	assert(!GLHasError());
 }
 
 //=============================================================================
 // Class:			RenderWindow
-// Function:		OnEnterWindow
+// Function:		PrepareStaticLayer
 //
-// Description:		Event handler for the enter window event.
+// Description:		Creates (or re-sizes) the offscreen framebuffer used to
+//					cache the static layer.
 //
 // Input Arguments:
-//		event	= wxEraseEvent&
+//		None
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		None
+//		bool, true if the framebuffer is ready for rendering
 //
 //=============================================================================
-void RenderWindow::OnEnterWindow(wxMouseEvent &event)
+bool RenderWindow::PrepareStaticLayer()
 {
-	mObservedLeftButtonDown = false;
-	mObservedRightButtonDown = false;
-	//SetFocus();
-	event.Skip();
+	int width, height;
+	GetClientSize(&width, &height);
+	if (width <= 0 || height <= 0)
+		return false;
+
+	if (mStaticLayerProgram == 0)
+	{
+		std::vector<ShaderSource> sources;
+		sources.push_back({ GL_VERTEX_SHADER, mStaticLayerVertexShader });
+		sources.push_back({ GL_FRAGMENT_SHADER, mStaticLayerFragmentShader });
+		mStaticLayerProgram = CreateCachedProgram(sources);
+
+		glUseProgram(mStaticLayerProgram);
+		glUniform1i(glGetUniformLocation(mStaticLayerProgram, "layerTexture"), 0);
+		UseProgram(mActiveProgram);
+
+		// Quad covering the entire viewport (in normalized device coordinates)
+		const GLfloat quad[] = { -1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f };
+
+		glGenVertexArrays(1, &mStaticLayerVertexArray);
+		glGenBuffers(1, &mStaticLayerVertexBuffer);
+		glBindVertexArray(mStaticLayerVertexArray);
+		glBindBuffer(GL_ARRAY_BUFFER, mStaticLayerVertexBuffer);
+		glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+		glEnableVertexAttribArray(0);
+		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+		glBindVertexArray(0);
+	}
+
+	if (mStaticLayerFramebuffer != 0 &&
+		width == mStaticLayerWidth && height == mStaticLayerHeight)
+		return true;
+
+	if (mStaticLayerFramebuffer == 0)
+	{
+		glGenFramebuffers(1, &mStaticLayerFramebuffer);
+		glGenTextures(1, &mStaticLayerTexture);
+	}
+
+	glBindTexture(GL_TEXTURE_2D, mStaticLayerTexture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA,
+		GL_UNSIGNED_BYTE, nullptr);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	GLint defaultFramebuffer;
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &defaultFramebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, mStaticLayerFramebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+		GL_TEXTURE_2D, mStaticLayerTexture, 0);
+	const GLenum status(glCheckFramebufferStatus(GL_FRAMEBUFFER));
+	glBindFramebuffer(GL_FRAMEBUFFER, defaultFramebuffer);
+
+	assert(!GLHasError());
+
+	if (status != GL_FRAMEBUFFER_COMPLETE)
+	{
+		FreeStaticLayer();
+		mCacheStaticLayer = false;// Not supported - don't try again
+		return false;
+	}
+
+	mStaticLayerWidth = width;
+	mStaticLayerHeight = height;
+
+	return true;
 }
 
 //=============================================================================
 // Class:			RenderWindow
-// Function:		RemoveActor
+// Function:		CompositeStaticLayer
 //
-// Description:		Removes the specified actor from the display list, if it
-//					is in the list.
+// Description:		Copies the cached static layer into the current
+//					framebuffer.  The blending state is restored afterwards.
 //
 // Input Arguments:
-//		toRemove	= Primitive* pointing to the object to be removed
+//		None
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		bool, true for success, false otherwise
+//		None
 //
 //=============================================================================
-bool RenderWindow::RemoveActor(Primitive *toRemove)
+void RenderWindow::CompositeStaticLayer()
 {
-	if (!toRemove)
-		return false;
+	// The layer already contains the blended result, but overlays drawn
+	// afterwards still require blending
+	const GLboolean blendEnabled(glIsEnabled(GL_BLEND));
+	glUseProgram(mStaticLayerProgram);
+	glDisable(GL_BLEND);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, mStaticLayerTexture);
 
-	unsigned int i;
-	for (i = 0; i < mPrimitiveList.GetCount(); ++i)
-	{
-		if (toRemove == mPrimitiveList[i].get())
-		{
-			mPrimitiveList.Remove(i);
-			return true;
-		}
-	}
+	glBindVertexArray(mStaticLayerVertexArray);
+	glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	RecordDrawCalls();
+	glBindVertexArray(0);
 
-	return false;
-}
+	glBindTexture(GL_TEXTURE_2D, 0);
+	UseDefaultProgram();
+
+	if (blendEnabled == GL_TRUE)
+		glEnable(GL_BLEND);
+
+	assert(!GLHasError());
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		FreeStaticLayer
+//
+// Description:		Frees the OpenGL objects associated with the static layer.
+//					The appropriate context must be current when this is
+//					called.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::FreeStaticLayer()
+{
+	if (mStaticLayerFramebuffer != 0)
+	{
+		glDeleteFramebuffers(1, &mStaticLayerFramebuffer);
+		glDeleteTextures(1, &mStaticLayerTexture);
+		mStaticLayerFramebuffer = 0;
+		mStaticLayerTexture = 0;
+	}
+
+	if (mStaticLayerProgram != 0)
+	{
+		glDeleteProgram(mStaticLayerProgram);
+		glDeleteBuffers(1, &mStaticLayerVertexBuffer);
+		glDeleteVertexArrays(1, &mStaticLayerVertexArray);
+		mStaticLayerProgram = 0;
+		mStaticLayerVertexBuffer = 0;
+		mStaticLayerVertexArray = 0;
+	}
+
+	mStaticLayerWidth = 0;
+	mStaticLayerHeight = 0;
+	mStaticLayerValid = false;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		GetGLInfo
+//
+// Description:		Gets useful GL version info and puts it in a string (for debugging).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::GetGLInfo()
+{
+	std::string info;
+	info.append("Vendor:          " + std::string(reinterpret_cast<const char*>(glGetString(GL_VENDOR))) + '\n');
+	info.append("Renderer:        " + std::string(reinterpret_cast<const char*>(glGetString(GL_RENDERER))) + '\n');
+	info.append("OpenGL version:  " + std::string(reinterpret_cast<const char*>(glGetString(GL_VERSION))) + '\n');
+	info.append("GLSL version:    " + std::string(reinterpret_cast<const char*>(glGetString(GL_SHADING_LANGUAGE_VERSION))) + '\n');
+	std::cerr << info;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		OnPaint
+//
+// Description:		Event handler for the paint event.  Applies any deferred
+//					updates, obtains the device context and re-renders the
+//					scene.
+//
+// Input Arguments:
+//		event	= wxPaintEvent& (UNUSED)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::OnPaint(wxPaintEvent& WXUNUSED(event))
+{
+	mFrameStartTime = std::chrono::steady_clock::now();
+	ProcessPendingUpdates();
+    Render();
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		OnSize
+//
+// Description:		Event handler for the window re-size event.
+//
+// Input Arguments:
+//		event	= wxSizeEvent& (unused)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::OnSize(wxSizeEvent& WXUNUSED(event))
+{
+    mSizeUpdateRequired = true;
+	Refresh();
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		DoResize
+//
+// Description:		Handles actions required to update the screen after resizing.
+//
+// Input Arguments:
+//		viewportId	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::DoResize(const unsigned int& /*viewportId*/)
+{
+	assert(viewportCount == 1);
+
+	// set GL viewport (not called by wxGLCanvas::OnSize on all platforms...)
+	int w, h;
+	GetClientSize(&w, &h);
+	if (mRenderingOffscreen)
+	{
+		w = mOffscreenSize.GetWidth();
+		h = mOffscreenSize.GetHeight();
+	}
+
+	// When rendering tiles, the viewport covers the entire image and is
+	// shifted so the current tile lies over the framebuffer
+	glViewport(-mTileOffset[0], -mTileOffset[1], w, h);
+
+	AutoSetFrustum();// This takes care of any change in aspect ratio
+
+	mSizeUpdateRequired = false;
+	mModelviewModified = true;
+	mModified = true;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		OnIdle
+//
+// Description:		Event handler for idle events.  Completes any captures
+//					whose data is available.
+//
+// Input Arguments:
+//		event	= wxIdleEvent&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::OnIdle(wxIdleEvent& event)
+{
+	ProcessCaptures(false);
+	CollectImageWriters(false);
+
+	// Keep polling until the GPU is finished with the pending readbacks
+	if (!mPendingCaptures.empty())
+		event.RequestMore();
+
+	event.Skip();
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		OnEnterWindow
+//
+// Description:		Event handler for the enter window event.
+//
+// Input Arguments:
+//		event	= wxEraseEvent&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::OnEnterWindow(wxMouseEvent &event)
+{
+	mObservedLeftButtonDown = false;
+	mObservedRightButtonDown = false;
+	//SetFocus();
+	event.Skip();
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		RemoveActor
+//
+// Description:		Removes the specified actor from the display list, if it
+//					is in the list.
+//
+// Input Arguments:
+//		toRemove	= Primitive* pointing to the object to be removed
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//=============================================================================
+bool RenderWindow::RemoveActor(Primitive *toRemove)
+{
+	if (!toRemove)
+		return false;
+
+	unsigned int i;
+	for (i = 0; i < mPrimitiveList.GetCount(); ++i)
+	{
+		if (toRemove == mPrimitiveList[i].get())
+		{
+			mPrimitiveList.Remove(i);
+			return true;
+		}
+	}
+
+	return false;
+}
 
 //=============================================================================
 // Class:			RenderWindow
@@ -634,19 +1196,20 @@ void RenderWindow::Initialize(const unsigned int& viewportId)
 	float glProjectionMatrix[16];
 	ConvertMatrixToGL(projectionMatrix, glProjectionMatrix);
 	assert(!GLHasError());
+	std::vector<ShaderInfo>& shaders(mContextResources->shaders);
 	GLuint i;
-	for (i = mShaders.size(); i > 0; --i)
+	for (i = shaders.size(); i > 0; --i)
 	{
-		if (mShaders[i - 1].needsModelview || mShaders[i - 1].needsProjection)
+		if (shaders[i - 1].needsModelview || shaders[i - 1].needsProjection)
 			UseProgram(i - 1);
 		assert(!GLHasError());
 
-		if (mShaders[i - 1].needsModelview)
-			DoModelviewUpdate(mShaders[i - 1].uniformLocations[mModelviewName], glModelViewMatrix);
+		if (shaders[i - 1].needsModelview)
+			DoModelviewUpdate(shaders[i - 1].uniformLocations[mModelviewName], glModelViewMatrix);
 		assert(!GLHasError());
 
-		if (mShaders[i - 1].needsProjection)
-			glUniformMatrix4fv(mShaders[i - 1].uniformLocations[mProjectionName], 1, GL_FALSE, glProjectionMatrix);
+		if (shaders[i - 1].needsProjection)
+			glUniformMatrix4fv(shaders[i - 1].uniformLocations[mProjectionName], 1, GL_FALSE, glProjectionMatrix);
 		assert(!GLHasError());
 	}
 
@@ -1089,13 +1652,14 @@ void RenderWindow::UpdateModelviewMatrix()
 	float glModelViewMatrix[16];
 	ConvertMatrixToGL(mModelviewMatrix, glModelViewMatrix);
 
+	std::vector<ShaderInfo>& shaders(mContextResources->shaders);
 	unsigned int i;
-	for (i = mShaders.size(); i > 0; --i)
+	for (i = shaders.size(); i > 0; --i)
 	{
-		if (mShaders[i - 1].needsModelview)
+		if (shaders[i - 1].needsModelview)
 		{
 			UseProgram(i - 1);
-			DoModelviewUpdate(mShaders[i - 1].uniformLocations[mModelviewName], glModelViewMatrix);
+			DoModelviewUpdate(shaders[i - 1].uniformLocations[mModelviewName], glModelViewMatrix);
 		}
 	}
 
@@ -1219,7 +1783,7 @@ void RenderWindow::AutoSetFrustum()
 	if (!mView3D)
 		return;
 
-	const wxSize windowSize(GetSize());
+	const wxSize windowSize(GetRenderSize());
 	mAspectRatio = static_cast<double>(windowSize.GetWidth())
 		/ static_cast<double>(windowSize.GetHeight());
 }
@@ -1298,48 +1862,643 @@ wxString RenderWindow::GetGLError(const GLint& e)
 //		None
 //
 // Return Value:
-//		bool, indicating success (true) or failure (false)
+//		bool, indicating success (true) or failure (false)
+//
+//=============================================================================
+bool RenderWindow::WriteImageToFile(wxString pathAndFileName) const
+{
+	wxImage newImage(GetImage());
+	wxInitAllImageHandlers();
+	return newImage.SaveFile(pathAndFileName);
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		GetImage
+//
+// Description:		Returns an image object representing the contents of the
+//					window.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		wxImage
+//
+//=============================================================================
+wxImage RenderWindow::GetImage() const
+{
+	unsigned int height = GetSize().GetHeight();
+	unsigned int width = GetSize().GetWidth();
+
+	GLubyte *imageBuffer = (GLubyte*)malloc(width * height * sizeof(GLubyte) * 3);
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, imageBuffer);
+
+	wxImage newImage(width, height, imageBuffer, true);
+	newImage = newImage.Mirror(false);
+
+	free(imageBuffer);
+
+	return newImage;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		RequestCapture
+//
+// Description:		Starts copying the contents of the window into a pixel
+//					buffer object.  The copy completes asynchronously; the
+//					callback is invoked from ProcessCaptures() once the GPU
+//					has finished with it.
+//
+// Input Arguments:
+//		callback	= CaptureCallback
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::RequestCapture(CaptureCallback callback)
+{
+	const int width(GetSize().GetWidth());
+	const int height(GetSize().GetHeight());
+	if (width <= 0 || height <= 0 || !mGlewInitialized)
+	{
+		callback(nullptr, width, height);
+		return;
+	}
+
+	// Bound the number of buffers in flight
+	if (mPendingCaptures.size() >= mMaximumPendingCaptures)
+		ProcessCaptures(true);
+
+	std::unique_ptr<PendingCapture> capture(std::make_unique<PendingCapture>());
+	capture->width = width;
+	capture->height = height;
+	capture->callback = std::move(callback);
+
+	{
+		std::lock_guard<std::mutex> lock(renderMutex);
+		MakeCurrent();
+
+		glGenBuffers(1, &capture->buffer);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, capture->buffer);
+		glBufferData(GL_PIXEL_PACK_BUFFER, width * height * 3, nullptr,
+			GL_STREAM_READ);
+
+		// With a pack buffer bound, glReadPixels() returns immediately
+		glPixelStorei(GL_PACK_ALIGNMENT, 1);
+		glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		capture->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		glFlush();
+	}
+
+	mPendingCaptures.push_back(std::move(capture));
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		ProcessCaptures
+//
+// Description:		Copies the pixels out of completed pixel buffer objects
+//					and invokes the associated callbacks.  Captures complete
+//					in the order they were requested.
+//
+// Input Arguments:
+//		wait	= const bool&, indicating whether or not to wait for all
+//				  pending captures to complete
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::ProcessCaptures(const bool& wait)
+{
+	if (mPendingCaptures.empty())
+		return;
+
+	struct CompletedCapture
+	{
+		unsigned char* pixels;
+		int width;
+		int height;
+		CaptureCallback callback;
+	};
+	std::vector<CompletedCapture> completed;
+
+	{
+		std::lock_guard<std::mutex> lock(renderMutex);
+		MakeCurrent();
+
+		while (!mPendingCaptures.empty())
+		{
+			PendingCapture& capture(*mPendingCaptures.front());
+			GLenum status(glClientWaitSync(capture.fence, 0, 0));
+			if (status == GL_TIMEOUT_EXPIRED)
+			{
+				if (!wait)
+					break;
+
+				const GLuint64 timeout(1000000000);// [nsec]
+				do
+				{
+					status = glClientWaitSync(capture.fence,
+						GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+				} while (status == GL_TIMEOUT_EXPIRED);
+			}
+
+			// OpenGL's rows start at the bottom; the callback expects the top
+			const unsigned int rowSize(capture.width * 3);
+			const unsigned int size(rowSize * capture.height);
+			unsigned char* pixels(nullptr);
+			if (status != GL_WAIT_FAILED)
+			{
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, capture.buffer);
+				const unsigned char* mapped(static_cast<const unsigned char*>(
+					glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT)));
+				if (mapped)
+				{
+					pixels = static_cast<unsigned char*>(malloc(size));
+					if (pixels)
+					{
+						int row;
+						for (row = 0; row < capture.height; ++row)
+							memcpy(pixels + (capture.height - 1 - row) * rowSize,
+								mapped + row * rowSize, rowSize);
+					}
+
+					glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+				}
+
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			}
+
+			glDeleteSync(capture.fence);
+			glDeleteBuffers(1, &capture.buffer);
+
+			completed.push_back({ pixels, capture.width, capture.height,
+				std::move(capture.callback) });
+			mPendingCaptures.pop_front();
+		}
+	}
+
+	// Callbacks may need to render (or request another capture), so they are
+	// called only after the lock is released
+	for (auto& c : completed)
+		c.callback(c.pixels, c.width, c.height);
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		WriteImageToFileAsync
+//
+// Description:		Writes the contents of the render window to file without
+//					blocking.  The pixels are read back asynchronously and the
+//					image is encoded on a worker thread.  Use
+//					FinishImageWrites() to wait for completion.
+//
+// Input Arguments:
+//		pathAndFileName	= const wxString& specifying the location to save the
+//						  image to
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::WriteImageToFileAsync(const wxString& pathAndFileName)
+{
+	// Handlers must be registered from the main thread
+	wxInitAllImageHandlers();
+
+	// Force a deep copy, since the string will be used on another thread
+	const wxString fileName(pathAndFileName.wc_str());
+	RequestCapture([this, fileName](unsigned char* pixels, const int& width,
+		const int& height)
+	{
+		if (!pixels)
+		{
+			mImageWriteFailed = true;
+			return;
+		}
+
+		StartImageWriter(pixels, width, height, fileName);
+	});
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		WriteImageToFileAsync
+//
+// Description:		Writes an image of the specified size to file.  The image
+//					is rendered offscreen (blocking), then encoded on a worker
+//					thread.  The tiles are copied directly into the buffer
+//					that is handed to the encoder, so the peak memory is one
+//					copy of the image plus one tile.
+//
+// Input Arguments:
+//		pathAndFileName	= const wxString& specifying the location to save the
+//						  image to
+//		width			= const int& [pixels]
+//		height			= const int& [pixels]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the image was rendered successfully
+//
+//=============================================================================
+bool RenderWindow::WriteImageToFileAsync(const wxString& pathAndFileName,
+	const int& width, const int& height)
+{
+	if (width <= 0 || height <= 0)
+		return false;
+
+	wxInitAllImageHandlers();
+
+	const size_t rowSize(static_cast<size_t>(width) * 3);
+	unsigned char* pixels(static_cast<unsigned char*>(malloc(rowSize * height)));
+	if (!pixels)
+		return false;
+
+	// Tile rows start at the bottom; the image rows start at the top
+	if (!RenderOffscreen(width, height, [pixels, rowSize, height](
+		const unsigned char* tile, const int& x, const int& y,
+		const int& tileWidth, const int& tileHeight)
+	{
+		int row;
+		for (row = 0; row < tileHeight; ++row)
+			memcpy(pixels + (height - 1 - y - row) * rowSize + x * 3,
+				tile + row * tileWidth * 3, tileWidth * 3);
+	}))
+	{
+		free(pixels);
+		return false;
+	}
+
+	StartImageWriter(pixels, width, height, wxString(pathAndFileName.wc_str()));
+	return true;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		StartImageWriter
+//
+// Description:		Starts encoding the specified pixels to file on a worker
+//					thread.
+//
+// Input Arguments:
+//		pixels			= unsigned char*, RGB pixels starting with the top row;
+//						  ownership is transferred to the writer
+//		width			= const int& [pixels]
+//		height			= const int& [pixels]
+//		pathAndFileName	= const wxString& specifying the location to save the
+//						  image to (must not share data with other strings)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::StartImageWriter(unsigned char* pixels, const int& width,
+	const int& height, const wxString& pathAndFileName)
+{
+	// Limit the number of simultaneous encoders
+	CollectImageWriters(false);
+	if (mImageWriters.size() >= std::max(1U, std::thread::hardware_concurrency()))
+	{
+		mImageWriters.front().wait();
+		CollectImageWriters(false);
+	}
+
+	mImageWriters.push_back(std::async(std::launch::async,
+		[pixels, width, height, pathAndFileName]()
+	{
+		wxImage image(width, height, pixels);// Takes ownership of pixels
+		return image.SaveFile(pathAndFileName);
+	}));
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		CollectImageWriters
+//
+// Description:		Removes completed image writers from the list, recording
+//					any failures.
+//
+// Input Arguments:
+//		wait	= const bool&, indicating whether or not to wait for all
+//				  writers to complete
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::CollectImageWriters(const bool& wait)
+{
+	auto it(mImageWriters.begin());
+	while (it != mImageWriters.end())
+	{
+		if (!wait && it->wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		{
+			++it;
+			continue;
+		}
+
+		if (!it->get())
+			mImageWriteFailed = true;
+		it = mImageWriters.erase(it);
+	}
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		FinishImageWrites
+//
+// Description:		Waits for all pending captures and image writes to
+//					complete.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if all image writes since the last call succeeded
+//
+//=============================================================================
+bool RenderWindow::FinishImageWrites()
+{
+	ProcessCaptures(true);
+	CollectImageWriters(true);
+
+	const bool success(!mImageWriteFailed);
+	mImageWriteFailed = false;
+	return success;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		RenderOffscreen
+//
+// Description:		Renders the scene at the specified size into an offscreen
+//					framebuffer, one tile at a time.  For each tile, the
+//					viewport spans the entire image, offset so that the tile
+//					is drawn into the framebuffer, so primitives need no
+//					knowledge of the tiling (except for the scissor box, see
+//					SetScissorBox(), and image-wide values, see
+//					IsRenderingFirstTile()).  The first tile is always at the
+//					origin.
+//
+// Input Arguments:
+//		width		= const int& [pixels]
+//		height		= const int& [pixels]
+//		callback	= TileCallback
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the image was rendered successfully
+//
+//=============================================================================
+bool RenderWindow::RenderOffscreen(const int& width, const int& height,
+	TileCallback callback)
+{
+	if (width <= 0 || height <= 0 || viewportCount != 1 || !GetContext())
+		return false;
+
+	// The window need not have been painted (or even shown)
+	{
+		std::lock_guard<std::mutex> lock(renderMutex);
+		MakeCurrent();
+		if (!InitializeOpenGL())
+			return false;
+	}
+
+	mRenderingOffscreen = true;
+	mOffscreenSize.Set(width, height);
+	MakeCurrent();
+	OnRenderSizeChange();
+
+	bool success(true);
+	{
+		std::lock_guard<std::mutex> lock(renderMutex);
+		MakeCurrent();
+
+		GLint maximumSize, maximumSamples, maximumViewport[2];
+		glGetIntegerv(GL_MAX_RENDERBUFFER_SIZE, &maximumSize);
+		glGetIntegerv(GL_MAX_SAMPLES, &maximumSamples);
+		glGetIntegerv(GL_MAX_VIEWPORT_DIMS, maximumViewport);
+
+		// The viewport must be able to cover the entire image
+		if (width > maximumViewport[0] || height > maximumViewport[1])
+			success = false;
+
+		const int tileWidth(std::min(width, std::min(mMaximumTileSize, maximumSize)));
+		const int tileHeight(std::min(height, std::min(mMaximumTileSize, maximumSize)));
+		const int samples(std::min(mOffscreenSamples, maximumSamples));
+
+		// Draw into a multisampled framebuffer (for antialiasing), then
+		// resolve into a single-sampled framebuffer for reading
+		GLuint framebuffers[2], renderbuffers[3];
+		glGenFramebuffers(2, framebuffers);
+		glGenRenderbuffers(3, renderbuffers);
+
+		glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[0]);
+		glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, GL_RGBA8,
+			tileWidth, tileHeight);
+		glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[1]);
+		glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples,
+			GL_DEPTH_COMPONENT24, tileWidth, tileHeight);
+		glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[2]);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, tileWidth, tileHeight);
+		glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+		GLint defaultFramebuffer;
+		glGetIntegerv(GL_FRAMEBUFFER_BINDING, &defaultFramebuffer);
+
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[1]);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+			GL_RENDERBUFFER, renderbuffers[2]);
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+			success = false;
+
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[0]);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+			GL_RENDERBUFFER, renderbuffers[0]);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+			GL_RENDERBUFFER, renderbuffers[1]);
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+			success = false;
+
+		std::vector<unsigned char> tile;
+		if (success)
+			tile.resize(tileWidth * tileHeight * 3);
+
+		glPixelStorei(GL_PACK_ALIGNMENT, 1);
+		int x, y;
+		for (y = 0; success && y < height; y += tileHeight)
+		{
+			for (x = 0; x < width; x += tileWidth)
+			{
+				const int w(std::min(tileWidth, width - x));
+				const int h(std::min(tileHeight, height - y));
+
+				mTileOffset[0] = x;
+				mTileOffset[1] = y;
+				mSizeUpdateRequired = true;
+
+				glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[0]);
+				ApplyScissorBox();
+				const unsigned int shaderCount(mContextResources->shaders.size());
+				DrawScene(false, false);
+
+				// As in Render(), objects whose programs were added mid-draw
+				// require another pass
+				if (mContextResources->shaders.size() != shaderCount)
+					DrawScene(false, false);
+
+				glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffers[0]);
+				glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffers[1]);
+				glBlitFramebuffer(0, 0, w, h, 0, 0, w, h, GL_COLOR_BUFFER_BIT,
+					GL_NEAREST);
+
+				glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffers[1]);
+				glReadPixels(0, 0, w, h, GL_RGB, GL_UNSIGNED_BYTE, tile.data());
+				callback(tile.data(), x, y, w, h);
+			}
+		}
+
+		glBindFramebuffer(GL_FRAMEBUFFER, defaultFramebuffer);
+		glDeleteFramebuffers(2, framebuffers);
+		glDeleteRenderbuffers(3, renderbuffers);
+
+		mTileOffset[0] = 0;
+		mTileOffset[1] = 0;
+		ApplyScissorBox();
+		mLastDrawnWindow = nullptr;
+
+		assert(!GLHasError());
+	}
+
+	// Restore the on-screen layout
+	mRenderingOffscreen = false;
+	mSizeUpdateRequired = true;
+	mStaticLayerValid = false;
+	OnRenderSizeChange();
+	Refresh();
+
+	return success;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		SetScissorBox
+//
+// Description:		Sets the scissor box, accounting for the position of the
+//					current tile when rendering offscreen.  The box is stored
+//					so it can be re-applied for each tile.
+//
+// Input Arguments:
+//		x		= const int& [pixels]
+//		y		= const int& [pixels]
+//		width	= const int& [pixels]
+//		height	= const int& [pixels]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::SetScissorBox(const int& x, const int& y, const int& width,
+	const int& height)
+{
+	mScissorBox[0] = x;
+	mScissorBox[1] = y;
+	mScissorBox[2] = width;
+	mScissorBox[3] = height;
+	mScissorBoxSet = true;
+
+	ApplyScissorBox();
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		ApplyScissorBox
+//
+// Description:		Applies the stored scissor box (if any), accounting for the
+//					position of the current tile.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
 //
 //=============================================================================
-bool RenderWindow::WriteImageToFile(wxString pathAndFileName) const
+void RenderWindow::ApplyScissorBox() const
 {
-	wxImage newImage(GetImage());
-	wxInitAllImageHandlers();
-	return newImage.SaveFile(pathAndFileName);
+	if (mScissorBoxSet)
+		glScissor(mScissorBox[0] - mTileOffset[0], mScissorBox[1] - mTileOffset[1],
+			mScissorBox[2], mScissorBox[3]);
 }
 
 //=============================================================================
 // Class:			RenderWindow
-// Function:		GetImage
+// Function:		ShareContext
 //
-// Description:		Returns an image object representing the contents of the
-//					window.
+// Description:		Configures this object to use the OpenGL context of another
+//					window instead of creating its own.  The shader programs
+//					and curve buffer built for the context are shared, too.
 //
 // Input Arguments:
-//		None
+//		window	= RenderWindow&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		wxImage
+//		None
 //
 //=============================================================================
-wxImage RenderWindow::GetImage() const
+void RenderWindow::ShareContext(RenderWindow& window)
 {
-	unsigned int height = GetSize().GetHeight();
-	unsigned int width = GetSize().GetWidth();
-
-	GLubyte *imageBuffer = (GLubyte*)malloc(width * height * sizeof(GLubyte) * 3);
-	glPixelStorei(GL_PACK_ALIGNMENT, 1);
-	glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, imageBuffer);
-
-	wxImage newImage(width, height, imageBuffer, true);
-	newImage = newImage.Mirror(false);
-
-	free(imageBuffer);
-
-	return newImage;
+	assert(!mContext && "Context must be shared before it is created");
+	assert(&window != this);
+	assert(mContextResources->shaders.empty());
+
+	window.GetContext();
+	mContext = window.mContext;
+	mContextResources = window.mContextResources;
+	mContextShared = true;
+	window.mContextShared = true;
 }
 
 //=============================================================================
@@ -1555,8 +2714,8 @@ Eigen::Matrix4d RenderWindow::Generate2DProjectionMatrix() const
 {
 	// Set up an orthogonal 2D projection matrix (this puts (0,0) at the lower left-hand corner of the window)
 	Eigen::Matrix4d projectionMatrix(Eigen::Matrix4d::Zero());
-	projectionMatrix(0, 0) = 2.0 / GetSize().GetWidth();
-	projectionMatrix(1, 1) = 2.0 / GetSize().GetHeight();
+	projectionMatrix(0, 0) = 2.0 / GetRenderSize().GetWidth();
+	projectionMatrix(1, 1) = 2.0 / GetRenderSize().GetHeight();
 	projectionMatrix(2, 2) = -2.0;
 	projectionMatrix(0, 3) = -1.0;
 	projectionMatrix(1, 3) = -1.0;
@@ -1837,7 +2996,8 @@ GLuint RenderWindow::CreateShader(const GLenum& type, const std::string& shaderC
 // Description:		Builds the default program.
 //
 // Input Arguments:
-//		shaderList	= const std::vector<GLuint>&
+//		shaderList			= const std::vector<GLuint>&
+//		retrievableBinary	= const bool&
 //
 // Output Arguments:
 //		None
@@ -1846,12 +3006,16 @@ GLuint RenderWindow::CreateShader(const GLenum& type, const std::string& shaderC
 //		GLuint specifying the index of the program
 //
 //=============================================================================
-GLuint RenderWindow::CreateProgram(const std::vector<GLuint>& shaderList)
+GLuint RenderWindow::CreateProgram(const std::vector<GLuint>& shaderList,
+	const bool& retrievableBinary)
 {
 	GLuint program = glCreateProgram();
 	for (const auto& shader : shaderList)
 		glAttachShader(program, shader);
 
+	if (retrievableBinary)
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
 	glLinkProgram(program);
 	GLint status;
 	glGetProgramiv(program, GL_LINK_STATUS, &status);
@@ -1877,6 +3041,213 @@ GLuint RenderWindow::CreateProgram(const std::vector<GLuint>& shaderList)
 	return program;
 }
 
+//=============================================================================
+// Class:			RenderWindow
+// Function:		CreateCachedProgram
+//
+// Description:		Builds a program from the specified sources, loading a
+//					previously saved program binary if one is available.
+//
+// Input Arguments:
+//		sources	= const std::vector<ShaderSource>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		GLuint specifying the index of the program
+//
+//=============================================================================
+GLuint RenderWindow::CreateCachedProgram(const std::vector<ShaderSource>& sources)
+{
+	wxString fileName;
+	if (GLEW_ARB_get_program_binary)
+	{
+		GLint formatCount(0);
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+		if (formatCount > 0)
+			fileName = GetProgramCacheFileName(sources);
+	}
+
+	if (!fileName.IsEmpty())
+	{
+		const GLuint program(LoadProgramBinary(fileName));
+		if (program != 0)
+			return program;
+	}
+
+	std::vector<GLuint> shaderList;
+	for (const auto& source : sources)
+		shaderList.push_back(CreateShader(source.type, source.contents));
+
+	const GLuint program(CreateProgram(shaderList, !fileName.IsEmpty()));
+	if (!fileName.IsEmpty())
+		SaveProgramBinary(program, fileName);
+
+	return program;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		GetProgramCacheFileName
+//
+// Description:		Returns the file name for the cached binary of the program
+//					built from the specified sources.  The name is a hash of
+//					the driver identification strings and the shader sources,
+//					so binaries are never shared between drivers.
+//
+// Input Arguments:
+//		sources	= const std::vector<ShaderSource>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		wxString
+//
+//=============================================================================
+wxString RenderWindow::GetProgramCacheFileName(
+	const std::vector<ShaderSource>& sources)
+{
+	// 64-bit FNV-1a (std::hash is not guaranteed to be stable between runs)
+	unsigned long long hash(14695981039346656037ULL);
+	auto addToHash([&hash](const std::string& s)
+	{
+		for (const auto& c : s)
+		{
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ULL;
+		}
+
+		hash ^= 0xFF;// Separator, so concatenated strings hash differently
+		hash *= 1099511628211ULL;
+	});
+
+	addToHash(reinterpret_cast<const char*>(glGetString(GL_VENDOR)));
+	addToHash(reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+	addToHash(reinterpret_cast<const char*>(glGetString(GL_VERSION)));
+	for (const auto& source : sources)
+	{
+		addToHash(std::to_string(source.type));
+		addToHash(source.contents);
+	}
+
+	wxString directory(mProgramCacheDirectory);
+	if (directory.IsEmpty())
+		directory = wxStandardPaths::Get().GetUserLocalDataDir()
+			+ wxFileName::GetPathSeparator() + _T("programCache");
+
+	std::ostringstream ss;
+	ss << std::hex << std::setw(16) << std::setfill('0') << hash << ".bin";
+	return directory + wxFileName::GetPathSeparator() + ss.str();
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		LoadProgramBinary
+//
+// Description:		Creates a program from the binary stored in the specified
+//					file.  Files which the driver rejects are deleted.
+//
+// Input Arguments:
+//		fileName	= const wxString&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		GLuint specifying the index of the program, or zero on failure
+//
+//=============================================================================
+GLuint RenderWindow::LoadProgramBinary(const wxString& fileName)
+{
+	std::ifstream file(fileName.mb_str(), std::ios::in | std::ios::binary);
+	if (!file.is_open())
+		return 0;
+
+	GLenum format;
+	if (!file.read(reinterpret_cast<char*>(&format), sizeof(format)))
+		return 0;
+
+	const std::vector<char> binary((std::istreambuf_iterator<char>(file)),
+		std::istreambuf_iterator<char>());
+	file.close();
+	if (binary.empty())
+		return 0;
+
+	GLuint program(glCreateProgram());
+	glProgramBinary(program, format, binary.data(), binary.size());
+
+	GLint status;
+	glGetProgramiv(program, GL_LINK_STATUS, &status);
+	if (status == GL_FALSE)
+	{
+		glDeleteProgram(program);
+		GLHasError();// Clears the error generated for unrecognized formats
+
+		wxRemoveFile(fileName);
+		return 0;
+	}
+
+	assert(!GLHasError());
+
+	return program;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		SaveProgramBinary
+//
+// Description:		Writes the binary for the specified program to file.  The
+//					file is written under a temporary name first so other
+//					processes never read a partial binary.  Failures are
+//					ignored (the program will be compiled next time).
+//
+// Input Arguments:
+//		program		= const GLuint&
+//		fileName	= const wxString&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::SaveProgramBinary(const GLuint& program,
+	const wxString& fileName)
+{
+	GLint length(0);
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+		return;
+
+	std::vector<char> binary(length);
+	GLenum format;
+	GLsizei actualLength;
+	glGetProgramBinary(program, length, &actualLength, &format, binary.data());
+	assert(!GLHasError());
+
+	const wxFileName name(fileName);
+	if (!name.DirExists() &&
+		!wxFileName::Mkdir(name.GetPath(), wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL))
+		return;
+
+	const wxString tempFileName(fileName + _T(".tmp"));
+	{
+		std::ofstream file(tempFileName.mb_str(), std::ios::out | std::ios::binary);
+		if (!file.is_open())
+			return;
+
+		file.write(reinterpret_cast<const char*>(&format), sizeof(format));
+		file.write(binary.data(), actualLength);
+		if (!file.good())
+			return;
+	}
+
+	wxRenameFile(tempFileName, fileName, true);
+}
+
 //=============================================================================
 // Class:			RenderWindow
 // Function:		BuildShaders
@@ -1896,15 +3267,15 @@ GLuint RenderWindow::CreateProgram(const std::vector<GLuint>& shaderList)
 //=============================================================================
 void RenderWindow::BuildShaders()
 {
-	std::vector<GLuint> shaderList;
-	shaderList.push_back(CreateDefaultVertexShader());
-	shaderList.push_back(CreateDefaultFragmentShader());
+	std::vector<ShaderSource> sources;
+	sources.push_back({ GL_VERTEX_SHADER, GetDefaultVertexShader() });
+	sources.push_back({ GL_FRAGMENT_SHADER, GetDefaultFragmentShader() });
 
 	if (HasGeometryShader())
-		shaderList.push_back(CreateDefaultGeometryShader());
+		sources.push_back({ GL_GEOMETRY_SHADER, GetDefaultGeometryShader() });
 
 	ShaderInfo s;
-	s.programId = CreateProgram(shaderList);
+	s.programId = CreateCachedProgram(sources);
 
 	AssignDefaultLocations(s);
 	AddShader(s);
@@ -2071,7 +3442,7 @@ void RenderWindow::UseDefaultProgram()
 void RenderWindow::UseProgram(const unsigned int& program)
 {
 	mActiveProgram = program;
-	glUseProgram(mShaders[program].programId);
+	glUseProgram(mContextResources->shaders[program].programId);
 }
 
 //=============================================================================
@@ -2114,7 +3485,7 @@ void RenderWindow::ShiftForExactPixelization()
 //=============================================================================
 unsigned int RenderWindow::AddShader(const ShaderInfo& shader)
 {
-	mShaders.push_back(shader);
+	mContextResources->shaders.push_back(shader);
 	mModified = true;
 
 #ifdef _DEBUG
@@ -2129,7 +3500,7 @@ unsigned int RenderWindow::AddShader(const ShaderInfo& shader)
 	}
 #endif// _DEBUG
 
-	return mShaders.size() - 1;
+	return mContextResources->shaders.size() - 1;
 }
 
 //=============================================================================
@@ -2209,4 +3580,186 @@ void RenderWindow::MakeCurrent()
 	SetCurrent(*GetContext());
 }
 
+//=============================================================================
+// Class:			RenderWindow
+// Function:		SetCollectStatistics
+//
+// Description:		Enables or disables collection of per-frame performance
+//					counters.  Disabling collection also stops any trace.
+//
+// Input Arguments:
+//		collect	= const bool&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::SetCollectStatistics(const bool& collect)
+{
+	mCollectStatistics = collect;
+	if (!mCollectStatistics)
+		StopStatisticsTrace();
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		SetFrameTimeBudget
+//
+// Description:		Sets the frame time budget and resets the count of frames
+//					exceeding the budget.
+//
+// Input Arguments:
+//		budget	= const double& [sec]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::SetFrameTimeBudget(const double& budget)
+{
+	assert(budget > 0.0);
+	mFrameTimeBudget = budget;
+	mFramesOverBudget = 0;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		StartStatisticsTrace
+//
+// Description:		Opens the specified file and starts writing the statistics
+//					for each frame to it (in CSV format).
+//
+// Input Arguments:
+//		pathAndFileName	= const wxString&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the file was opened successfully
+//
+//=============================================================================
+bool RenderWindow::StartStatisticsTrace(const wxString& pathAndFileName)
+{
+	StopStatisticsTrace();
+
+	mStatisticsTrace.open(pathAndFileName.mb_str());
+	if (!mStatisticsTrace.is_open())
+		return false;
+
+	RenderStatistics::WriteTraceHeader(mStatisticsTrace);
+	mCollectStatistics = true;
+	return true;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		StopStatisticsTrace
+//
+// Description:		Closes the statistics trace file, if one is open.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::StopStatisticsTrace()
+{
+	if (mStatisticsTrace.is_open())
+		mStatisticsTrace.close();
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		FinishStatistics
+//
+// Description:		Completes the statistics for the frame which was just drawn
+//					and writes them to the trace file, if one is open.
+//
+// Input Arguments:
+//		drawStartTime	= const std::chrono::steady_clock::time_point&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::FinishStatistics(
+	const std::chrono::steady_clock::time_point& drawStartTime)
+{
+	mActiveStatistics = nullptr;
+
+	mStatistics.frameTime = mLastFrameTime;
+	mStatistics.drawTime = std::chrono::duration<double>(
+		std::chrono::steady_clock::now() - drawStartTime).count();
+	mStatistics.overBudget = mStatistics.frameTime > mFrameTimeBudget;
+	if (mStatistics.overBudget)
+		++mFramesOverBudget;
+
+	if (mStatisticsTrace.is_open())
+		mStatistics.WriteTrace(mStatisticsTrace);
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		RecordDrawCalls
+//
+// Description:		Adds to the draw call count for the frame being rendered.
+//
+// Input Arguments:
+//		count	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::RecordDrawCalls(const unsigned int& count)
+{
+	if (mActiveStatistics)
+		mActiveStatistics->drawCalls += count;
+}
+
+//=============================================================================
+// Class:			RenderWindow
+// Function:		RecordUpload
+//
+// Description:		Adds to the upload counters for the frame being rendered.
+//
+// Input Arguments:
+//		vertexCount	= const unsigned int&
+//		bytes		= const std::size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RenderWindow::RecordUpload(const unsigned int& vertexCount,
+	const std::size_t& bytes)
+{
+	if (mActiveStatistics)
+	{
+		mActiveStatistics->uploadedVertices += vertexCount;
+		mActiveStatistics->uploadedBytes += bytes;
+	}
+}
+
 }// namespace LibPlot2D
@@ -22,9 +22,6 @@
 #include "lp2d/renderer/text.h"
 #include "lp2d/renderer/renderWindow.h"
 
-// Freetype headers
-#include FT_MODULE_H
-
 namespace LibPlot2D
 {
 
@@ -45,13 +42,10 @@ namespace LibPlot2D
 //
 //=============================================================================
 GLint Text::mVertexLocation;
-GLint Text::mIndexLocation;
-FT_Library Text::mFt;
-unsigned int Text::mFtReferenceCount(0);
 
 const std::string Text::mTextColorName("textColor");
+const std::string Text::mOffsetName("offset");
 const std::string Text::mVertexName("vertex");
-const std::string Text::mTextureIndexName("texIndex");
 
 //=============================================================================
 // Class:			Text
@@ -61,7 +55,6 @@ const std::string Text::mTextureIndexName("texIndex");
 //
 // Input Arguments:
 //		0	= vertex
-//		1	= texIndex
 //
 // Output Arguments:
 //		None
@@ -75,18 +68,16 @@ const std::string Text::mVertexShader(
 	"\n"
 	"uniform mat4 projectionMatrix;\n"
 	"uniform mat4 modelviewMatrix;\n"
+	"uniform vec2 offset;\n"
 	"\n"
 	"layout(location = 0) in vec4 vertex;// <vec2 pos, vec2 tex>\n"
-	"layout(location = 1) in uint texIndex;\n"
 	"\n"
 	"out vec2 texCoords;\n"
-	"flat out uint index;\n"
 	"\n"
 	"void main()\n"
 	"{\n"
-	"    gl_Position = projectionMatrix * modelviewMatrix * vec4(vertex.xy, 0.0, 1.0);\n"
+	"    gl_Position = projectionMatrix * modelviewMatrix * vec4(vertex.xy + offset, 0.0, 1.0);\n"
 	"    texCoords = vertex.zw;\n"
-	"    index = texIndex;\n"
 	"}\n"
 );
 
@@ -109,17 +100,16 @@ const std::string Text::mVertexShader(
 const std::string Text::mFragmentShader(
 	"#version 400\n"
 	"\n"
-	"uniform sampler2DArray text;\n"
+	"uniform sampler2D text;\n"
 	"uniform vec3 textColor;\n"
 	"\n"
 	"in vec2 texCoords;\n"
-	"flat in uint index;\n"
 	"\n"
 	"out vec4 color;\n"
 	"\n"
 	"void main()\n"
 	"{\n"
-	"    highp vec4 sampled = vec4(1.0, 1.0, 1.0, texture(text, vec3(texCoords, index)).r);\n"
+	"    highp vec4 sampled = vec4(1.0, 1.0, 1.0, texture(text, texCoords).r);\n"
 	"    color = vec4(textColor, 1.0) * sampled;\n"
 	"}\n"
 );
@@ -143,7 +133,6 @@ const std::string Text::mFragmentShader(
 Text::Text(RenderWindow& renderer) : mRenderer(renderer)
 {
 	SetOrientation(0.0);
-	Initialize();
 }
 
 //=============================================================================
@@ -164,67 +153,50 @@ Text::Text(RenderWindow& renderer) : mRenderer(renderer)
 //=============================================================================
 Text::~Text()
 {
-	FreeFTResources();
+	if (mAtlas)
+		FontCache::ReleaseAtlas(mAtlas);
 
-	if (glIsTexture(mTextureId))
-		glDeleteTextures(1, &mTextureId);
+	if (mFaceLoaded)
+		FontCache::ReleaseFace(mFontFileName);
 }
 
 //=============================================================================
 // Class:			Text
-// Function:		Initialize
+// Function:		SetFace
 //
-// Description:		Initializes the Freetype back-end of this object.  Must
-//					be called prior to any other post-creation method.
+// Description:		Sets the font file to use for this object.  Must be called
+//					prior to any other post-creation method.  If the face is
+//					changed after text has been laid out, the size must be set
+//					again before the next call to BuildText().
 //
 // Input Arguments:
-//		None
+//		fontFileName	= const std::string&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		None
+//		bool, true for success, false otherwise
 //
 //=============================================================================
-void Text::Initialize()
+bool Text::SetFace(const std::string& fontFileName)
 {
-	assert(!mGlyphsGenerated);
-	assert(mIsOK);
-
-	if (mFtReferenceCount == 0)
+	if (mAtlas)
 	{
-		if (FT_Init_FreeType(&mFt))
-			mIsOK = false;
+		FontCache::ReleaseAtlas(mAtlas);
+		mAtlas = nullptr;
+		ClearMeshCache();
 	}
 
-	++mFtReferenceCount;
-}
+	mIsOK = true;
+	if (mFaceLoaded)
+		FontCache::ReleaseFace(mFontFileName);
 
-//=============================================================================
-// Class:			Text
-// Function:		SetFace
-//
-// Description:		Initializes the Freetype back-end of this object.  Must
-//					be called prior to any other post-creation method.
-//
-// Input Arguments:
-//		None
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//=============================================================================
-bool Text::SetFace(const std::string& fontFileName)
-{
-	assert(!mGlyphsGenerated);
-	if (FT_New_Face(mFt, fontFileName.c_str(), 0, &mFace))
-		return false;
+	mFaceLoaded = FontCache::AcquireFace(fontFileName);
+	if (mFaceLoaded)
+		mFontFileName = fontFileName;
 
-	return true;
+	return mFaceLoaded;
 }
 
 //=============================================================================
@@ -268,159 +240,72 @@ void Text::SetSize(const double& height)
 //=============================================================================
 void Text::SetSize(const double& width, const double& height)
 {
-	assert(!mGlyphsGenerated);
-	FT_Set_Pixel_Sizes(mFace, width, height);
+	assert(!mAtlas);
+	mWidth = static_cast<unsigned int>(width);
+	mHeight = static_cast<unsigned int>(height);
 }
 
 //=============================================================================
 // Class:			Text
-// Function:		GenerateGlyphs
+// Function:		BuildText
 //
-// Description:		Generates the set of glyphs.
+// Description:		Generates the vertex buffer information for this object.
 //
 // Input Arguments:
 //		None
 //
 // Output Arguments:
-//		None
+//		bufferInfo	= Primitive::BufferInfo&
 //
 // Return Value:
-//		bool, true for success, false otherwise
+//		None
 //
 //=============================================================================
-bool Text::GenerateGlyphs()
+void Text::BuildText(Primitive::BufferInfo& bufferInfo)
 {
-	assert(!RenderWindow::GLHasError());
-	assert(!mGlyphsGenerated);// Doing this twice could leak memory via OpenGL
-
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-	Glyph g;
-	GLubyte c;
-
-	mMaxXSize = 0;
-	mMaxYSize = 0;
-
-	if (FT_Select_Charmap(mFace, FT_ENCODING_UNICODE))
-		return false;
-
-	// First loop determines max required image size
-	const unsigned int glyphCount(128);
-	for (c = 0; c < glyphCount; ++c)
-	{
-		if (FT_Load_Char(mFace, c, FT_LOAD_RENDER))
-			return false;
-
-		mMaxXSize = std::max(mMaxXSize, mFace->glyph->bitmap.width);
-		mMaxYSize = std::max(mMaxYSize, mFace->glyph->bitmap.rows);
-	}
-
-	glGenTextures(1, &mTextureId);
-	glBindTexture(GL_TEXTURE_2D_ARRAY, mTextureId);
+	DoInternalInitialization();
+	mRenderer.InitializePrimitiveType(*this);
 
-	glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RED, mMaxXSize, mMaxYSize, glyphCount,
-		0, GL_RED, GL_UNSIGNED_BYTE, nullptr);
+	if (mInstances.empty())
+		mInstances.push_back({mText, mX, mY});
 
-	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BASE_LEVEL, 0);
-	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, 0);
+	bufferInfo.vertexCount = 0;
+	bufferInfo.vertexCountModified = false;
+	mDrawList.clear();
 
-	// Second loop actually builds and stores the textures
-	for (c = 0; c < glyphCount; ++c)
+	if (mAtlas)
 	{
-		if (FT_Load_Char(mFace, c, FT_LOAD_RENDER))
-			return false;
-
-		int w, h, d;
-		glGetTexLevelParameteriv(GL_TEXTURE_2D_ARRAY, 0, GL_TEXTURE_WIDTH, &w);
-		glGetTexLevelParameteriv(GL_TEXTURE_2D_ARRAY, 0, GL_TEXTURE_HEIGHT, &h);
-		glGetTexLevelParameteriv(GL_TEXTURE_2D_ARRAY, 0, GL_TEXTURE_DEPTH, &d);
-
-		glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, c,
-			mFace->glyph->bitmap.width, mFace->glyph->bitmap.rows, 1,
-			GL_RED, GL_UNSIGNED_BYTE, mFace->glyph->bitmap.buffer);// TODO:  Memory leak here
-
-		g.index = c;
-		g.xSize = mFace->glyph->bitmap.width;
-		g.ySize = mFace->glyph->bitmap.rows;
-		g.xBearing = mFace->glyph->bitmap_left;
-		g.yBearing = mFace->glyph->bitmap_top;
-		g.advance = mFace->glyph->advance.x;
-
-		mGlyphs.insert(std::make_pair(c, g));
+		// Strings that are no longer used are only discarded when the cache
+		// grows too large (i.e. after zooming through many tick values)
+		if (mMeshCache.size() > mMaxCachedStrings)
+			ClearMeshCache();
+
+		for (const auto& instance : mInstances)
+		{
+			const StringMesh& mesh(GetMesh(instance.text));
+			if (mesh.vertexCount == 0)
+				continue;
+
+			mDrawList.push_back({ mesh.firstVertex, mesh.vertexCount,
+				static_cast<float>(instance.x), static_cast<float>(instance.y) });
+			bufferInfo.vertexCount += mesh.vertexCount;
+		}
+
+		UploadMeshes();
 	}
 
-	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
-	mGlyphsGenerated = true;
-
-	assert(!RenderWindow::GLHasError());
-	return true;
+	mInstances.clear();
 }
 
 //=============================================================================
 // Class:			Text
-// Function:		FreeFTResources
+// Function:		RenderBufferedGlyph
 //
-// Description:		Frees previously allocated Freetype resources (with
-//					reference counting).
+// Description:		Renders each instance of the strings prepared in the last
+//					call to BuildText().
 //
 // Input Arguments:
-//		None
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//=============================================================================
-void Text::FreeFTResources()
-{
-	FT_Done_Face(mFace);
-
-	assert(mFtReferenceCount > 0);
-	--mFtReferenceCount;
-	if (mFtReferenceCount == 0)
-		FT_Done_FreeType(mFt);
-}
-
-//=============================================================================
-// Class:			Text
-// Function:		BuildText
-//
-// Description:		Generates the vertex buffer information for this object.
-//
-// Input Arguments:
-//		None
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		Primitive::BufferInfo
-//
-//=============================================================================
-Primitive::BufferInfo Text::BuildText()
-{
-	if (mBufferVector.size() > 0)
-		return AssembleBuffers();
-
-	Primitive::BufferInfo bufferInfo(BuildLocalText());
-	ConfigureVertexArray(bufferInfo);
-
-	return bufferInfo;
-}
-
-//=============================================================================
-// Class:			Text
-// Function:		BuildText
-//
-// Description:		Generates the vertex buffer information for this object.
-//
-// Input Arguments:
-//		None
+//		vertexCount	= const unsigned int&
 //
 // Output Arguments:
 //		None
@@ -439,16 +324,27 @@ void Text::RenderBufferedGlyph(const unsigned int& vertexCount)
 	// Are we making an exception for color and orientation?  Assume that this object will
 	// be used only to render text having the same color and orientation (and size?).
 	// Maybe put some assertions in the Set() methods then to ensure it hasn't yet been initialized?
-	glUniform3f(mRenderer.GetActiveProgramInfo().uniformLocations.find(mTextColorName)->second, mColor.GetRed(), mColor.GetGreen(), mColor.GetBlue());
-	RenderWindow::SendUniformMatrix(mModelview, mRenderer.GetActiveProgramInfo().uniformLocations.find(RenderWindow::mModelviewName)->second);
+	const RenderWindow::ShaderInfo& shaderInfo(mRenderer.GetActiveProgramInfo());
+	glUniform3f(shaderInfo.uniformLocations.find(mTextColorName)->second, mColor.GetRed(), mColor.GetGreen(), mColor.GetBlue());
+	RenderWindow::SendUniformMatrix(mModelview, shaderInfo.uniformLocations.find(RenderWindow::mModelviewName)->second);
 
 	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D_ARRAY, mTextureId);
+	glBindTexture(GL_TEXTURE_2D, mAtlas->textureId);
+	glBindVertexArray(mMeshBuffer.GetVertexArrayIndex());
 
-	glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+	// OpenGL 4.0 has no base-instance draw calls, so the per-instance offset
+	// is sent as a uniform
+	const GLint offsetLocation(shaderInfo.uniformLocations.find(mOffsetName)->second);
+	for (const auto& item : mDrawList)
+	{
+		glUniform2f(offsetLocation, item.x, item.y);
+		glDrawArrays(GL_TRIANGLES, item.firstVertex, item.vertexCount);
+	}
+	RenderWindow::RecordDrawCalls(static_cast<unsigned int>(mDrawList.size()));
 
+	glBindVertexArray(0);
 	mRenderer.UseDefaultProgram();
-	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+	glBindTexture(GL_TEXTURE_2D, 0);
 
 	assert(!RenderWindow::GLHasError());
 }
@@ -475,39 +371,18 @@ Text::BoundingBox Text::GetBoundingBox(const std::string& s)
 	DoInternalInitialization();
 	mRenderer.InitializePrimitiveType(*this);
 
-	BoundingBox b;
-	b.xLeft = 0;
-	b.xRight = 0;
-	b.yUp = 0;
-	b.yDown = 0;
-
-	for (const auto& c : s)
-	{
-		const auto glyphIt(mGlyphs.find(c));
-		if (glyphIt == mGlyphs.end())
-			continue;
-
-		Glyph g = glyphIt->second;
-
-		//b.xLeft += 0;
-		b.xRight += g.advance >> 6;
-		b.yUp = std::max(b.yUp, g.yBearing);
-		b.yDown = std::min(b.yDown, g.yBearing - g.ySize);
-	}
+	if (!mAtlas)
+		return BoundingBox{ 0, 0, 0, 0 };
 
-	b.xLeft *= mScale;
-	b.xRight *= mScale;
-	b.yUp *= mScale;
-	b.yDown *= mScale;
-
-	return b;
+	return GetMesh(s).boundingBox;
 }
 
 //=============================================================================
 // Class:			Text
 // Function:		DoInternalInitialization
 //
-// Description:		Performs necessary static-state initialization.
+// Description:		Performs necessary static-state initialization (obtains
+//					the glyph atlas from the cache).
 //
 // Input Arguments:
 //		None
@@ -521,11 +396,14 @@ Text::BoundingBox Text::GetBoundingBox(const std::string& s)
 //=============================================================================
 void Text::DoInternalInitialization()
 {
-	if (!mGlyphsGenerated)
-	{
-		if (!GenerateGlyphs())
-			mIsOK = false;
-	}
+	if (mAtlas || !mIsOK)
+		return;
+
+	if (mFaceLoaded)
+		mAtlas = FontCache::AcquireAtlas(mFontFileName, mWidth, mHeight);
+
+	if (!mAtlas)
+		mIsOK = false;
 }
 
 //=============================================================================
@@ -546,27 +424,26 @@ void Text::DoInternalInitialization()
 //=============================================================================
 GLuint Text::DoGLInitialization()
 {
-	std::vector<GLuint> shaderList;
-	shaderList.push_back(mRenderer.CreateShader(GL_VERTEX_SHADER, mVertexShader));
-	shaderList.push_back(mRenderer.CreateShader(GL_FRAGMENT_SHADER, mFragmentShader));
+	std::vector<RenderWindow::ShaderSource> sources;
+	sources.push_back({ GL_VERTEX_SHADER, mVertexShader });
+	sources.push_back({ GL_FRAGMENT_SHADER, mFragmentShader });
 
 	RenderWindow::ShaderInfo s;
-	s.programId = mRenderer.CreateProgram(shaderList);
+	s.programId = RenderWindow::CreateCachedProgram(sources);
 	s.needsModelview = false;
 	s.needsProjection = true;
 	s.uniformLocations[RenderWindow::mProjectionName] = glGetUniformLocation(s.programId, RenderWindow::mProjectionName.c_str());
 	s.uniformLocations[RenderWindow::mModelviewName] = glGetUniformLocation(s.programId, RenderWindow::mModelviewName.c_str());
 	s.uniformLocations[mTextColorName] = glGetUniformLocation(s.programId, mTextColorName.c_str());
+	s.uniformLocations[mOffsetName] = glGetUniformLocation(s.programId, mOffsetName.c_str());
 
 	assert(!RenderWindow::GLHasError());
 
 	mVertexLocation = glGetAttribLocation(s.programId, mVertexName.c_str());
-	mIndexLocation = glGetAttribLocation(s.programId, mTextureIndexName.c_str());
 
 	assert(!RenderWindow::GLHasError());
 
 	s.attributeLocations[mVertexName] = mVertexLocation;
-	s.attributeLocations[mTextureIndexName] = mIndexLocation;
 
 	return mRenderer.AddShader(s);
 }
@@ -596,16 +473,13 @@ void Text::SetOrientation(const double& angle)
 
 //=============================================================================
 // Class:			Text
-// Function:		AppendText
+// Function:		SetScale
 //
-// Description:		Appends text to the render buffer.  Use this instead of
-//					SetText() when multiple text values must be rendered with
-//					different positions, scales, etc.  Text will be rendered
-//					with current settings (i.e. this must be the last call
-//					for this string in the update loop).
+// Description:		Sets the scale factor.  Cached meshes are laid out at the
+//					old scale, so they are discarded.
 //
 // Input Arguments:
-//		text	= const std::string&
+//		scale	= const double&
 //
 // Output Arguments:
 //		None
@@ -614,20 +488,27 @@ void Text::SetOrientation(const double& angle)
 //		None
 //
 //=============================================================================
-void Text::AppendText(const std::string& text)
+void Text::SetScale(const double& scale)
 {
-	SetText(text);
-	mBufferVector.push_back(BuildLocalText());
+	assert(scale > 0.0);
+	if (scale == mScale)
+		return;
+
+	mScale = scale;
+	ClearMeshCache();
 }
 
 //=============================================================================
 // Class:			Text
-// Function:		AssembleBuffers
+// Function:		AppendText
 //
-// Description:		Assembles
+// Description:		Appends an instance of the string to the render list.  Use
+//					this instead of SetText() when multiple text values must be
+//					rendered with different positions.  Text will be rendered
+//					at the current position.
 //
 // Input Arguments:
-//		None
+//		text	= const std::string&
 //
 // Output Arguments:
 //		None
@@ -636,150 +517,165 @@ void Text::AppendText(const std::string& text)
 //		None
 //
 //=============================================================================
-Primitive::BufferInfo Text::AssembleBuffers()
+void Text::AppendText(const std::string& text)
 {
-	Primitive::BufferInfo bufferInfo;
-
-	for (const auto& buffer : mBufferVector)
-	{
-		bufferInfo.indexBuffer.insert(bufferInfo.indexBuffer.end(),
-			buffer.indexBuffer.begin(),
-			buffer.indexBuffer.end());
-		bufferInfo.vertexBuffer.insert(bufferInfo.vertexBuffer.end(),
-			buffer.vertexBuffer.begin(),
-			buffer.vertexBuffer.end());
-		bufferInfo.vertexCount += buffer.vertexCount;
-	}
-
-	ConfigureVertexArray(bufferInfo);
-	mBufferVector.clear();
-
-	return bufferInfo;
+	SetText(text);
+	mInstances.push_back({ text, mX, mY });
 }
 
 //=============================================================================
 // Class:			Text
-// Function:		BuildLocalText
+// Function:		GetMesh
 //
-// Description:		Allocates buffers and populates local (CPU-side) memory
-//					to render text.
+// Description:		Returns the cached mesh for the specified string, laying
+//					out the glyphs (relative to the origin) if the string has
+//					not been seen before.  Requires a valid atlas.
 //
 // Input Arguments:
-//		None
+//		s	= const std::string&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		Primitive::BufferInfo
+//		const StringMesh&
 //
 //=============================================================================
-Primitive::BufferInfo Text::BuildLocalText()
+const Text::StringMesh& Text::GetMesh(const std::string& s)
 {
-	DoInternalInitialization();
-	mRenderer.InitializePrimitiveType(*this);
+	assert(mAtlas);
+
+	const auto it(mMeshCache.find(s));
+	if (it != mMeshCache.end())
+		return it->second;
 
 	assert(sizeof(GLfloat) == sizeof(float));
-	assert(sizeof(GLuint) == sizeof(unsigned int));
 
-	Primitive::BufferInfo bufferInfo;
-	bufferInfo.vertexCount = 6 * mText.length();
-	bufferInfo.vertexBuffer.resize(bufferInfo.vertexCount * 4);
-	bufferInfo.indexBuffer.resize(bufferInfo.vertexCount);
+	StringMesh mesh;
+	mesh.firstVertex = static_cast<unsigned int>(mMeshVertices.size() / 4);
+	mesh.vertexCount = 0;
 
-	double xStart(mX);
+	BoundingBox& b(mesh.boundingBox);
+	b.xLeft = 0;
+	b.xRight = 0;
+	b.yUp = 0;
+	b.yDown = 0;
 
-	unsigned int i(0), texI(0);
-	for (const auto &c : mText)
+	double xStart(0.0);
+	for (const auto &c : s)
 	{
-		Glyph g = mGlyphs[c];
-
-		GLfloat xpos = xStart + g.xBearing * mScale;
-		GLfloat ypos = mY - (g.ySize - g.yBearing) * mScale;
-
-		GLfloat w = g.xSize * mScale;
-		GLfloat h = g.ySize * mScale;
-
-		bufferInfo.indexBuffer[texI++] = g.index;
-		bufferInfo.indexBuffer[texI++] = g.index;
-		bufferInfo.indexBuffer[texI++] = g.index;
-		bufferInfo.indexBuffer[texI++] = g.index;
-		bufferInfo.indexBuffer[texI++] = g.index;
-		bufferInfo.indexBuffer[texI++] = g.index;
-
-		bufferInfo.vertexBuffer[i++] = xpos;
-		bufferInfo.vertexBuffer[i++] = ypos;
-		bufferInfo.vertexBuffer[i++] = 0.0;
-		bufferInfo.vertexBuffer[i++] = float(g.ySize) / float(mMaxYSize);
-
-		bufferInfo.vertexBuffer[i++] = xpos;
-		bufferInfo.vertexBuffer[i++] = ypos + h;
-		bufferInfo.vertexBuffer[i++] = 0.0;
-		bufferInfo.vertexBuffer[i++] = 0.0;
-
-		bufferInfo.vertexBuffer[i++] = xpos + w;
-		bufferInfo.vertexBuffer[i++] = ypos + h;
-		bufferInfo.vertexBuffer[i++] = float(g.xSize) / float(mMaxXSize);
-		bufferInfo.vertexBuffer[i++] = 0.0;
-
-		bufferInfo.vertexBuffer[i++] = xpos + w;
-		bufferInfo.vertexBuffer[i++] = ypos + h;
-		bufferInfo.vertexBuffer[i++] = float(g.xSize) / float(mMaxXSize);
-		bufferInfo.vertexBuffer[i++] = 0.0;
-
-		bufferInfo.vertexBuffer[i++] = xpos + w;
-		bufferInfo.vertexBuffer[i++] = ypos;
-		bufferInfo.vertexBuffer[i++] = float(g.xSize) / float(mMaxXSize);
-		bufferInfo.vertexBuffer[i++] = float(g.ySize) / float(mMaxYSize);
-
-		bufferInfo.vertexBuffer[i++] = xpos;
-		bufferInfo.vertexBuffer[i++] = ypos;
-		bufferInfo.vertexBuffer[i++] = 0.0;
-		bufferInfo.vertexBuffer[i++] = float(g.ySize) / float(mMaxYSize);
+		const auto glyphIt(mAtlas->glyphs.find(c));
+		if (glyphIt == mAtlas->glyphs.end())
+			continue;
+
+		const FontCache::Glyph& g(glyphIt->second);
+
+		const GLfloat xpos = xStart + g.xBearing * mScale;
+		const GLfloat ypos = -(g.ySize - g.yBearing) * mScale;
+
+		const GLfloat w = g.xSize * mScale;
+		const GLfloat h = g.ySize * mScale;
+
+		mMeshVertices.insert(mMeshVertices.end(), {
+			xpos, ypos, g.sLeft, g.tBottom,
+			xpos, ypos + h, g.sLeft, g.tTop,
+			xpos + w, ypos + h, g.sRight, g.tTop,
+			xpos + w, ypos + h, g.sRight, g.tTop,
+			xpos + w, ypos, g.sRight, g.tBottom,
+			xpos, ypos, g.sLeft, g.tBottom });
+		mesh.vertexCount += 6;
 
 		xStart += (g.advance >> 6) * mScale;// Bitshift by 6 to get value in pixels (2^6 = 64)
-    }
 
-	return bufferInfo;
+		//b.xLeft += 0;
+		b.xRight += g.advance >> 6;
+		b.yUp = std::max(b.yUp, g.yBearing);
+		b.yDown = std::min(b.yDown, g.yBearing - g.ySize);
+	}
+
+	b.xLeft *= mScale;
+	b.xRight *= mScale;
+	b.yUp *= mScale;
+	b.yDown *= mScale;
+
+	return mMeshCache.insert(std::make_pair(s, mesh)).first->second;
 }
 
 //=============================================================================
 // Class:			Text
-// Function:		ConfigureVertexArray
+// Function:		ClearMeshCache
 //
-// Description:		Handles configuration of OpenGL vertex array object.
+// Description:		Discards all cached meshes.  The vertex buffer is retained
+//					and overwritten as strings are laid out again.
 //
 // Input Arguments:
-//		bufferInfo	= Primitive::BufferInfo&
+//		None
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		Primitive::BufferInfo
+//		None
 //
 //=============================================================================
-void Text::ConfigureVertexArray(Primitive::BufferInfo& bufferInfo) const
+void Text::ClearMeshCache()
 {
-	bufferInfo.GetOpenGLIndices(true);
-	glBindVertexArray(bufferInfo.GetVertexArrayIndex());
+	mMeshCache.clear();
+	mMeshVertices.clear();
+	mUploadedSize = 0;
+}
 
-	glBindBuffer(GL_ARRAY_BUFFER, bufferInfo.GetVertexBufferIndex());
-    glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * bufferInfo.vertexBuffer.size(),
-		bufferInfo.vertexBuffer.data(), GL_DYNAMIC_DRAW);
+//=============================================================================
+// Class:			Text
+// Function:		UploadMeshes
+//
+// Description:		Sends any newly laid-out meshes to the GPU.  Only the
+//					portion of the buffer that has not yet been uploaded is
+//					sent, unless the buffer must grow.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Text::UploadMeshes()
+{
+	if (mUploadedSize == mMeshVertices.size())
+		return;
 
-	glEnableVertexAttribArray(mVertexLocation);
-	glVertexAttribPointer(mVertexLocation, 4, GL_FLOAT, GL_FALSE, 0, 0);
+	mMeshBuffer.GetOpenGLIndices();
+	glBindVertexArray(mMeshBuffer.GetVertexArrayIndex());
+	glBindBuffer(GL_ARRAY_BUFFER, mMeshBuffer.GetVertexBufferIndex());
 
-	glBindBuffer(GL_ARRAY_BUFFER, bufferInfo.GetIndexBufferIndex());
-	glBufferData(GL_ARRAY_BUFFER, sizeof(GLuint) * bufferInfo.indexBuffer.size(),
-		bufferInfo.indexBuffer.data(), GL_DYNAMIC_DRAW);
+	if (mMeshVertices.size() > mBufferCapacity)
+	{
+		const unsigned int minimumCapacity(4096);
+		mBufferCapacity = std::max(std::max(2 * mBufferCapacity, minimumCapacity),
+			static_cast<unsigned int>(mMeshVertices.size()));
+		glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * mBufferCapacity,
+			nullptr, GL_DYNAMIC_DRAW);
+		mUploadedSize = 0;
+
+		glEnableVertexAttribArray(mVertexLocation);
+		glVertexAttribPointer(mVertexLocation, 4, GL_FLOAT, GL_FALSE, 0, 0);
+	}
 
-	glEnableVertexAttribArray(mIndexLocation);
-	glVertexAttribIPointer(mIndexLocation, 1, GL_UNSIGNED_INT, 0, 0);
+	glBufferSubData(GL_ARRAY_BUFFER, sizeof(GLfloat) * mUploadedSize,
+		sizeof(GLfloat) * (mMeshVertices.size() - mUploadedSize),
+		mMeshVertices.data() + mUploadedSize);
+	RenderWindow::RecordUpload((mMeshVertices.size() - mUploadedSize) / 4,
+		sizeof(GLfloat) * (mMeshVertices.size() - mUploadedSize));
+	mUploadedSize = static_cast<unsigned int>(mMeshVertices.size());
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindVertexArray(0);
+
+	assert(!RenderWindow::GLHasError());
 }
 
 }// namespace LibPlot2D
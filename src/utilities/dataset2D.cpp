@@ -139,10 +139,12 @@ void Dataset2D::ExportDataToFile(wxString pathAndFileName) const
 //
 // Description:		Retrieves the Y-value at the specified X-value.  Interpolates
 //					if the X-value is not exactly on a point.  Returns true if
-//					it interpolated.
+//					it interpolated.  The point is located by binary search
+//					only if the X-values are known to be sorted.
 //
 // Input Arguments:
-//		x	= const double& specifying the X-value
+//		x		= const double& specifying the X-value
+//		sortedX	= const bool& indicating that the X-values are sorted
 //
 // Output Arguments:
 //		y	= double& specifying the Y-value
@@ -152,36 +154,46 @@ void Dataset2D::ExportDataToFile(wxString pathAndFileName) const
 //		true if specified x is within range of data, false otherwise
 //
 //=============================================================================
-bool Dataset2D::GetYAt(const double &x, double &y, bool *exactValue) const
+bool Dataset2D::GetYAt(const double &x, double &y, bool *exactValue,
+	const bool &sortedX) const
 {
-	// This assumes data is entered from small x to large x and that y is a function of x
+	// Find the first point at or beyond x.  Binary search is only valid for
+	// sorted data; XY data is scanned in the order it was entered.
 	unsigned int i;
-	for (i = 0; i < mXData.size(); ++i)
+	if (sortedX)
+		i = static_cast<unsigned int>(std::lower_bound(
+			mXData.begin(), mXData.end(), x) - mXData.begin());
+	else
 	{
-		if (mXData[i] == x)
+		for (i = 0; i < mXData.size(); ++i)
 		{
-			y = mYData[i];
+			if (mXData[i] >= x)
+				break;
+		}
+	}
 
-			if (exactValue)
-				*exactValue = true;
+	if (i == mXData.size())
+		return false;
 
-			return true;
-		}
-		else if (mXData[i] > x)
-		{
-			if (i > 0)
-				y = mYData[i - 1] + (mYData[i] - mYData[i - 1]) * (x - mXData[i - 1]) / (mXData[i] - mXData[i - 1]);
-			else
-				y = mYData[i];
+	if (mXData[i] == x)
+	{
+		y = mYData[i];
 
-			if (exactValue)
-				*exactValue = false;
+		if (exactValue)
+			*exactValue = true;
 
-			return true;
-		}
+		return true;
 	}
 
-	return false;
+	if (i > 0)
+		y = mYData[i - 1] + (mYData[i] - mYData[i - 1]) * (x - mXData[i - 1]) / (mXData[i] - mXData[i - 1]);
+	else
+		y = mYData[i];
+
+	if (exactValue)
+		*exactValue = false;
+
+	return true;
 }
 
 //=============================================================================
@@ -15,11 +15,16 @@
 // Standard C++ headers
 #include <cstdlib>
 #include <fstream>
+#include <sstream>
+#include <chrono>
 
 // wxWidgets headers
 #include <wx/wx.h>
 #include <wx/dir.h>
 #include <wx/fontenum.h>
+#include <wx/filename.h>
+#include <wx/stdpaths.h>
+#include <wx/module.h>
 
 // Local headers
 #include "lp2d/utilities/fontFinder.h"
@@ -46,13 +51,34 @@ namespace LibPlot2D
 const unsigned int FontFinder::mFamilyNameRecordId(1);
 const unsigned int FontFinder::mSubFamilyNameRecordId(2);
 const unsigned int FontFinder::mFullNameRecordId(4);
+const std::string FontFinder::mIndexHeader("LibPlot2D font index 1");
+
+std::mutex FontFinder::mIndexMutex;
+FontFinder::FontIndex FontFinder::mIndex;
+bool FontFinder::mIndexLoaded(false);
+std::future<void> FontFinder::mIndexBuilder;
+std::atomic<bool> FontFinder::mCancelIndexBuild(false);
+
+// Module for stopping the font index worker thread when wxWidgets is cleaned
+// up, instead of leaving it to be joined by the static future's destructor
+class FontFinderModule : public wxModule
+{
+public:
+	bool OnInit() override { return true; }
+	void OnExit() override { FontFinder::CancelIndexBuild(); }
+
+private:
+	wxDECLARE_DYNAMIC_CLASS(FontFinderModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(FontFinderModule, wxModule);
 
 //=============================================================================
 // Class:			FontFinder
 // Function:		GetFontFileName
 //
-// Description:		Searches the local hard drive (intelligently) and returns
-//					the path and file name for a preferred font.
+// Description:		Returns the path and file name for a preferred font.  Uses
+//					the font index (see LookUpFontFile()).
 //
 // Input Arguments:
 //		fontName	= const wxString& name of the desired font
@@ -67,32 +93,12 @@ const unsigned int FontFinder::mFullNameRecordId(4);
 //=============================================================================
 wxString FontFinder::GetFontFileName(const wxString &fontName)
 {
-	wxString fontDirectory;
-
-#ifdef __WXMSW__
-	fontDirectory = wxGetOSDirectory() + _T("\\Fonts\\");
-#elif defined __WXGTK__
-	fontDirectory = _T("/usr/share/fonts/");
-#else
-	// Unknown platform - warn the user
-	#	warning "Unrecognized platform - unable to locate font files!"
-		return wxEmptyString;
-#endif
-
-	wxArrayString fontFiles;
-	wxDir::GetAllFiles(fontDirectory, &fontFiles, _T("*.ttf"), wxDIR_FILES | wxDIR_DIRS);
+	const wxString fontFile(LookUpFontFile(fontName));
+	if (!fontFile.IsEmpty() || !IndexBuildInProgress())
+		return fontFile;
 
-	wxString nameFromFile;
-	for (const auto& fontFile : fontFiles)
-	{
-		if (GetFontName(fontFile, nameFromFile))
-		{
-			if (fontName.CmpNoCase(nameFromFile) == 0)
-				return fontFile;
-		}
-	}
-
-	return wxEmptyString;
+	WaitForIndex();
+	return LookUpFontFile(fontName);
 }
 
 //=============================================================================
@@ -100,7 +106,9 @@ wxString FontFinder::GetFontFileName(const wxString &fontName)
 // Function:		GetPreferredFontFileName
 //
 // Description:		Returns the file name for a best match for a font on the
-//					system when given a list of acceptable fonts.
+//					system when given a list of acceptable fonts.  Does not
+//					wait for the font index to be rebuilt if a fallback font
+//					is available.
 //
 // Input Arguments:
 //		encoding		= wxFontEncoding
@@ -109,43 +117,40 @@ wxString FontFinder::GetFontFileName(const wxString &fontName)
 //
 // Output Arguments:
 //		fontFile		= wxString& containing the name of the best match
+//		indexPending	= bool* (optional) indicating that fontFile is a
+//						  fallback font to be replaced once the index is built
 //
 // Return Value:
 //		bool, true for found a match from the preferred list
 //
 //=============================================================================
 bool FontFinder::GetPreferredFontFileName(wxFontEncoding encoding,
-	const wxArrayString &preferredFonts, const bool &fixedWidth, wxString &fontFile)
+	const wxArrayString &preferredFonts, const bool &fixedWidth,
+	wxString &fontFile, bool *indexPending)
 {
+	if (indexPending)
+		*indexPending = false;
+
 	// Get a list of the fonts found on the system
 	const wxArrayString fontList(wxFontEnumerator::GetFacenames(encoding, fixedWidth));
+	if (SearchFontList(fontList, preferredFonts, fontFile))
+		return true;
 
-	// See if any of the installed fonts matches our list of preferred fonts
-	for (const auto& preferredFont : preferredFonts)
-	{
-		for (const auto& font : fontList)
-		{
-			// If the system font matches
-			if (preferredFont.CmpNoCase(font) == 0)
-			{
-				// See if we can find the file for this font
-				fontFile = GetFontFileName(font);
-				if (!fontFile.IsEmpty())
-					return true;
-			}
-		}
-	}
+	// If the index is still being built, don't make the user wait for the
+	// scan to complete - use a fallback font until the index is available
+	if (!IndexBuildInProgress())
+		return false;
 
-	// We didn't find our preferred fonts, now let's just go down the list until we find ANY font file
-	for (const auto& font : fontList)
+	fontFile = GetFallbackFontFileName();
+	if (!fontFile.IsEmpty())
 	{
-		fontFile = GetFontFileName(font);
-		if (!fontFile.IsEmpty())
-			return true;
+		if (indexPending)
+			*indexPending = true;
+		return false;
 	}
 
-	// Nothing found - return false with empty fontFile
-	return false;
+	WaitForIndex();
+	return SearchFontList(fontList, preferredFonts, fontFile);
 }
 
 //=============================================================================
@@ -434,4 +439,490 @@ void FontFinder::CheckHeaderForName(std::ifstream &file,
 	file.seekg(nPos, std::ios_base::beg);
 }
 
+//=============================================================================
+// Class:			FontFinder
+// Function:		SearchFontList
+//
+// Description:		Searches the index for the best match from the list of
+//					preferred fonts.  If none of the preferred fonts are
+//					found, returns the first font on the system which is in
+//					the index.
+//
+// Input Arguments:
+//		fontList		= const wxArrayString& list of fonts on the system
+//		preferredFonts	= const wxArrayString& list of preferred font faces
+//
+// Output Arguments:
+//		fontFile		= wxString& containing the name of the best match
+//
+// Return Value:
+//		bool, true for found a match
+//
+//=============================================================================
+bool FontFinder::SearchFontList(const wxArrayString &fontList,
+	const wxArrayString &preferredFonts, wxString &fontFile)
+{
+	// See if any of the installed fonts matches our list of preferred fonts
+	for (const auto& preferredFont : preferredFonts)
+	{
+		for (const auto& font : fontList)
+		{
+			// If the system font matches
+			if (preferredFont.CmpNoCase(font) == 0)
+			{
+				// See if we can find the file for this font
+				fontFile = LookUpFontFile(font);
+				if (!fontFile.IsEmpty())
+					return true;
+			}
+		}
+	}
+
+	// We didn't find our preferred fonts, now let's just go down the list until we find ANY font file
+	for (const auto& font : fontList)
+	{
+		fontFile = LookUpFontFile(font);
+		if (!fontFile.IsEmpty())
+			return true;
+	}
+
+	// Nothing found - return false with empty fontFile
+	return false;
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		LookUpFontFile
+//
+// Description:		Returns the file for the specified font from the index.
+//					The index is loaded from disk on the first call, and a
+//					background rebuild is started if it is missing or stale.
+//					While the index is being rebuilt, files from the old
+//					index are returned (if they still exist).
+//
+// Input Arguments:
+//		fontName	= const wxString& name of the desired font
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		wxString containing the path to the font file, or an empty string
+//		if the font is not in the index
+//
+//=============================================================================
+wxString FontFinder::LookUpFontFile(const wxString &fontName)
+{
+	if (!mIndexLoaded)
+	{
+		mIndexLoaded = true;
+		LoadIndex();
+
+		bool isCurrent;
+		{
+			std::lock_guard<std::mutex> lock(mIndexMutex);
+			isCurrent = IndexIsCurrent(mIndex);
+		}
+
+		if (!isCurrent)
+			StartIndexBuild();
+	}
+
+	std::lock_guard<std::mutex> lock(mIndexMutex);
+	const auto it(mIndex.files.find(std::string(fontName.Lower().utf8_str())));
+	if (it == mIndex.files.end())
+		return wxEmptyString;
+
+	const wxString fontFile(wxString::FromUTF8(it->second.c_str()));
+	if (!wxFileExists(fontFile))
+		return wxEmptyString;
+
+	return fontFile;
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		GetFontDirectory
+//
+// Description:		Returns the root directory in which font files are found.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		wxString
+//
+//=============================================================================
+wxString FontFinder::GetFontDirectory()
+{
+#ifdef __WXMSW__
+	return wxGetOSDirectory() + _T("\\Fonts\\");
+#elif defined __WXGTK__
+	return _T("/usr/share/fonts/");
+#else
+	// Unknown platform - warn the user
+	#	warning "Unrecognized platform - unable to locate font files!"
+		return wxEmptyString;
+#endif
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		GetFallbackFontFileName
+//
+// Description:		Returns the path to a commonly-installed font file for use
+//					while the index is being built.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		wxString, empty if none of the fallback fonts exist
+//
+//=============================================================================
+wxString FontFinder::GetFallbackFontFileName()
+{
+	wxArrayString candidates;
+#ifdef __WXMSW__
+	candidates.Add(GetFontDirectory() + _T("arial.ttf"));
+	candidates.Add(GetFontDirectory() + _T("segoeui.ttf"));
+#elif defined __WXGTK__
+	candidates.Add(GetFontDirectory() + _T("truetype/dejavu/DejaVuSans.ttf"));
+	candidates.Add(GetFontDirectory() + _T("dejavu/DejaVuSans.ttf"));
+	candidates.Add(GetFontDirectory() + _T("dejavu-sans-fonts/DejaVuSans.ttf"));
+	candidates.Add(GetFontDirectory() + _T("TTF/DejaVuSans.ttf"));
+	candidates.Add(GetFontDirectory() + _T("truetype/liberation/LiberationSans-Regular.ttf"));
+#endif
+
+	for (const auto& candidate : candidates)
+	{
+		if (wxFileExists(candidate))
+			return candidate;
+	}
+
+	return wxEmptyString;
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		GetIndexFileName
+//
+// Description:		Returns the path and file name of the font index file.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		wxString
+//
+//=============================================================================
+wxString FontFinder::GetIndexFileName()
+{
+	return wxStandardPaths::Get().GetUserLocalDataDir()
+		+ wxFileName::GetPathSeparator() + _T("fontIndex.txt");
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		LoadIndex
+//
+// Description:		Reads the font index from disk.  Missing or corrupt files
+//					result in an empty index.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FontFinder::LoadIndex()
+{
+	std::ifstream file(GetIndexFileName().mb_str());
+	if (!file.is_open())
+		return;
+
+	std::string line;
+	if (!std::getline(file, line) || line != mIndexHeader)
+		return;
+
+	// Each line is <type>\t<value>\t<path>, where type is D for directories
+	// (value is the modification time) and F for files (value is the font
+	// name)
+	FontIndex index;
+	while (std::getline(file, line))
+	{
+		const std::string::size_type first(line.find('\t'));
+		const std::string::size_type second(line.find('\t', first + 1));
+		if (first != 1 || second == std::string::npos)
+			return;
+
+		const std::string value(line.substr(first + 1, second - first - 1));
+		const std::string path(line.substr(second + 1));
+		if (line[0] == 'D')
+		{
+			std::istringstream ss(value);
+			long long modificationTime;
+			if (!(ss >> modificationTime))
+				return;
+			index.directories[path] = modificationTime;
+		}
+		else if (line[0] == 'F')
+			index.files[value] = path;
+		else
+			return;
+	}
+
+	std::lock_guard<std::mutex> lock(mIndexMutex);
+	mIndex = std::move(index);
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		IndexIsCurrent
+//
+// Description:		Checks the modification times of all directories in the
+//					index.  Adding or removing a file or directory changes the
+//					modification time of the parent directory.
+//
+// Input Arguments:
+//		index	= const FontIndex&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the index does not need to be rebuilt
+//
+//=============================================================================
+bool FontFinder::IndexIsCurrent(const FontIndex& index)
+{
+	const std::string rootDirectory(GetFontDirectory().utf8_str());
+	if (index.directories.find(rootDirectory) == index.directories.end())
+		return false;
+
+	for (const auto& directory : index.directories)
+	{
+		const wxFileName name(wxFileName::DirName(
+			wxString::FromUTF8(directory.first.c_str())));
+		if (!name.DirExists() ||
+			name.GetModificationTime().GetTicks() != directory.second)
+			return false;
+	}
+
+	return true;
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		StartIndexBuild
+//
+// Description:		Starts scanning the font directories in a worker thread.
+//					When complete, the new index replaces the old one and is
+//					saved to disk.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FontFinder::StartIndexBuild()
+{
+	const wxString fontDirectory(GetFontDirectory());
+	const wxString indexFileName(GetIndexFileName());
+	if (fontDirectory.IsEmpty())
+		return;
+
+	mCancelIndexBuild = false;
+	mIndexBuilder = std::async(std::launch::async,
+		[fontDirectory, indexFileName]()
+	{
+		FontIndex index;
+		ScanDirectory(fontDirectory, index);
+		if (mCancelIndexBuild)
+			return;
+
+		SaveIndex(index, indexFileName);
+
+		std::lock_guard<std::mutex> lock(mIndexMutex);
+		mIndex = std::move(index);
+	});
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		IndexBuildInProgress
+//
+// Description:		Checks to see if the worker thread is still scanning.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//=============================================================================
+bool FontFinder::IndexBuildInProgress()
+{
+	return mIndexBuilder.valid() &&
+		mIndexBuilder.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		WaitForIndex
+//
+// Description:		Blocks until the worker thread (if any) is finished.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FontFinder::WaitForIndex()
+{
+	if (mIndexBuilder.valid())
+		mIndexBuilder.wait();
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		CancelIndexBuild
+//
+// Description:		Signals the worker thread (if any) to stop scanning and
+//					waits for it to finish.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FontFinder::CancelIndexBuild()
+{
+	mCancelIndexBuild = true;
+	WaitForIndex();
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		ScanDirectory
+//
+// Description:		Recursively adds all of the *.ttf files in the specified
+//					directory to the index.
+//
+// Input Arguments:
+//		directory	= const wxString&
+//
+// Output Arguments:
+//		index		= FontIndex&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FontFinder::ScanDirectory(const wxString& directory, FontIndex& index)
+{
+	wxDir dir(directory);
+	if (!dir.IsOpened())
+		return;
+
+	index.directories[std::string(directory.utf8_str())] =
+		wxFileName::DirName(directory).GetModificationTime().GetTicks();
+
+	wxString name, fontName;
+	bool found(dir.GetFirst(&name, _T("*.ttf"), wxDIR_FILES));
+	while (found && !mCancelIndexBuild)
+	{
+		const wxString fontFile(wxFileName(directory, name).GetFullPath());
+		if (GetFontName(fontFile, fontName))
+			index.files.insert(std::make_pair(
+				std::string(fontName.Lower().utf8_str()),
+				std::string(fontFile.utf8_str())));
+		found = dir.GetNext(&name);
+	}
+
+	found = dir.GetFirst(&name, wxEmptyString, wxDIR_DIRS);
+	while (found && !mCancelIndexBuild)
+	{
+		ScanDirectory(wxFileName::DirName(directory).GetPath()
+			+ wxFileName::GetPathSeparator() + name, index);
+		found = dir.GetNext(&name);
+	}
+}
+
+//=============================================================================
+// Class:			FontFinder
+// Function:		SaveIndex
+//
+// Description:		Writes the index to disk.  The file is written under a
+//					temporary name first so other processes never read a
+//					partial index.
+//
+// Input Arguments:
+//		index		= const FontIndex&
+//		fileName	= const wxString&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success, false otherwise
+//
+//=============================================================================
+bool FontFinder::SaveIndex(const FontIndex& index, const wxString& fileName)
+{
+	const wxFileName name(fileName);
+	if (!name.DirExists() &&
+		!wxFileName::Mkdir(name.GetPath(), wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL))
+		return false;
+
+	const wxString tempFileName(fileName + _T(".tmp"));
+	{
+		std::ofstream file(tempFileName.mb_str());
+		if (!file.is_open())
+			return false;
+
+		file << mIndexHeader << '\n';
+		for (const auto& directory : index.directories)
+			file << "D\t" << directory.second << '\t' << directory.first << '\n';
+		for (const auto& font : index.files)
+			file << "F\t" << font.first << '\t' << font.second << '\n';
+
+		if (!file.good())
+			return false;
+	}
+
+	return wxRenameFile(tempFileName, fileName, true);
+}
+
 }// namespace LibPlot2D
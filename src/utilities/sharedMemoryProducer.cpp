@@ -0,0 +1,244 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  sharedMemoryProducer.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Reference writer for the shared-memory streaming protocol.
+
+// Local headers
+#include "lp2d/utilities/sharedMemoryProducer.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <new>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			SharedMemoryProducer
+// Function:		~SharedMemoryProducer
+//
+// Description:		Destructor for SharedMemoryProducer class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+SharedMemoryProducer::~SharedMemoryProducer()
+{
+	Close();
+}
+
+//=============================================================================
+// Class:			SharedMemoryProducer
+// Function:		Create
+//
+// Description:		Creates the shared-memory object and writes the header.
+//
+// Input Arguments:
+//		name			= const std::string&
+//		channelNames	= const std::vector<std::string>&
+//		blockCapacity	= const unsigned int&
+//		blockCount		= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success
+//
+//=============================================================================
+bool SharedMemoryProducer::Create(const std::string& name,
+	const std::vector<std::string>& channelNames,
+	const unsigned int& blockCapacity, const unsigned int& blockCount)
+{
+	Close();
+
+	if (channelNames.empty() ||
+		channelNames.size() > SharedMemoryProtocol::MaxChannels)
+	{
+		mLastError = "Invalid number of channels";
+		return false;
+	}
+	else if (blockCapacity == 0 || blockCount == 0)
+	{
+		mLastError = "Invalid block size";
+		return false;
+	}
+
+	const uint32_t channelCount(static_cast<uint32_t>(channelNames.size()));
+	const uint64_t headerSize(SharedMemoryProtocol::GetHeaderSize());
+	const uint64_t blockSize(SharedMemoryProtocol::GetBlockSize(channelCount,
+		blockCapacity));
+	if (!mRegion.Create(name, headerSize + blockSize * blockCount))
+	{
+		mLastError = mRegion.GetLastError();
+		return false;
+	}
+
+	// The region is initialized to zero, so all sequence numbers start out
+	// as zero
+	mHeader = new (mRegion.GetData()) SharedMemoryProtocol::Header;
+	mHeader->magic = SharedMemoryProtocol::Magic;
+	mHeader->version = SharedMemoryProtocol::Version;
+	mHeader->channelCount = channelCount;
+	mHeader->blockCapacity = blockCapacity;
+	mHeader->blockCount = blockCount;
+	mHeader->headerSize = headerSize;
+	mHeader->blockSize = blockSize;
+
+	unsigned int i;
+	for (i = 0; i < channelCount; ++i)
+	{
+		const size_t length(std::min<size_t>(channelNames[i].size(),
+			SharedMemoryProtocol::NameLength - 1));
+		std::memcpy(mHeader->channels[i].name, channelNames[i].data(), length);
+	}
+
+	for (i = 0; i < blockCount; ++i)
+		new (&SharedMemoryProtocol::GetBlock(*mHeader, i + 1))
+			SharedMemoryProtocol::BlockHeader;
+
+	mSequence = 0;
+	mHeader->writeSequence.store(0, std::memory_order_release);
+	return true;
+}
+
+//=============================================================================
+// Class:			SharedMemoryProducer
+// Function:		Write
+//
+// Description:		Writes samples for all channels.
+//
+// Input Arguments:
+//		x		= const double*
+//		y		= const std::vector<const double*>&
+//		count	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success
+//
+//=============================================================================
+bool SharedMemoryProducer::Write(const double* x,
+	const std::vector<const double*>& y, const unsigned int& count)
+{
+	if (!mHeader)
+	{
+		mLastError = "Shared memory has not been created";
+		return false;
+	}
+	else if (y.size() != mHeader->channelCount)
+	{
+		mLastError = "Number of channels does not match header";
+		return false;
+	}
+
+	std::vector<const double*> blockY(y);
+	unsigned int written(0);
+	while (written < count)
+	{
+		const unsigned int blockCount(std::min(count - written,
+			static_cast<unsigned int>(mHeader->blockCapacity)));
+
+		unsigned int i;
+		for (i = 0; i < y.size(); ++i)
+			blockY[i] = y[i] + written;
+
+		WriteBlock(x + written, blockY, blockCount);
+		written += blockCount;
+	}
+
+	return true;
+}
+
+//=============================================================================
+// Class:			SharedMemoryProducer
+// Function:		WriteBlock
+//
+// Description:		Writes one block, following the sequence described in
+//					SharedMemoryProtocol.
+//
+// Input Arguments:
+//		x		= const double*
+//		y		= const std::vector<const double*>&
+//		count	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SharedMemoryProducer::WriteBlock(const double* x,
+	const std::vector<const double*>& y, const unsigned int& count)
+{
+	assert(count <= mHeader->blockCapacity);
+
+	++mSequence;
+	SharedMemoryProtocol::BlockHeader& block(
+		SharedMemoryProtocol::GetBlock(*mHeader, mSequence));
+
+	// The fence prevents the sample data from being written before readers
+	// can see that the block is invalid
+	block.sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	block.sampleCount = count;
+	std::memcpy(SharedMemoryProtocol::GetXData(block), x,
+		sizeof(double) * count);
+
+	unsigned int i;
+	for (i = 0; i < y.size(); ++i)
+		std::memcpy(SharedMemoryProtocol::GetYData(*mHeader, block, i), y[i],
+			sizeof(double) * count);
+
+	block.sequence.store(mSequence, std::memory_order_release);
+	mHeader->writeSequence.store(mSequence, std::memory_order_release);
+}
+
+//=============================================================================
+// Class:			SharedMemoryProducer
+// Function:		Close
+//
+// Description:		Marks the stream as closed and removes the shared-memory
+//					object.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SharedMemoryProducer::Close()
+{
+	if (mHeader)
+		mHeader->closed.store(1, std::memory_order_release);
+
+	mHeader = nullptr;
+	mRegion.Close();
+}
+
+}// namespace LibPlot2D
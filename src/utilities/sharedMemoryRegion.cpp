@@ -0,0 +1,238 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  sharedMemoryRegion.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Mapping of a named POSIX shared-memory object.
+
+// Local headers
+#include "lp2d/utilities/sharedMemoryRegion.h"
+
+// POSIX headers
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Standard C++ headers
+#include <cerrno>
+#include <cstring>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			SharedMemoryRegion
+// Function:		~SharedMemoryRegion
+//
+// Description:		Destructor for SharedMemoryRegion class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+SharedMemoryRegion::~SharedMemoryRegion()
+{
+	Close();
+}
+
+//=============================================================================
+// Class:			SharedMemoryRegion
+// Function:		Create
+//
+// Description:		Creates and maps a new shared-memory object.
+//
+// Input Arguments:
+//		name	= const std::string&
+//		size	= const size_t& [bytes]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success
+//
+//=============================================================================
+bool SharedMemoryRegion::Create(const std::string& name, const size_t& size)
+{
+	Close();
+
+#ifdef _WIN32
+	(void)name;
+	(void)size;
+	mLastError = "Shared memory is not supported on this platform";
+	return false;
+#else
+	// Any object left behind by a producer which did not exit cleanly is
+	// replaced
+	shm_unlink(name.c_str());
+
+	const int fileDescriptor(shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR,
+		S_IRUSR | S_IWUSR));
+	if (fileDescriptor < 0)
+	{
+		mLastError = "Failed to create '" + name + "':  " + strerror(errno);
+		return false;
+	}
+
+	// ftruncate() fills the new object with zeros
+	if (ftruncate(fileDescriptor, static_cast<off_t>(size)) != 0)
+	{
+		mLastError = "Failed to resize '" + name + "':  " + strerror(errno);
+		close(fileDescriptor);
+		shm_unlink(name.c_str());
+		return false;
+	}
+
+	if (!Map(fileDescriptor, size))
+	{
+		shm_unlink(name.c_str());
+		return false;
+	}
+
+	mName = name;
+	mOwner = true;
+	return true;
+#endif
+}
+
+//=============================================================================
+// Class:			SharedMemoryRegion
+// Function:		Open
+//
+// Description:		Maps an existing shared-memory object.
+//
+// Input Arguments:
+//		name	= const std::string&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success
+//
+//=============================================================================
+bool SharedMemoryRegion::Open(const std::string& name)
+{
+	Close();
+
+#ifdef _WIN32
+	(void)name;
+	mLastError = "Shared memory is not supported on this platform";
+	return false;
+#else
+	const int fileDescriptor(shm_open(name.c_str(), O_RDWR, 0));
+	if (fileDescriptor < 0)
+	{
+		mLastError = "Failed to open '" + name + "':  " + strerror(errno);
+		return false;
+	}
+
+	struct stat status;
+	if (fstat(fileDescriptor, &status) != 0 || status.st_size <= 0)
+	{
+		mLastError = "Failed to determine the size of '" + name + "'";
+		close(fileDescriptor);
+		return false;
+	}
+
+	if (!Map(fileDescriptor, static_cast<size_t>(status.st_size)))
+		return false;
+
+	mName = name;
+	mOwner = false;
+	return true;
+#endif
+}
+
+//=============================================================================
+// Class:			SharedMemoryRegion
+// Function:		Close
+//
+// Description:		Unmaps the object, and removes it if this object created
+//					it.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SharedMemoryRegion::Close()
+{
+#ifndef _WIN32
+	if (mData)
+		munmap(mData, mSize);
+
+	if (mOwner)
+		shm_unlink(mName.c_str());
+#endif
+
+	mData = nullptr;
+	mSize = 0;
+	mOwner = false;
+	mName.clear();
+}
+
+//=============================================================================
+// Class:			SharedMemoryRegion
+// Function:		Map
+//
+// Description:		Maps the specified object into memory.  The file
+//					descriptor is closed (the mapping remains valid).
+//
+// Input Arguments:
+//		fileDescriptor	= const int&
+//		size			= const size_t& [bytes]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true for success
+//
+//=============================================================================
+bool SharedMemoryRegion::Map(const int& fileDescriptor, const size_t& size)
+{
+#ifdef _WIN32
+	(void)fileDescriptor;
+	(void)size;
+	return false;
+#else
+	void* data(mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+		fileDescriptor, 0));
+	const int error(errno);
+	close(fileDescriptor);
+
+	if (data == MAP_FAILED)
+	{
+		mLastError = std::string("Failed to map shared memory:  ") +
+			strerror(error);
+		return false;
+	}
+
+	mData = data;
+	mSize = size;
+	return true;
+#endif
+}
+
+}// namespace LibPlot2D
@@ -15,9 +15,11 @@
 #include <cmath>
 #include <algorithm>
 #include <numeric>
+#include <complex>
 
 // Local headers
 #include "lp2d/utilities/signals/fft.h"
+#include "lp2d/utilities/signals/realFFTPlan.h"
 #include "lp2d/utilities/dataset2D.h"
 #include "lp2d/utilities/math/plotMath.h"
 #include "lp2d/utilities/signals/derivative.h"
@@ -62,7 +64,7 @@ std::unique_ptr<Dataset2D> FastFourierTransform::ComputeFFT(
 //		data			= Dataset2D referring to the data of interest
 //		window			= const WindowType&
 //		windowSize		= unsigned int, number of points in each sample;
-//						  zero uses max sample size
+//						  zero uses the entire sample
 //		overlap			= const double&, percentage overlap (0.0 - 1.0) between
 //						  adjacent samples
 //		subtractMean	= const bool& indicating that the data should be averaged,
@@ -85,18 +87,19 @@ std::unique_ptr<Dataset2D> FastFourierTransform::ComputeFFT(
 		data -= data.ComputeYMean();
 
 	if (windowSize == 0)
-		windowSize = static_cast<unsigned int>(
-			pow(2, GetMaxPowerOfTwo(data.GetNumberOfPoints())));
+		windowSize = static_cast<unsigned int>(data.GetNumberOfPoints());
 
+	const RealFFTPlan plan(windowSize);
 	Dataset2D rawFFT, fft;
 	const std::vector<double>::size_type count(
 		GetNumberOfAverages(windowSize, overlap, data.GetNumberOfPoints()));
 	for (std::vector<double>::size_type i = 0; i < count; ++i)
 	{
-		rawFFT = ComputeRawFFT(ChopSample(data, i, windowSize, overlap), window);
-		AddToAverage(fft, GetAmplitudeData(rawFFT, sampleRate), count);
+		rawFFT = ComputeRawFFT(ChopSample(data, i, windowSize, overlap), window,
+			plan);
+		AddToAverage(fft, GetAmplitudeData(rawFFT, sampleRate, windowSize), count);
 	}
-	fft = ConvertDoubleSidedToSingleSided(fft);
+	fft = ConvertHalfSpectrumToSingleSided(fft);
 
 	return std::make_unique<Dataset2D>(fft);
 }
@@ -203,40 +206,6 @@ void FastFourierTransform::AddToAverage(Dataset2D &average, const Dataset2D &dat
 		average.GetY()[i] += data.GetY()[i] / double(count);
 }
 
-//=============================================================================
-// Class:			FastFourierTransform
-// Function:		InitializeRawFFTDataset (static)
-//
-// Description:		Initializes the raw FFT dataset for future processing.
-//					Applies the specified window.
-//
-// Input Arguments:
-//		data			= const Dataset2D&
-//		numberOfPoints	= const unsigned int&
-//		window			= const WindowType&
-//
-// Output Arguments:
-//		rawFFT			= Dataset2D&
-//
-// Return Value:
-//		None
-//
-//=============================================================================
-void FastFourierTransform::InitializeRawFFTDataset(Dataset2D &rawFFT,
-	const Dataset2D &data, const WindowType &window)
-{
-	rawFFT.Resize(data.GetNumberOfPoints());
-
-	unsigned int i;
-	for (i = 0; i < rawFFT.GetNumberOfPoints(); ++i)
-	{
-		rawFFT.GetX()[i] = data.GetY()[i];
-		rawFFT.GetY()[i] = 0.0;
-	}
-
-	ApplyWindow(rawFFT, window);
-}
-
 //=============================================================================
 // Class:			FastFourierTransform
 // Function:		ComputeRawFFT (static)
@@ -244,11 +213,14 @@ void FastFourierTransform::InitializeRawFFTDataset(Dataset2D &rawFFT,
 // Description:		Computes the raw (complex) FFT data for the specified
 //					time-domain data.  It is expected that the data has size
 //					equal to the number of points to use for the FFT (it is
-//					one FFT sample).
+//					one FFT sample).  The data is real, so only the
+//					non-redundant half of the spectrum (bins 0 through N / 2)
+//					is returned.
 //
 // Input Arguments:
 //		data	= const Dataset2D&
 //		window	= const WindowType& indicating the type of window to use
+//		plan	= const RealFFTPlan& for the length of the data
 //
 // Output Arguments:
 //		None
@@ -258,16 +230,23 @@ void FastFourierTransform::InitializeRawFFTDataset(Dataset2D &rawFFT,
 //
 //=============================================================================
 Dataset2D FastFourierTransform::ComputeRawFFT(const Dataset2D &data,
-	const WindowType &window)
+	const WindowType &window, const RealFFTPlan& plan)
 {
-	Dataset2D rawFFT;
+	assert(plan.GetSize() == data.GetNumberOfPoints());
 
-	InitializeRawFFTDataset(rawFFT, data, window);
-	if (data.GetNumberOfPoints() < 2)
-		return rawFFT;
+	std::vector<double> samples(data.GetY());
+	ApplyWindow(samples, window);
 
-	DoBitReversal(rawFFT);
-	DoFFT(rawFFT);
+	std::vector<std::complex<double>> spectrum;
+	plan.Execute(samples, spectrum);
+
+	Dataset2D rawFFT(spectrum.size());
+	std::vector<double>::size_type i;
+	for (i = 0; i < spectrum.size(); ++i)
+	{
+		rawFFT.GetX()[i] = spectrum[i].real();
+		rawFFT.GetY()[i] = spectrum[i].imag();
+	}
 
 	return rawFFT;
 }
@@ -304,16 +283,18 @@ void FastFourierTransform::ComputeFRF(const Dataset2D &input,
 	unsigned int i, windowSize;
 	double overlap = ComputeOverlap(windowSize, numberOfAverages, input.GetNumberOfPoints());
 
-	Dataset2D fftIn, fftOut, crossPower(windowSize), power(windowSize), size(GenerateConstantDataset(static_cast<double>(numberOfAverages), 0.0, windowSize));
+	const RealFFTPlan plan(windowSize);
+	const auto spectrumSize(plan.GetSpectrumSize());
+	Dataset2D fftIn, fftOut, crossPower(spectrumSize), power(spectrumSize), size(GenerateConstantDataset(static_cast<double>(numberOfAverages), 0.0, spectrumSize));
 	ZeroDataset(crossPower);
 	ZeroDataset(power);
 	for (i = 0; i < numberOfAverages; ++i)
 	{
-		fftIn = ComputeRawFFT(ChopSample(input, i, windowSize, overlap), window);
-		fftOut = ComputeRawFFT(ChopSample(output, i, windowSize, overlap), window);
+		fftIn = ComputeRawFFT(ChopSample(input, i, windowSize, overlap), window, plan);
+		fftOut = ComputeRawFFT(ChopSample(output, i, windowSize, overlap), window, plan);
 
-		crossPower = ComplexAdd(crossPower, ComputeCrossPowerSpectrum(fftIn, fftOut));
-		power = ComplexAdd(power, ComputePowerSpectrum(fftIn));
+		crossPower = ComplexAdd(crossPower, ComputeCrossPowerSpectrum(fftIn, fftOut, windowSize));
+		power = ComplexAdd(power, ComputePowerSpectrum(fftIn, windowSize));
 	}
 
 	crossPower = ComplexDivide(crossPower, size);
@@ -321,9 +302,9 @@ void FastFourierTransform::ComputeFRF(const Dataset2D &input,
 	Dataset2D rawFRF = ComplexDivide(crossPower, power);
 
 	const double sampleRate(1.0 / input.GetAverageDeltaX());// [Hz]
-	amplitude = ConvertDoubleSidedToSingleSided(GetAmplitudeData(rawFRF, sampleRate), false);
+	amplitude = ConvertHalfSpectrumToSingleSided(GetAmplitudeData(rawFRF, sampleRate, windowSize), false);
 	if (phase)
-		*phase = ConvertDoubleSidedToSingleSided(GetPhaseData(rawFRF, sampleRate, moduloPhase), false);
+		*phase = ConvertHalfSpectrumToSingleSided(GetPhaseData(rawFRF, sampleRate, windowSize, moduloPhase), false);
 	if (coherence)
 		*coherence = ConvertDoubleSidedToSingleSided(ComputeCoherence(input, output), false);
 
@@ -348,6 +329,7 @@ void FastFourierTransform::ComputeFRF(const Dataset2D &input,
 // Input Arguments:
 //		fftIn	= const Dataset2D&
 //		fftOut	= const Dataset2D&
+//		fftSize	= const unsigned int&, number of points transformed
 //
 // Output Arguments:
 //		None
@@ -356,7 +338,8 @@ void FastFourierTransform::ComputeFRF(const Dataset2D &input,
 //		Dataset2D
 //
 //=============================================================================
-Dataset2D FastFourierTransform::ComputeCrossPowerSpectrum(const Dataset2D &fftIn, const Dataset2D &fftOut)
+Dataset2D FastFourierTransform::ComputeCrossPowerSpectrum(const Dataset2D &fftIn, const Dataset2D &fftOut,
+	const unsigned int &fftSize)
 {
 	assert(fftIn.GetNumberOfPoints() == fftOut.GetNumberOfPoints());
 
@@ -364,7 +347,7 @@ Dataset2D FastFourierTransform::ComputeCrossPowerSpectrum(const Dataset2D &fftIn
 	unsigned int i;
 	for (i = 0; i < size.GetNumberOfPoints(); ++i)
 	{
-		size.GetX()[i] = static_cast<double>(size.GetNumberOfPoints()) * static_cast<double>(size.GetNumberOfPoints());
+		size.GetX()[i] = static_cast<double>(fftSize) * static_cast<double>(fftSize);
 		size.GetY()[i] = 0.0;
 	}
 
@@ -379,6 +362,7 @@ Dataset2D FastFourierTransform::ComputeCrossPowerSpectrum(const Dataset2D &fftIn
 //
 // Input Arguments:
 //		fft		= const Dataset2D&
+//		fftSize	= const unsigned int&, number of points transformed
 //
 // Output Arguments:
 //		None
@@ -387,9 +371,10 @@ Dataset2D FastFourierTransform::ComputeCrossPowerSpectrum(const Dataset2D &fftIn
 //		Dataset2D
 //
 //=============================================================================
-Dataset2D FastFourierTransform::ComputePowerSpectrum(const Dataset2D &fft)
+Dataset2D FastFourierTransform::ComputePowerSpectrum(const Dataset2D &fft,
+	const unsigned int &fftSize)
 {
-	return ComputeCrossPowerSpectrum(fft, fft);
+	return ComputeCrossPowerSpectrum(fft, fft, fftSize);
 }
 
 //=============================================================================
@@ -414,26 +399,28 @@ Dataset2D FastFourierTransform::ComputeCoherence(const Dataset2D& input,
 {
 	assert(input.GetNumberOfPoints() == output.GetNumberOfPoints());
 
-	const unsigned int windowSize(static_cast<unsigned int>(
-		pow(2, GetMaxPowerOfTwo(input.GetNumberOfPoints()))));
+	const unsigned int windowSize(
+		static_cast<unsigned int>(input.GetNumberOfPoints()));
 
+	const RealFFTPlan plan(windowSize);
 	Dataset2D fftIn(ComputeRawFFT(ChopSample(input, 0, windowSize, 0.0),
-		WindowType::Uniform));
+		WindowType::Uniform, plan));
 	Dataset2D fftOut(ComputeRawFFT(ChopSample(output, 0, windowSize, 0.0),
-		WindowType::Uniform));
+		WindowType::Uniform, plan));
 
-	Dataset2D crossPower(ComputeCrossPowerSpectrum(fftIn, fftOut));
-	Dataset2D inputPower(ComputePowerSpectrum(fftIn));
-	Dataset2D outputPower(ComputePowerSpectrum(fftOut));
+	Dataset2D crossPower(ComputeCrossPowerSpectrum(fftIn, fftOut, windowSize));
+	Dataset2D inputPower(ComputePowerSpectrum(fftIn, windowSize));
+	Dataset2D outputPower(ComputePowerSpectrum(fftOut, windowSize));
 
 	Dataset2D rawCoherence = ComplexDivide(ComplexPower(
 		ComplexMagnitude(crossPower), 2.0),
 		ComplexMultiply(inputPower, outputPower));
-	rawCoherence = ConvertDoubleSidedToSingleSided(rawCoherence);
+	rawCoherence = ConvertHalfSpectrumToSingleSided(rawCoherence);
 
 	double sampleRate = 1.0 / input.GetAverageDeltaX();// [Hz]
 
-	return GetAmplitudeData(rawCoherence, sampleRate);
+	return GetAmplitudeData(rawCoherence, sampleRate,
+		static_cast<unsigned int>(rawCoherence.GetNumberOfPoints()));
 }
 
 //=============================================================================
@@ -489,108 +476,6 @@ Dataset2D FastFourierTransform::GenerateConstantDataset(const double &xValue, co
 	return data;
 }
 
-//=============================================================================
-// Class:			FastFourierTransform
-// Function:		DoBitReversal (static)
-//
-// Description:		Performs bit reversal on processing dataset.  It is assumed
-//					that the set has already been padded/chopped.
-//
-// Input Arguments:
-//		set			= Dataset2D&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//=============================================================================
-void FastFourierTransform::DoBitReversal(Dataset2D &set)
-{
-	assert(double(set.GetNumberOfPoints()) / 2.0 == double(set.GetNumberOfPoints() / 2));
-
-	std::vector<double>::size_type i, j;
-	double tempX, tempY;
-
-	j = 0;
-	for (i = 0; i < set.GetNumberOfPoints() - 1; ++i)
-	{
-		if (i < j)
-		{
-			tempX = set.GetX()[i];
-			tempY = set.GetY()[i];
-			set.GetX()[i] = set.GetX()[j];
-			set.GetY()[i] = set.GetY()[j];
-			set.GetX()[j] = tempX;
-			set.GetY()[j] = tempY;
-		}
-
-		auto k(set.GetNumberOfPoints() >> 1);
-		while (k <= j)
-		{
-			j -= k;
-			k >>= 1;
-		}
-
-		j += k;
-	}
-}
-
-//=============================================================================
-// Class:			FastFourierTransform
-// Function:		DoFFT (static)
-//
-// Description:		Performs the calculation to get raw FFT data.
-//
-// Input Arguments:
-//		powerOfTwo	= const unsigned int&
-//		temp		= Dataset2D&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//=============================================================================
-void FastFourierTransform::DoFFT(Dataset2D &temp)
-{
-	std::vector<double>::size_type i, j, i1, l, l2;
-	double c1, c2, t1, t2, z;
-	unsigned int powerOfTwo = GetMaxPowerOfTwo(temp.GetNumberOfPoints());
-
-	c1 = -1.0;
-	c2 = 0.0;
-	l2 = 1;
-	for (l = 0; l < powerOfTwo; ++l)
-	{
-		std::vector<double>::size_type l1(l2);
-		l2 <<= 1;
-		double u1(1.0);
-		double u2(0.0);
-		for (j = 0; j < l1; ++j)
-		{
-			for (i = j; i < temp.GetNumberOfPoints(); i += l2)
-			{
-				i1 = i + l1;
-				t1 = u1 * temp.GetX()[i1] - u2 * temp.GetY()[i1];
-				t2 = u1 * temp.GetY()[i1] + u2 * temp.GetX()[i1];
-				temp.GetX()[i1] = temp.GetX()[i] - t1;
-				temp.GetY()[i1] = temp.GetY()[i] - t2;
-				temp.GetX()[i] += t1;
-				temp.GetY()[i] += t2;
-			}
-			z =  u1 * c1 - u2 * c2;
-			u2 = u1 * c2 + u2 * c1;
-			u1 = z;
-		}
-		c2 = sqrt((1.0 - c1) / 2.0);
-		c2 = -c2;
-		c1 = sqrt((1.0 + c1) / 2.0);
-	}
-}
-
 //=============================================================================
 // Class:			FastFourierTransform
 // Function:		ConvertDoubleSidedToSingleSided (static)
@@ -640,6 +525,48 @@ Dataset2D FastFourierTransform::ConvertDoubleSidedToSingleSided(const Dataset2D
 	return halfSpectrum;
 }
 
+//=============================================================================
+// Class:			FastFourierTransform
+// Function:		ConvertHalfSpectrumToSingleSided (static)
+//
+// Description:		Converts the non-redundant half of a spectrum (bins 0
+//					through N / 2, as computed by ComputeRawFFT) to
+//					single-sided data.  Equivalent to
+//					ConvertDoubleSidedToSingleSided for the full spectrum.
+//
+// Input Arguments:
+//		halfSpectrum	= const Dataset2D& containing bins 0 through N / 2
+//		preserveDCValue	= const bool& indicating whether or not to keep the 0 Hz point (optional)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Dataset2D containing single-sided data
+//
+//=============================================================================
+Dataset2D FastFourierTransform::ConvertHalfSpectrumToSingleSided(const Dataset2D &halfSpectrum, const bool &preserveDCValue)
+{
+	if (halfSpectrum.GetNumberOfPoints() == 0)
+		return halfSpectrum;
+
+	Dataset2D singleSided;
+	if (preserveDCValue)
+	{
+		singleSided = halfSpectrum;// No factor of 2 for DC point
+		for (std::vector<double>::size_type i = 1; i < singleSided.GetNumberOfPoints(); ++i)
+			singleSided.GetY()[i] *= 2.0;
+	}
+	else
+	{
+		singleSided.Resize(halfSpectrum.GetNumberOfPoints() - 1);
+		std::copy(halfSpectrum.GetX().cbegin() + 1, halfSpectrum.GetX().cend(), singleSided.GetX().begin());
+		std::copy(halfSpectrum.GetY().cbegin() + 1, halfSpectrum.GetY().cend(), singleSided.GetY().begin());
+	}
+
+	return singleSided;
+}
+
 //=============================================================================
 // Class:			FastFourierTransform
 // Function:		ConvertAmplitudeToDecibels (static)
@@ -673,6 +600,7 @@ void FastFourierTransform::ConvertAmplitudeToDecibels(Dataset2D &fft, const doub
 //
 // Input Arguments:
 //		sampleRate	= const double& [Hz]
+//		fftSize		= const unsigned int&, number of points transformed
 //
 // Output Arguments:
 //		data		= Dataset2D&
@@ -682,10 +610,10 @@ void FastFourierTransform::ConvertAmplitudeToDecibels(Dataset2D &fft, const doub
 //
 //=============================================================================
 void FastFourierTransform::PopulateFrequencyData(Dataset2D &data,
-	const double &sampleRate)
+	const double &sampleRate, const unsigned int &fftSize)
 {
 	for (std::vector<double>::size_type i = 0; i < data.GetNumberOfPoints(); ++i)
-		data.GetX()[i] = i * sampleRate / data.GetNumberOfPoints();
+		data.GetX()[i] = i * sampleRate / fftSize;
 }
 
 //=============================================================================
@@ -698,6 +626,7 @@ void FastFourierTransform::PopulateFrequencyData(Dataset2D &data,
 // Input Arguments:
 //		rawFFT		= const Dataset2D&
 //		sampleRate	= const double& [Hz]
+//		fftSize		= const unsigned int&, number of points transformed
 //
 // Output Arguments:
 //		None
@@ -707,14 +636,14 @@ void FastFourierTransform::PopulateFrequencyData(Dataset2D &data,
 //
 //=============================================================================
 Dataset2D FastFourierTransform::GetAmplitudeData(const Dataset2D &rawFFT,
-	const double &sampleRate)
+	const double &sampleRate, const unsigned int &fftSize)
 {
 	Dataset2D data(rawFFT);
-	PopulateFrequencyData(data, sampleRate);
+	PopulateFrequencyData(data, sampleRate, fftSize);
 
 	for (std::vector<double>::size_type i = 0; i < data.GetNumberOfPoints(); ++i)
 		data.GetY()[i] = sqrt(rawFFT.GetX()[i] * rawFFT.GetX()[i]
-		+ rawFFT.GetY()[i] * rawFFT.GetY()[i]) / rawFFT.GetNumberOfPoints();
+		+ rawFFT.GetY()[i] * rawFFT.GetY()[i]) / fftSize;
 
 	return data;
 }
@@ -729,6 +658,7 @@ Dataset2D FastFourierTransform::GetAmplitudeData(const Dataset2D &rawFFT,
 // Input Arguments:
 //		rawFFT		= const Dataset2D&
 //		sampleRate	= const double& [Hz]
+//		fftSize		= const unsigned int&, number of points transformed
 //		moduloPhase	= const bool&
 //
 // Output Arguments:
@@ -739,10 +669,10 @@ Dataset2D FastFourierTransform::GetAmplitudeData(const Dataset2D &rawFFT,
 //
 //=============================================================================
 Dataset2D FastFourierTransform::GetPhaseData(const Dataset2D &rawFFT, const double &sampleRate,
-	const bool &moduloPhase)
+	const unsigned int &fftSize, const bool &moduloPhase)
 {
 	Dataset2D data(rawFFT);
-	PopulateFrequencyData(data, sampleRate);
+	PopulateFrequencyData(data, sampleRate, fftSize);
 
 	for (std::vector<double>::size_type i = 0; i < data.GetNumberOfPoints(); ++i)
 		data.GetY()[i] = atan2(rawFFT.GetY()[i], rawFFT.GetX()[i]);
@@ -924,7 +854,7 @@ Dataset2D FastFourierTransform::ComplexPower(const Dataset2D &a, const double &p
 //					must have size equal to the number of points in the FFT.
 //
 // Input Arguments:
-//		data	= Dataset2D&
+//		data	= std::vector<double>&
 //		window	= const WindowType&
 //
 // Output Arguments:
@@ -934,7 +864,7 @@ Dataset2D FastFourierTransform::ComplexPower(const Dataset2D &a, const double &p
 //		None
 //
 //=============================================================================
-void FastFourierTransform::ApplyWindow(Dataset2D &data, const WindowType &window)
+void FastFourierTransform::ApplyWindow(std::vector<double> &data, const WindowType &window)
 {
 	if (window == WindowType::Uniform)
 		return;// No processing necessary
@@ -961,7 +891,7 @@ void FastFourierTransform::ApplyWindow(Dataset2D &data, const WindowType &window
 //					coherent gain of 0.5.
 //
 // Input Arguments:
-//		data	= Dataset2D&
+//		data	= std::vector<double>&
 //
 // Output Arguments:
 //		None
@@ -970,11 +900,11 @@ void FastFourierTransform::ApplyWindow(Dataset2D &data, const WindowType &window
 //		None
 //
 //=============================================================================
-void FastFourierTransform::ApplyHannWindow(Dataset2D &data)
+void FastFourierTransform::ApplyHannWindow(std::vector<double> &data)
 {
-	for (std::vector<double>::size_type i = 0; i < data.GetNumberOfPoints(); ++i)
-		data.GetX()[i] *= 1.0 - cos(
-			2.0 * M_PI * i / (data.GetNumberOfPoints() - 1.0));
+	for (std::vector<double>::size_type i = 0; i < data.size(); ++i)
+		data[i] *= 1.0 - cos(
+			2.0 * M_PI * i / (data.size() - 1.0));
 }
 
 //=============================================================================
@@ -985,7 +915,7 @@ void FastFourierTransform::ApplyHannWindow(Dataset2D &data)
 //					gain of 0.54.
 //
 // Input Arguments:
-//		data	= Dataset2D&
+//		data	= std::vector<double>&
 //
 // Output Arguments:
 //		None
@@ -994,11 +924,11 @@ void FastFourierTransform::ApplyHannWindow(Dataset2D &data)
 //		None
 //
 //=============================================================================
-void FastFourierTransform::ApplyHammingWindow(Dataset2D &data)
+void FastFourierTransform::ApplyHammingWindow(std::vector<double> &data)
 {
-	const double pointsMinusOne(data.GetNumberOfPoints() - 1.0);
-	for (std::vector<double>::size_type i = 0; i < data.GetNumberOfPoints(); ++i)
-		data.GetX()[i] *= (0.54 - 0.46
+	const double pointsMinusOne(data.size() - 1.0);
+	for (std::vector<double>::size_type i = 0; i < data.size(); ++i)
+		data[i] *= (0.54 - 0.46
 		* cos(2.0 * M_PI * i / pointsMinusOne)) / 0.54;
 }
 
@@ -1011,7 +941,7 @@ void FastFourierTransform::ApplyHammingWindow(Dataset2D &data)
 //					incorrect.  Can not find any references explaining this.
 //
 // Input Arguments:
-//		data	= Dataset2D&
+//		data	= std::vector<double>&
 //
 // Output Arguments:
 //		None
@@ -1020,11 +950,11 @@ void FastFourierTransform::ApplyHammingWindow(Dataset2D &data)
 //		None
 //
 //=============================================================================
-void FastFourierTransform::ApplyFlatTopWindow(Dataset2D &data)
+void FastFourierTransform::ApplyFlatTopWindow(std::vector<double> &data)
 {
-	const double pointsMinusOne(data.GetNumberOfPoints() - 1.0);
-	for (std::vector<double>::size_type i = 0; i < data.GetNumberOfPoints(); ++i)
-		data.GetX()[i] *= 1.0
+	const double pointsMinusOne(data.size() - 1.0);
+	for (std::vector<double>::size_type i = 0; i < data.size(); ++i)
+		data[i] *= 1.0
 		- 1.93 * cos(2.0 * M_PI * i / pointsMinusOne)
 		+ 1.29 * cos(4.0 * M_PI * i / pointsMinusOne)
 		- 0.388 * cos(6.0 * M_PI * i / pointsMinusOne)
@@ -1038,7 +968,7 @@ void FastFourierTransform::ApplyFlatTopWindow(Dataset2D &data)
 // Description:		Applies a force window to the data.
 //
 // Input Arguments:
-//		data	= Dataset2D&
+//		data	= std::vector<double>&
 //
 // Output Arguments:
 //		None
@@ -1047,7 +977,7 @@ void FastFourierTransform::ApplyFlatTopWindow(Dataset2D &data)
 //		None
 //
 //=============================================================================
-/*void FastFourierTransform::ApplyForceWindow(Dataset2D &data)
+/*void FastFourierTransform::ApplyForceWindow(std::vector<double> &data)
 {
 }*/
 
@@ -1060,7 +990,7 @@ void FastFourierTransform::ApplyFlatTopWindow(Dataset2D &data)
 //					amplitude to 2% of original value at the end of the window.
 //
 // Input Arguments:
-//		data	= Dataset2D&
+//		data	= std::vector<double>&
 //
 // Output Arguments:
 //		None
@@ -1069,11 +999,11 @@ void FastFourierTransform::ApplyFlatTopWindow(Dataset2D &data)
 //		None
 //
 //=============================================================================
-void FastFourierTransform::ApplyExponentialWindow(Dataset2D &data)
+void FastFourierTransform::ApplyExponentialWindow(std::vector<double> &data)
 {
-	const double tau((1.0 - data.GetNumberOfPoints()) / log(0.02));
-	for (std::vector<double>::size_type i = 0; i < data.GetNumberOfPoints(); ++i)
-		data.GetX()[i] *= exp(-static_cast<int>(i) / tau);
+	const double tau((1.0 - data.size()) / log(0.02));
+	for (std::vector<double>::size_type i = 0; i < data.size(); ++i)
+		data[i] *= exp(-static_cast<int>(i) / tau);
 }
 
 //=============================================================================
@@ -1145,7 +1075,8 @@ std::vector<double>::size_type FastFourierTransform::GetNumberOfAverages(
 // Function:		ComputeOverlap (static)
 //
 // Description:		Computes the required overlap (and updates other parameters).
-//					Keeps the overlap <= 50%.
+//					Keeps the overlap <= 50%.  With a single average, the
+//					window is the entire sample.
 //
 // Input Arguments:
 //		numberOfAverages	= std::vector<double>::size_type&
@@ -1161,16 +1092,15 @@ std::vector<double>::size_type FastFourierTransform::GetNumberOfAverages(
 double FastFourierTransform::ComputeOverlap(unsigned int &windowSize,
 	std::vector<double>::size_type &numberOfAverages, const std::vector<double>::size_type &dataSize)
 {
-	unsigned int maxWindowSize(static_cast<unsigned int>(
-		pow(2, GetMaxPowerOfTwo(dataSize))));
-	if (numberOfAverages == 1)
+	if (numberOfAverages <= 1)
 	{
-		windowSize = maxWindowSize;
+		numberOfAverages = 1;
+		windowSize = static_cast<unsigned int>(dataSize);
 		return 0.0;
 	}
 
-	if (numberOfAverages >= maxWindowSize)
-		numberOfAverages = maxWindowSize / 2;
+	if (numberOfAverages >= dataSize)
+		numberOfAverages = std::max<std::vector<double>::size_type>(dataSize / 2, 1);
 
 	windowSize = static_cast<unsigned int>(pow(2.0,
 		ceil(log(static_cast<double>(dataSize)
@@ -1180,7 +1110,8 @@ double FastFourierTransform::ComputeOverlap(unsigned int &windowSize,
 		ComputeRequiredOverlapPoints(dataSize, windowSize, numberOfAverages));
 	if (static_cast<double>(overlapPoints) / static_cast<double>(windowSize) > 0.5)
 	{
-		windowSize /= 2;
+		// Any length may be transformed, so no data is discarded
+		windowSize = static_cast<unsigned int>(dataSize / numberOfAverages);
 		return 0.0;
 	}
 
@@ -0,0 +1,593 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  fftPlan.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Precomputed factors and twiddles for a complex FFT of any length.
+
+// Local headers
+#include "lp2d/utilities/signals/fftPlan.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for FFTPlan class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const size_t FFTPlan::MaxDirectRadix(61);
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		FFTPlan
+//
+// Description:		Constructor for FFTPlan class.
+//
+// Input Arguments:
+//		size	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+FFTPlan::FFTPlan(const size_t& size) : mSize(size)
+{
+	if (mSize < 2)
+		return;
+
+	if (!Factor())
+	{
+		mStages.clear();
+		InitializeBluestein();
+		return;
+	}
+
+	const double pi(std::acos(-1.0));
+	mTwiddles.resize(mSize);
+	size_t i;
+	for (i = 0; i < mSize; ++i)
+	{
+		const double phase(-2.0 * pi * i / mSize);
+		mTwiddles[i] = Complex(std::cos(phase), std::sin(phase));
+	}
+
+	mWork.resize(mSize);
+
+	size_t largestRadix(0);
+	for (const auto& stage : mStages)
+		largestRadix = std::max(largestRadix, stage.radix);
+	if (largestRadix > 5)
+		mGenericScratch.resize(largestRadix);
+}
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		~FFTPlan
+//
+// Description:		Destructor for FFTPlan class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+FFTPlan::~FFTPlan() = default;
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		Factor
+//
+// Description:		Splits the length into the radices of each pass.  Radix 4
+//					is preferred, followed by 2, 3, 5 and then larger primes.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, false if the length has a prime factor larger than
+//		MaxDirectRadix
+//
+//=============================================================================
+bool FFTPlan::Factor()
+{
+	size_t remaining(mSize);
+	auto addStages([this, &remaining](const size_t& radix)
+	{
+		while (remaining % radix == 0)
+		{
+			remaining /= radix;
+			mStages.push_back({ radix, remaining });
+		}
+	});
+
+	addStages(4);
+	addStages(2);
+
+	size_t radix;
+	for (radix = 3; radix <= MaxDirectRadix && remaining > 1; radix += 2)
+		addStages(radix);
+
+	return remaining == 1;
+}
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		InitializeBluestein
+//
+// Description:		Prepares the chirp and its spectrum for computing the
+//					transform as a circular convolution.  Uses the identity
+//					nk = (n^2 + k^2 - (k - n)^2) / 2.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FFTPlan::InitializeBluestein()
+{
+	size_t convolutionSize(1);
+	while (convolutionSize < 2 * mSize - 1)
+		convolutionSize <<= 1;
+
+	mConvolutionPlan.reset(new FFTPlan(convolutionSize));
+
+	// k^2 is reduced modulo 2N to keep the phase accurate for large k
+	const double pi(std::acos(-1.0));
+	mChirp.resize(mSize);
+	size_t i;
+	for (i = 0; i < mSize; ++i)
+	{
+		const unsigned long long square(static_cast<unsigned long long>(i) * i
+			% (2 * mSize));
+		const double phase(-pi * square / mSize);
+		mChirp[i] = Complex(std::cos(phase), std::sin(phase));
+	}
+
+	// The 1 / M scaling of the inverse transform is included here
+	mChirpSpectrum.assign(convolutionSize, Complex(0.0, 0.0));
+	for (i = 0; i < mSize; ++i)
+	{
+		mChirpSpectrum[i] = std::conj(mChirp[i])
+			/ static_cast<double>(convolutionSize);
+		if (i > 0)
+			mChirpSpectrum[convolutionSize - i] = mChirpSpectrum[i];
+	}
+
+	mConvolutionPlan->Execute(mChirpSpectrum);
+	mConvolution.resize(convolutionSize);
+}
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		Execute
+//
+// Description:		Computes the forward transform of the specified data.
+//
+// Input Arguments:
+//		data	= std::vector<Complex>&
+//
+// Output Arguments:
+//		data	= std::vector<Complex>&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FFTPlan::Execute(std::vector<Complex>& data) const
+{
+	assert(data.size() == mSize);
+	if (mSize < 2)
+		return;
+
+	if (mConvolutionPlan)
+	{
+		ExecuteBluestein(data);
+		return;
+	}
+
+	std::copy(data.begin(), data.end(), mWork.begin());
+	Transform(data.data(), mWork.data(), 1, 0);
+}
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		Transform
+//
+// Description:		Recursive decimation-in-time pass.  Each of the p
+//					interleaved sub-sequences (spaced stride * p apart in the
+//					input) is transformed into a contiguous block of the
+//					output, then the blocks are combined with a radix-p
+//					butterfly.
+//
+// Input Arguments:
+//		output	= Complex*
+//		input	= const Complex*
+//		stride	= const size_t&
+//		stage	= const size_t&
+//
+// Output Arguments:
+//		output	= Complex*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FFTPlan::Transform(Complex* output, const Complex* input,
+	const size_t& stride, const size_t& stage) const
+{
+	const size_t p(mStages[stage].radix);
+	const size_t m(mStages[stage].remaining);
+
+	size_t i;
+	if (m == 1)
+	{
+		for (i = 0; i < p; ++i)
+			output[i] = input[i * stride];
+	}
+	else
+	{
+		for (i = 0; i < p; ++i)
+			Transform(output + i * m, input + i * stride, stride * p,
+				stage + 1);
+	}
+
+	switch (p)
+	{
+	case 2:
+		Butterfly2(output, stride, m);
+		break;
+
+	case 3:
+		Butterfly3(output, stride, m);
+		break;
+
+	case 4:
+		Butterfly4(output, stride, m);
+		break;
+
+	case 5:
+		Butterfly5(output, stride, m);
+		break;
+
+	default:
+		ButterflyGeneric(output, stride, m, p);
+	}
+}
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		Butterfly2
+//
+// Description:		Combines two transforms of length m.
+//
+// Input Arguments:
+//		data	= Complex*
+//		stride	= const size_t&, twiddle index step
+//		m		= const size_t&
+//
+// Output Arguments:
+//		data	= Complex*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FFTPlan::Butterfly2(Complex* data, const size_t& stride,
+	const size_t& m) const
+{
+	size_t k;
+	for (k = 0; k < m; ++k)
+	{
+		const Complex t(Multiply(data[k + m], mTwiddles[k * stride]));
+		data[k + m] = data[k] - t;
+		data[k] += t;
+	}
+}
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		Butterfly3
+//
+// Description:		Combines three transforms of length m.
+//
+// Input Arguments:
+//		data	= Complex*
+//		stride	= const size_t&, twiddle index step
+//		m		= const size_t&
+//
+// Output Arguments:
+//		data	= Complex*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FFTPlan::Butterfly3(Complex* data, const size_t& stride,
+	const size_t& m) const
+{
+	// Imaginary part of exp(-2 pi i / 3)
+	const double sine(mTwiddles[stride * m].imag());
+
+	size_t k;
+	for (k = 0; k < m; ++k)
+	{
+		const Complex a1(Multiply(data[k + m], mTwiddles[k * stride]));
+		const Complex a2(Multiply(data[k + 2 * m], mTwiddles[2 * k * stride]));
+
+		const Complex sum(a1 + a2);
+		const Complex difference(MultiplyByI((a1 - a2) * sine));
+		const Complex base(data[k] - sum * 0.5);
+
+		data[k] += sum;
+		data[k + m] = base + difference;
+		data[k + 2 * m] = base - difference;
+	}
+}
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		Butterfly4
+//
+// Description:		Combines four transforms of length m.
+//
+// Input Arguments:
+//		data	= Complex*
+//		stride	= const size_t&, twiddle index step
+//		m		= const size_t&
+//
+// Output Arguments:
+//		data	= Complex*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FFTPlan::Butterfly4(Complex* data, const size_t& stride,
+	const size_t& m) const
+{
+	size_t k;
+	for (k = 0; k < m; ++k)
+	{
+		const Complex a1(Multiply(data[k + m], mTwiddles[k * stride]));
+		const Complex a2(Multiply(data[k + 2 * m], mTwiddles[2 * k * stride]));
+		const Complex a3(Multiply(data[k + 3 * m], mTwiddles[3 * k * stride]));
+
+		const Complex evenSum(data[k] + a2);
+		const Complex evenDifference(data[k] - a2);
+		const Complex oddSum(a1 + a3);
+		const Complex oddDifference(MultiplyByI(a1 - a3));// times i
+
+		data[k] = evenSum + oddSum;
+		data[k + m] = evenDifference - oddDifference;
+		data[k + 2 * m] = evenSum - oddSum;
+		data[k + 3 * m] = evenDifference + oddDifference;
+	}
+}
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		Butterfly5
+//
+// Description:		Combines five transforms of length m.
+//
+// Input Arguments:
+//		data	= Complex*
+//		stride	= const size_t&, twiddle index step
+//		m		= const size_t&
+//
+// Output Arguments:
+//		data	= Complex*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FFTPlan::Butterfly5(Complex* data, const size_t& stride,
+	const size_t& m) const
+{
+	// exp(-2 pi i / 5) and exp(-4 pi i / 5)
+	const Complex w1(mTwiddles[stride * m]);
+	const Complex w2(mTwiddles[2 * stride * m]);
+
+	size_t k;
+	for (k = 0; k < m; ++k)
+	{
+		const Complex a0(data[k]);
+		const Complex a1(Multiply(data[k + m], mTwiddles[k * stride]));
+		const Complex a2(Multiply(data[k + 2 * m], mTwiddles[2 * k * stride]));
+		const Complex a3(Multiply(data[k + 3 * m], mTwiddles[3 * k * stride]));
+		const Complex a4(Multiply(data[k + 4 * m], mTwiddles[4 * k * stride]));
+
+		// Conjugate pairs of twiddles combine the sums and differences of
+		// opposite inputs
+		const Complex sum14(a1 + a4);
+		const Complex difference14(a1 - a4);
+		const Complex sum23(a2 + a3);
+		const Complex difference23(a2 - a3);
+
+		const Complex base1(a0 + sum14 * w1.real() + sum23 * w2.real());
+		const Complex base2(a0 + sum14 * w2.real() + sum23 * w1.real());
+		const Complex rotation1(MultiplyByI(difference14 * w1.imag()
+			+ difference23 * w2.imag()));
+		const Complex rotation2(MultiplyByI(difference14 * w2.imag()
+			- difference23 * w1.imag()));
+
+		data[k] = a0 + sum14 + sum23;
+		data[k + m] = base1 + rotation1;
+		data[k + 2 * m] = base2 + rotation2;
+		data[k + 3 * m] = base2 - rotation2;
+		data[k + 4 * m] = base1 - rotation1;
+	}
+}
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		ButterflyGeneric
+//
+// Description:		Combines p transforms of length m by direct evaluation
+//					(used for prime radices larger than five).
+//
+// Input Arguments:
+//		data	= Complex*
+//		stride	= const size_t&, twiddle index step
+//		m		= const size_t&
+//		p		= const size_t&
+//
+// Output Arguments:
+//		data	= Complex*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FFTPlan::ButterflyGeneric(Complex* data, const size_t& stride,
+	const size_t& m, const size_t& p) const
+{
+	size_t k, q, r;
+	for (k = 0; k < m; ++k)
+	{
+		for (q = 0; q < p; ++q)
+			mGenericScratch[q] = data[k + q * m];
+
+		for (q = 0; q < p; ++q)
+		{
+			const size_t outputIndex(k + q * m);
+			const size_t step(stride * outputIndex % mSize);
+			size_t twiddleIndex(0);
+			Complex sum(mGenericScratch[0]);
+			for (r = 1; r < p; ++r)
+			{
+				twiddleIndex += step;
+				if (twiddleIndex >= mSize)
+					twiddleIndex -= mSize;
+				sum += Multiply(mGenericScratch[r], mTwiddles[twiddleIndex]);
+			}
+
+			data[outputIndex] = sum;
+		}
+	}
+}
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		ExecuteBluestein
+//
+// Description:		Computes the transform as a circular convolution of the
+//					chirp-modulated data with the chirp.  The inverse
+//					transform is computed with the forward plan by
+//					conjugating before and after.
+//
+// Input Arguments:
+//		data	= std::vector<Complex>&
+//
+// Output Arguments:
+//		data	= std::vector<Complex>&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FFTPlan::ExecuteBluestein(std::vector<Complex>& data) const
+{
+	size_t i;
+	for (i = 0; i < mSize; ++i)
+		mConvolution[i] = Multiply(data[i], mChirp[i]);
+	std::fill(mConvolution.begin() + mSize, mConvolution.end(),
+		Complex(0.0, 0.0));
+
+	mConvolutionPlan->Execute(mConvolution);
+	for (i = 0; i < mConvolution.size(); ++i)
+		mConvolution[i] = std::conj(Multiply(mConvolution[i],
+			mChirpSpectrum[i]));
+
+	mConvolutionPlan->Execute(mConvolution);
+	for (i = 0; i < mSize; ++i)
+		data[i] = Multiply(std::conj(mConvolution[i]), mChirp[i]);
+}
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		Multiply
+//
+// Description:		Complex multiplication without the special handling of
+//					infinite and NaN values required of std::complex (which
+//					prevents inlining).
+//
+// Input Arguments:
+//		a	= const Complex&
+//		b	= const Complex&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Complex
+//
+//=============================================================================
+FFTPlan::Complex FFTPlan::Multiply(const Complex& a, const Complex& b)
+{
+	return Complex(a.real() * b.real() - a.imag() * b.imag(),
+		a.real() * b.imag() + a.imag() * b.real());
+}
+
+//=============================================================================
+// Class:			FFTPlan
+// Function:		MultiplyByI
+//
+// Description:		Multiplies by the imaginary unit.
+//
+// Input Arguments:
+//		a	= const Complex&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Complex
+//
+//=============================================================================
+FFTPlan::Complex FFTPlan::MultiplyByI(const Complex& a)
+{
+	return Complex(-a.imag(), a.real());
+}
+
+}// namespace LibPlot2D
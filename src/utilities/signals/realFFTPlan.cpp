@@ -0,0 +1,123 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  realFFTPlan.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Real-input FFT producing the non-redundant half of the spectrum.
+
+// Local headers
+#include "lp2d/utilities/signals/realFFTPlan.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			RealFFTPlan
+// Function:		RealFFTPlan
+//
+// Description:		Constructor for RealFFTPlan class.
+//
+// Input Arguments:
+//		size	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+RealFFTPlan::RealFFTPlan(const size_t& size) : mSize(size),
+	mPacked(size % 2 == 0), mComplexPlan(mPacked ? size / 2 : size)
+{
+	mBuffer.resize(mComplexPlan.GetSize());
+	if (!mPacked)
+		return;
+
+	// exp(-2 pi i k / N) for the bins computed
+	const double pi(std::acos(-1.0));
+	mTwiddles.resize(GetSpectrumSize());
+	size_t i;
+	for (i = 0; i < mTwiddles.size(); ++i)
+	{
+		const double phase(-2.0 * pi * i / mSize);
+		mTwiddles[i] = Complex(std::cos(phase), std::sin(phase));
+	}
+}
+
+//=============================================================================
+// Class:			RealFFTPlan
+// Function:		Execute
+//
+// Description:		Computes the non-redundant half of the spectrum of the
+//					specified data.  For even lengths, the transform Z of the
+//					packed sequence z[n] = x[2n] + i x[2n + 1] is separated
+//					into the transforms of the even and odd samples using
+//					the conjugate symmetry of each:
+//					E[k] = (Z[k] + Z*[M - k]) / 2
+//					O[k] = -i (Z[k] - Z*[M - k]) / 2
+//					X[k] = E[k] + exp(-2 pi i k / N) O[k]
+//
+// Input Arguments:
+//		input	= const std::vector<double>&
+//
+// Output Arguments:
+//		output	= std::vector<Complex>&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void RealFFTPlan::Execute(const std::vector<double>& input,
+	std::vector<Complex>& output) const
+{
+	assert(input.size() == mSize);
+	output.resize(GetSpectrumSize());
+	if (mSize == 0)
+		return;
+
+	size_t i;
+	if (!mPacked)
+	{
+		for (i = 0; i < mSize; ++i)
+			mBuffer[i] = Complex(input[i], 0.0);
+		mComplexPlan.Execute(mBuffer);
+		std::copy(mBuffer.begin(), mBuffer.begin() + output.size(),
+			output.begin());
+		return;
+	}
+
+	const size_t halfSize(mBuffer.size());
+	for (i = 0; i < halfSize; ++i)
+		mBuffer[i] = Complex(input[2 * i], input[2 * i + 1]);
+	mComplexPlan.Execute(mBuffer);
+
+	for (i = 0; i <= halfSize; ++i)
+	{
+		const Complex z(mBuffer[i == halfSize ? 0 : i]);
+		const Complex mirror(mBuffer[i == 0 ? 0 : halfSize - i]);
+
+		const double evenReal(0.5 * (z.real() + mirror.real()));
+		const double evenImag(0.5 * (z.imag() - mirror.imag()));
+		const double oddReal(0.5 * (z.imag() + mirror.imag()));
+		const double oddImag(-0.5 * (z.real() - mirror.real()));
+
+		const Complex& w(mTwiddles[i]);
+		output[i] = Complex(
+			evenReal + w.real() * oddReal - w.imag() * oddImag,
+			evenImag + w.real() * oddImag + w.imag() * oddReal);
+	}
+}
+
+}// namespace LibPlot2D
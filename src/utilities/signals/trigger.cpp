@@ -0,0 +1,276 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  trigger.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Locates oscilloscope-style trigger events in a Dataset2D.
+
+// Local headers
+#include "lp2d/utilities/signals/trigger.h"
+#include "lp2d/utilities/dataset2D.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			Trigger
+// Function:		Trigger
+//
+// Description:		Constructor for Trigger class.
+//
+// Input Arguments:
+//		settings	= const Settings&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+Trigger::Trigger(const Settings& settings) : mSettings(settings)
+{
+	assert(mSettings.hysteresis >= 0.0);
+	assert(mSettings.preTrigger >= 0.0);
+	assert(mSettings.postTrigger >= 0.0);
+	assert(mSettings.holdoff >= 0.0);
+
+	mRisingDetector.rising = true;
+	mFallingDetector.rising = false;
+	Reset();
+}
+
+//=============================================================================
+// Class:			Trigger
+// Function:		Reset
+//
+// Description:		Clears the scan state.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Trigger::Reset()
+{
+	mRisingDetector.armed = false;
+	mFallingDetector.armed = false;
+	mScanned = false;
+	mNextAllowedX = -std::numeric_limits<double>::max();
+}
+
+//=============================================================================
+// Class:			Trigger
+// Function:		Scan
+//
+// Description:		Finds events in the points which have not already been
+//					scanned.
+//
+// Input Arguments:
+//		data	= const Dataset2D&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<double> containing the x-values of the events
+//
+//=============================================================================
+std::vector<double> Trigger::Scan(const Dataset2D& data)
+{
+	const std::vector<double>& x(data.GetX());
+	const std::vector<double>& y(data.GetY());
+
+	size_t start(0);
+	if (mScanned)
+		start = std::upper_bound(x.begin(), x.end(), mLastX) - x.begin();
+
+	std::vector<double> events;
+	if (start == x.size())
+		return events;
+
+	if (mSettings.type == Type::Edge)
+		ScanEdges(x, y, start, x.size(), events);
+	else
+		ScanLevel(x, y, start, x.size(), events);
+
+	mLastX = x.back();
+	mLastY = y.back();
+	mScanned = true;
+
+	return events;
+}
+
+//=============================================================================
+// Class:			Trigger
+// Function:		DetectorEnabled
+//
+// Description:		Determines whether or not the specified detector is used
+//					with the current slope setting.
+//
+// Input Arguments:
+//		detector	= const EdgeDetector&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//=============================================================================
+bool Trigger::DetectorEnabled(const EdgeDetector& detector) const
+{
+	if (detector.rising)
+		return mSettings.slope != Slope::Falling;
+	return mSettings.slope != Slope::Rising;
+}
+
+//=============================================================================
+// Class:			Trigger
+// Function:		ScanEdges
+//
+// Description:		Runs the edge detectors over each sample in the specified
+//					range.
+//
+// Input Arguments:
+//		x		= const std::vector<double>&
+//		y		= const std::vector<double>&
+//		start	= const size_t&
+//		end		= const size_t&
+//
+// Output Arguments:
+//		events	= std::vector<double>&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Trigger::ScanEdges(const std::vector<double>& x,
+	const std::vector<double>& y, const size_t& start, const size_t& end,
+	std::vector<double>& events)
+{
+	const double level(mSettings.level);
+	const double risingArm(mSettings.level - mSettings.hysteresis);
+	const double fallingArm(mSettings.level + mSettings.hysteresis);
+
+	size_t i;
+	for (i = start; i < end; ++i)
+	{
+		bool crossed(false);
+		for (auto* detector : { &mRisingDetector, &mFallingDetector })
+		{
+			if (!DetectorEnabled(*detector))
+				continue;
+
+			if (detector->rising)
+			{
+				if (!detector->armed)
+					detector->armed = y[i] < risingArm;
+				else if (y[i] >= level)
+				{
+					detector->armed = false;
+					crossed = true;
+				}
+			}
+			else
+			{
+				if (!detector->armed)
+					detector->armed = y[i] > fallingArm;
+				else if (y[i] <= level)
+				{
+					detector->armed = false;
+					crossed = true;
+				}
+			}
+		}
+
+		// A detector is only armed after at least one sample, so a previous
+		// sample always exists here
+		if (!crossed)
+			continue;
+
+		const double previousX(i > 0 ? x[i - 1] : mLastX);
+		const double previousY(i > 0 ? y[i - 1] : mLastY);
+		double eventX(previousX + (level - previousY) * (x[i] - previousX) /
+			(y[i] - previousY));
+		if (!std::isfinite(eventX))
+			eventX = x[i];
+
+		// Crossings within the holdoff are consumed without an event
+		if (eventX < mNextAllowedX)
+			continue;
+
+		events.push_back(eventX);
+		mNextAllowedX = eventX + mSettings.holdoff;
+	}
+}
+
+//=============================================================================
+// Class:			Trigger
+// Function:		ScanLevel
+//
+// Description:		Finds samples beyond the level within the specified range.
+//					Level triggers are held off for at least the length of
+//					the capture window, so consecutive captures do not
+//					overlap.  The samples within the holdoff are skipped with
+//					a binary search (the x-values are sorted).
+//
+// Input Arguments:
+//		x		= const std::vector<double>&
+//		y		= const std::vector<double>&
+//		start	= const size_t&
+//		end		= const size_t&
+//
+// Output Arguments:
+//		events	= std::vector<double>&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Trigger::ScanLevel(const std::vector<double>& x,
+	const std::vector<double>& y, const size_t& start, const size_t& end,
+	std::vector<double>& events)
+{
+	const double holdoff(std::max(mSettings.holdoff,
+		mSettings.preTrigger + mSettings.postTrigger));
+	const bool below(mSettings.slope == Slope::Falling);
+
+	size_t i(start);
+	while (i < end)
+	{
+		if (x[i] < mNextAllowedX)
+		{
+			i = std::lower_bound(x.begin() + i, x.begin() + end,
+				mNextAllowedX) - x.begin();
+			continue;
+		}
+
+		if ((below && y[i] <= mSettings.level) ||
+			(!below && y[i] >= mSettings.level))
+		{
+			events.push_back(x[i]);
+			mNextAllowedX = x[i] + holdoff;
+		}
+		++i;
+	}
+}
+
+}// namespace LibPlot2D
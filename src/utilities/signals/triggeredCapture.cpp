@@ -0,0 +1,279 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  triggeredCapture.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Collects and averages segments of data aligned to trigger events.
+
+// Local headers
+#include "lp2d/utilities/signals/triggeredCapture.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <cmath>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			TriggeredCapture
+// Function:		TriggeredCapture
+//
+// Description:		Constructor for TriggeredCapture class.
+//
+// Input Arguments:
+//		settings		= const Trigger::Settings&
+//		segmentCount	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+TriggeredCapture::TriggeredCapture(const Trigger::Settings& settings,
+	const unsigned int& segmentCount) : mTrigger(settings),
+	mSegmentCount(segmentCount)
+{
+}
+
+//=============================================================================
+// Class:			TriggeredCapture
+// Function:		Update
+//
+// Description:		Scans new points and captures the events for which the
+//					entire capture window is available.
+//
+// Input Arguments:
+//		data	= const Dataset2D&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int, number of segments captured
+//
+//=============================================================================
+unsigned int TriggeredCapture::Update(const Dataset2D& data)
+{
+	const std::vector<double>& x(data.GetX());
+	if (x.size() < 2)
+		return 0;
+
+	const Trigger::Settings& settings(mTrigger.GetSettings());
+	if (mAverageStep == 0.0)
+	{
+		// The average is sampled at the (mean) sample period of the first
+		// data received
+		mAverageStep = (x.back() - x.front()) / (x.size() - 1);
+		if (!(mAverageStep > 0.0))
+		{
+			mAverageStep = 0.0;
+			return 0;
+		}
+
+		const size_t averageSize(static_cast<size_t>((settings.preTrigger +
+			settings.postTrigger) / mAverageStep) + 1);
+		mAverageSums.assign(averageSize, 0.0);
+		mAverageCounts.assign(averageSize, 0);
+	}
+
+	const std::vector<double> events(mTrigger.Scan(data));
+	mPendingEvents.insert(mPendingEvents.end(), events.begin(), events.end());
+
+	std::vector<double> completed;
+	while (!mPendingEvents.empty() &&
+		mPendingEvents.front() + settings.postTrigger <= x.back())
+	{
+		// Events too close to the start of the data (or whose pre-trigger
+		// data has been discarded from a streamed curve) are skipped
+		if (mPendingEvents.front() - settings.preTrigger >= x.front())
+			completed.push_back(mPendingEvents.front());
+		mPendingEvents.pop_front();
+	}
+
+	// Only the most recent segments are kept, so earlier segments are only
+	// added to the average
+	const size_t firstKept(completed.size() > mSegmentCount ?
+		completed.size() - mSegmentCount : 0);
+	size_t i;
+	for (i = 0; i < completed.size(); ++i)
+	{
+		AddToAverage(data, completed[i]);
+		if (i >= firstKept)
+			CaptureSegment(data, completed[i]);
+	}
+
+	mCaptureCount += completed.size();
+	return static_cast<unsigned int>(completed.size());
+}
+
+//=============================================================================
+// Class:			TriggeredCapture
+// Function:		Reset
+//
+// Description:		Discards all segments and the average and restarts the
+//					scan.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void TriggeredCapture::Reset()
+{
+	mTrigger.Reset();
+	mPendingEvents.clear();
+	mSegments.clear();
+	mCaptureCount = 0;
+	mAverageStep = 0.0;
+	mAverageSums.clear();
+	mAverageCounts.clear();
+}
+
+//=============================================================================
+// Class:			TriggeredCapture
+// Function:		GetAverage
+//
+// Description:		Returns the average of all captured segments.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Dataset2D
+//
+//=============================================================================
+Dataset2D TriggeredCapture::GetAverage() const
+{
+	Dataset2D average;
+	const double start(-mTrigger.GetSettings().preTrigger);
+
+	size_t i;
+	for (i = 0; i < mAverageCounts.size(); ++i)
+	{
+		if (mAverageCounts[i] == 0)
+			continue;
+
+		average.GetX().push_back(start + i * mAverageStep);
+		average.GetY().push_back(mAverageSums[i] / mAverageCounts[i]);
+	}
+
+	return average;
+}
+
+//=============================================================================
+// Class:			TriggeredCapture
+// Function:		CaptureSegment
+//
+// Description:		Copies the points within the capture window of the
+//					specified event to the list of recent segments.
+//
+// Input Arguments:
+//		data	= const Dataset2D&
+//		eventX	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void TriggeredCapture::CaptureSegment(const Dataset2D& data,
+	const double& eventX)
+{
+	const std::vector<double>& x(data.GetX());
+	const auto first(std::lower_bound(x.begin(), x.end(),
+		eventX - mTrigger.GetSettings().preTrigger) - x.begin());
+	const auto last(std::upper_bound(x.begin() + first, x.end(),
+		eventX + mTrigger.GetSettings().postTrigger) - x.begin());
+
+	// Re-use the storage of the oldest segment
+	Dataset2D segment;
+	if (mSegments.size() >= mSegmentCount && !mSegments.empty())
+	{
+		segment = std::move(mSegments.front());
+		mSegments.pop_front();
+	}
+
+	segment.Resize(last - first);
+	auto i(first);
+	for (; i < last; ++i)
+	{
+		segment.GetX()[i - first] = x[i] - eventX;
+		segment.GetY()[i - first] = data.GetY()[i];
+	}
+
+	mSegments.push_back(std::move(segment));
+}
+
+//=============================================================================
+// Class:			TriggeredCapture
+// Function:		AddToAverage
+//
+// Description:		Interpolates the data around the specified event onto the
+//					points of the average and adds the values to the sums.
+//
+// Input Arguments:
+//		data	= const Dataset2D&
+//		eventX	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void TriggeredCapture::AddToAverage(const Dataset2D& data,
+	const double& eventX)
+{
+	const std::vector<double>& x(data.GetX());
+	const std::vector<double>& y(data.GetY());
+	const double start(eventX - mTrigger.GetSettings().preTrigger);
+
+	size_t j(std::lower_bound(x.begin(), x.end(), start) - x.begin());
+	size_t i;
+	for (i = 0; i < mAverageSums.size(); ++i)
+	{
+		const double target(start + i * mAverageStep);
+		while (j < x.size() && x[j] < target)
+			++j;
+
+		if (j == x.size())
+			break;
+
+		double value;
+		if (x[j] == target)
+			value = y[j];
+		else if (j == 0)
+			continue;
+		else
+			value = y[j - 1] + (y[j] - y[j - 1]) * (target - x[j - 1]) /
+				(x[j] - x[j - 1]);
+
+		if (std::isfinite(value))
+		{
+			mAverageSums[i] += value;
+			++mAverageCounts[i];
+		}
+	}
+}
+
+}// namespace LibPlot2D
@@ -0,0 +1,374 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  spatialIndex.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Uniform grid for locating the points of a Dataset2D by position.
+
+// Local headers
+#include "lp2d/utilities/spatialIndex.h"
+#include "lp2d/utilities/dataset2D.h"
+#include "lp2d/utilities/math/plotMath.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			SpatialIndex
+// Function:		Constant declarations
+//
+// Description:		Constant declarations for SpatialIndex class.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+const unsigned int SpatialIndex::mTargetPointsPerCell(4);
+const unsigned int SpatialIndex::mMaximumCellsPerSide(2048);
+
+//=============================================================================
+// Class:			SpatialIndex
+// Function:		Rebuild
+//
+// Description:		Builds the index from the current contents of the data.
+//					The number of cells is chosen to give a few points per
+//					cell (on average), and the points are sorted into the
+//					cells with a counting sort.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SpatialIndex::Rebuild()
+{
+	Clear();
+
+	const std::vector<double>& x(mData.GetX());
+	const std::vector<double>& y(mData.GetY());
+	assert(x.size() == y.size());
+
+	double xMax(-std::numeric_limits<double>::max());
+	double yMax(-std::numeric_limits<double>::max());
+	mXMin = std::numeric_limits<double>::max();
+	mYMin = std::numeric_limits<double>::max();
+	unsigned int validCount(0), i;
+	for (i = 0; i < x.size(); ++i)
+	{
+		if (!PlotMath::IsValid<double>(x[i]) || !PlotMath::IsValid<double>(y[i]))
+			continue;
+
+		mXMin = std::min(mXMin, x[i]);
+		xMax = std::max(xMax, x[i]);
+		mYMin = std::min(mYMin, y[i]);
+		yMax = std::max(yMax, y[i]);
+		++validCount;
+	}
+
+	if (validCount == 0)
+		return;
+
+	const unsigned int side(std::min(mMaximumCellsPerSide, std::max(1U,
+		static_cast<unsigned int>(sqrt(static_cast<double>(validCount)
+		/ mTargetPointsPerCell)))));
+	mColumns = side;
+	mRows = side;
+	mXCellScale = xMax > mXMin ? mColumns / (xMax - mXMin) : 0.0;
+	mYCellScale = yMax > mYMin ? mRows / (yMax - mYMin) : 0.0;
+
+	std::vector<unsigned int> cells(x.size());
+	mCellStarts.assign(mColumns * mRows + 1, 0);
+	for (i = 0; i < x.size(); ++i)
+	{
+		if (!PlotMath::IsValid<double>(x[i]) || !PlotMath::IsValid<double>(y[i]))
+		{
+			cells[i] = mColumns * mRows;// Not indexed
+			continue;
+		}
+
+		cells[i] = GetRow(y[i]) * mColumns + GetColumn(x[i]);
+		++mCellStarts[cells[i] + 1];
+	}
+
+	for (i = 1; i < mCellStarts.size(); ++i)
+		mCellStarts[i] += mCellStarts[i - 1];
+
+	std::vector<unsigned int> next(mCellStarts.begin(), mCellStarts.end() - 1);
+	mPoints.resize(validCount);
+	for (i = 0; i < x.size(); ++i)
+	{
+		if (cells[i] < mColumns * mRows)
+			mPoints[next[cells[i]]++] = i;
+	}
+}
+
+//=============================================================================
+// Class:			SpatialIndex
+// Function:		Clear
+//
+// Description:		Removes all points from the index.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SpatialIndex::Clear()
+{
+	mColumns = 0;
+	mRows = 0;
+	mCellStarts.clear();
+	mPoints.clear();
+}
+
+//=============================================================================
+// Class:			SpatialIndex
+// Function:		VisitRectangle
+//
+// Description:		Calls the visitor for each point within the specified
+//					rectangle.  Only the cells overlapping the rectangle are
+//					searched.  The visitor returns false to stop the search.
+//
+// Input Arguments:
+//		xMin	= const double&
+//		xMax	= const double&
+//		yMin	= const double&
+//		yMax	= const double&
+//		visit	= Visitor
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename Visitor>
+void SpatialIndex::VisitRectangle(const double& xMin, const double& xMax,
+	const double& yMin, const double& yMax, Visitor visit) const
+{
+	if (mPoints.empty() || xMax < xMin || yMax < yMin)
+		return;
+
+	const std::vector<double>& x(mData.GetX());
+	const std::vector<double>& y(mData.GetY());
+	const unsigned int lastColumn(GetColumn(xMax));
+	const unsigned int lastRow(GetRow(yMax));
+	unsigned int row, column, i;
+	for (row = GetRow(yMin); row <= lastRow; ++row)
+	{
+		for (column = GetColumn(xMin); column <= lastColumn; ++column)
+		{
+			const unsigned int cell(row * mColumns + column);
+			for (i = mCellStarts[cell]; i < mCellStarts[cell + 1]; ++i)
+			{
+				const unsigned int point(mPoints[i]);
+				if (x[point] < xMin || x[point] > xMax ||
+					y[point] < yMin || y[point] > yMax)
+					continue;
+
+				if (!visit(point))
+					return;
+			}
+		}
+	}
+}
+
+//=============================================================================
+// Class:			SpatialIndex
+// Function:		FindInRectangle
+//
+// Description:		Finds all points within the specified rectangle.
+//
+// Input Arguments:
+//		xMin	= const double&
+//		xMax	= const double&
+//		yMin	= const double&
+//		yMax	= const double&
+//
+// Output Arguments:
+//		indices	= std::vector<unsigned int>&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SpatialIndex::FindInRectangle(const double& xMin, const double& xMax,
+	const double& yMin, const double& yMax,
+	std::vector<unsigned int>& indices) const
+{
+	indices.clear();
+	VisitRectangle(xMin, xMax, yMin, yMax, [&indices](const unsigned int& i)
+	{
+		indices.push_back(i);
+		return true;
+	});
+}
+
+//=============================================================================
+// Class:			SpatialIndex
+// Function:		CountInRectangle
+//
+// Description:		Counts the points within the specified rectangle, stopping
+//					once the limit is reached.
+//
+// Input Arguments:
+//		xMin	= const double&
+//		xMax	= const double&
+//		yMin	= const double&
+//		yMax	= const double&
+//		limit	= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//=============================================================================
+unsigned int SpatialIndex::CountInRectangle(const double& xMin,
+	const double& xMax, const double& yMin, const double& yMax,
+	const unsigned int& limit) const
+{
+	unsigned int count(0);
+	if (limit == 0)
+		return count;
+
+	VisitRectangle(xMin, xMax, yMin, yMax, [&count, &limit](const unsigned int&)
+	{
+		return ++count < limit;
+	});
+
+	return count;
+}
+
+//=============================================================================
+// Class:			SpatialIndex
+// Function:		FindNearest
+//
+// Description:		Finds the point closest to the specified location, within
+//					the specified search ranges.
+//
+// Input Arguments:
+//		x		= const double&
+//		y		= const double&
+//		xRange	= const double&
+//		yRange	= const double&
+//
+// Output Arguments:
+//		index	= unsigned int&
+//
+// Return Value:
+//		bool, true if a point was found
+//
+//=============================================================================
+bool SpatialIndex::FindNearest(const double& x, const double& y,
+	const double& xRange, const double& yRange, unsigned int& index) const
+{
+	assert(xRange > 0.0 && yRange > 0.0);
+
+	const std::vector<double>& xData(mData.GetX());
+	const std::vector<double>& yData(mData.GetY());
+	double closest(std::numeric_limits<double>::max());
+	VisitRectangle(x - xRange, x + xRange, y - yRange, y + yRange,
+		[&xData, &yData, &x, &y, &xRange, &yRange, &closest, &index](
+		const unsigned int& i)
+	{
+		const double dx((xData[i] - x) / xRange);
+		const double dy((yData[i] - y) / yRange);
+		const double distance(dx * dx + dy * dy);
+		if (distance < closest)
+		{
+			closest = distance;
+			index = i;
+		}
+
+		return true;
+	});
+
+	return closest < std::numeric_limits<double>::max();
+}
+
+//=============================================================================
+// Class:			SpatialIndex
+// Function:		GetColumn
+//
+// Description:		Returns the column of the cell containing the specified
+//					x-value.  Values outside of the grid are clamped.
+//
+// Input Arguments:
+//		x	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//=============================================================================
+unsigned int SpatialIndex::GetColumn(const double& x) const
+{
+	const double column((x - mXMin) * mXCellScale);
+	if (!(column > 0.0))
+		return 0;
+
+	return std::min(static_cast<unsigned int>(std::min(column,
+		static_cast<double>(mColumns))), mColumns - 1);
+}
+
+//=============================================================================
+// Class:			SpatialIndex
+// Function:		GetRow
+//
+// Description:		Returns the row of the cell containing the specified
+//					y-value.  Values outside of the grid are clamped.
+//
+// Input Arguments:
+//		y	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int
+//
+//=============================================================================
+unsigned int SpatialIndex::GetRow(const double& y) const
+{
+	const double row((y - mYMin) * mYCellScale);
+	if (!(row > 0.0))
+		return 0;
+
+	return std::min(static_cast<unsigned int>(std::min(row,
+		static_cast<double>(mRows))), mRows - 1);
+}
+
+}// namespace LibPlot2D
@@ -0,0 +1,310 @@
+/*=============================================================================
+                                   LibPlot2D
+                       Copyright Kerry R. Loux 2011-2016
+
+                  This code is licensed under the GPLv2 License
+                    (http://opensource.org/licenses/GPL-2.0).
+=============================================================================*/
+
+// File:  streamChannel.cpp
+// Date:  10/17/2026
+// Auth:  K. Loux
+// Desc:  Channel for passing samples from an acquisition thread to a plot.
+
+// Local headers
+#include "lp2d/utilities/streamChannel.h"
+#include "lp2d/utilities/dataset2D.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+
+namespace LibPlot2D
+{
+
+//=============================================================================
+// Class:			StreamChannel
+// Function:		StreamChannel
+//
+// Description:		Constructor for StreamChannel class.
+//
+// Input Arguments:
+//		capacity	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+StreamChannel::StreamChannel(const size_t& capacity) : mBuffer(capacity)
+{
+}
+
+//=============================================================================
+// Class:			StreamChannel
+// Function:		Push
+//
+// Description:		Adds samples to the channel.  Called by the producer.
+//
+// Input Arguments:
+//		x		= const double*
+//		y		= const double*
+//		count	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t, number of samples accepted
+//
+//=============================================================================
+size_t StreamChannel::Push(const double* x, const double* y,
+	const size_t& count)
+{
+	// Samples are interleaved in small blocks to avoid allocating memory on
+	// the producer thread
+	std::array<Sample, 256> block;
+	size_t accepted(0);
+	while (accepted < count)
+	{
+		const size_t blockSize(std::min(block.size(), count - accepted));
+		size_t i;
+		for (i = 0; i < blockSize; ++i)
+		{
+			block[i].x = x[accepted + i];
+			block[i].y = y[accepted + i];
+		}
+
+		const size_t pushed(mBuffer.Push(block.data(), blockSize));
+		accepted += pushed;
+		if (pushed < blockSize)
+			break;
+	}
+
+	mDroppedCount += count - accepted;
+	return accepted;
+}
+
+//=============================================================================
+// Class:			StreamChannel
+// Function:		Push
+//
+// Description:		Adds a single sample to the channel.  Called by the
+//					producer.
+//
+// Input Arguments:
+//		x	= const double&
+//		y	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, true if the sample was accepted
+//
+//=============================================================================
+bool StreamChannel::Push(const double& x, const double& y)
+{
+	return Push(&x, &y, 1) == 1;
+}
+
+//=============================================================================
+// Class:			StreamChannel
+// Function:		Drain
+//
+// Description:		Moves queued samples into the specified data set and
+//					removes the oldest points beyond the history size.
+//					Points are removed in blocks of at least a quarter of the
+//					history size, so the cost of shifting the data (and of
+//					rebuilding the curve) is amortized over many updates;
+//					between removals, samples are only appended.
+//
+// Input Arguments:
+//		historySize	= const size_t&
+//
+// Output Arguments:
+//		data		= Dataset2D&
+//		trimmed		= bool*, optional
+//
+// Return Value:
+//		size_t, number of samples added
+//
+//=============================================================================
+size_t StreamChannel::Drain(Dataset2D& data, const size_t& historySize,
+	bool* trimmed)
+{
+	assert(historySize > 0);
+	if (trimmed)
+		*trimmed = false;
+
+	mReceived.clear();
+	if (mBuffer.Pop(mReceived) == 0)
+		return 0;
+
+	const size_t maximumSize(historySize + historySize / 4);
+	std::vector<double>& x(data.GetX());
+	std::vector<double>& y(data.GetY());
+	for (const auto& sample : mReceived)
+	{
+		x.push_back(sample.x);
+		y.push_back(sample.y);
+		AddToExtrema(sample);
+	}
+
+	if (x.size() > maximumSize)
+	{
+		const auto excess(x.size() - historySize);
+		x.erase(x.begin(), x.begin() + excess);
+		y.erase(y.begin(), y.begin() + excess);
+		if (trimmed)
+			*trimmed = true;
+	}
+
+	DiscardExtremaBefore(x[GetHistoryStart(data, historySize)]);
+
+	return mReceived.size();
+}
+
+//=============================================================================
+// Class:			StreamChannel
+// Function:		GetHistoryStart
+//
+// Description:		Returns the index of the oldest point within the history
+//					(points before this are waiting to be removed).
+//
+// Input Arguments:
+//		data		= const Dataset2D&
+//		historySize	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t
+//
+//=============================================================================
+size_t StreamChannel::GetHistoryStart(const Dataset2D& data,
+	const size_t& historySize)
+{
+	const size_t size(data.GetNumberOfPoints());
+	return size > historySize ? size - historySize : 0;
+}
+
+//=============================================================================
+// Class:			StreamChannel
+// Function:		GetRange
+//
+// Description:		Gets the range of y-values for points at or beyond the
+//					specified x-value.
+//
+// Input Arguments:
+//		xStart	= const double&
+//
+// Output Arguments:
+//		yMin	= double&
+//		yMax	= double&
+//
+// Return Value:
+//		bool, true if any points are in the range
+//
+//=============================================================================
+bool StreamChannel::GetRange(const double& xStart, double& yMin, double& yMax)
+{
+	DiscardExtremaBefore(xStart);
+	if (mMinimums.empty())
+		return false;
+
+	yMin = mMinimums.front().y;
+	yMax = mMaximums.front().y;
+	return true;
+}
+
+//=============================================================================
+// Class:			StreamChannel
+// Function:		ResetExtrema
+//
+// Description:		Rebuilds the range information from the specified data.
+//
+// Input Arguments:
+//		data	= const Dataset2D&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void StreamChannel::ResetExtrema(const Dataset2D& data)
+{
+	mMinimums.clear();
+	mMaximums.clear();
+
+	unsigned int i;
+	for (i = 0; i < data.GetNumberOfPoints(); ++i)
+		AddToExtrema({ data.GetX()[i], data.GetY()[i] });
+}
+
+//=============================================================================
+// Class:			StreamChannel
+// Function:		AddToExtrema
+//
+// Description:		Adds the newest sample to the minimum and maximum
+//					candidates.  Older candidates which can no longer be the
+//					extreme value of any window are removed.
+//
+// Input Arguments:
+//		sample	= const Sample&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void StreamChannel::AddToExtrema(const Sample& sample)
+{
+	if (!std::isfinite(sample.y))
+		return;
+
+	while (!mMinimums.empty() && mMinimums.back().y >= sample.y)
+		mMinimums.pop_back();
+	mMinimums.push_back(sample);
+
+	while (!mMaximums.empty() && mMaximums.back().y <= sample.y)
+		mMaximums.pop_back();
+	mMaximums.push_back(sample);
+}
+
+//=============================================================================
+// Class:			StreamChannel
+// Function:		DiscardExtremaBefore
+//
+// Description:		Removes candidates with x-values less than the specified
+//					value.
+//
+// Input Arguments:
+//		x	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void StreamChannel::DiscardExtremaBefore(const double& x)
+{
+	while (!mMinimums.empty() && mMinimums.front().x < x)
+		mMinimums.pop_front();
+
+	while (!mMaximums.empty() && mMaximums.front().x < x)
+		mMaximums.pop_front();
+}
+
+}// namespace LibPlot2D